@@ -0,0 +1,120 @@
+/******************************************************************************
+ *
+ * Module: ADC
+ *
+ * File Name: ADC.c
+ *
+ * Description: Source file for the ATmega32 ADC driver
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "common_macros.h"
+#include "diagnostics.h"
+
+#include "ADC.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static void (* volatile g_adcCallBackPtr)(uint16) = NULL_PTR;
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+/* Description :
+ * Initialize the ADC with required reference & clock from Config_Ptr*/
+void ADC_init(const ADC_ConfigType * Config_Ptr)
+{
+   /*************************************************
+	***************** ADMUX Settings ****************
+	*  REFS1:0 = Reference voltage from Config_Ptr
+	*  ADLAR   = 0 Right adjusted result
+	*  MUX4:0  = 0 Channel 0 until a channel is selected
+	*************************************************/
+	ADMUX = (Config_Ptr->ref_volt << REFS0);
+
+   /*************************************************
+	***************** ADCSRA Settings ***************
+	*  ADEN    = 1 Enable ADC
+	*  ADATE   = 0 Single conversions until free running is started
+	*  ADIE    = 0 Interrupt disabled until free running is started
+	*  ADPS2:0 = Clock pre-scaler from Config_Ptr (ADC clock 50 - 200 KHz)
+	*************************************************/
+	ADCSRA = (1<<ADEN) | (Config_Ptr->prescaler & 0x07);
+}
+
+/* Description :
+ * Convert the given channel once by polling and return the result*/
+uint16 ADC_readChannel(uint8 channel_num)
+{
+	/*Select the channel keeping the reference bits*/
+	ADMUX = (ADMUX & 0xE0) | (channel_num & 0x07);
+
+	SET_BIT(ADCSRA,ADSC);
+
+	/*Wait for the conversion complete flag then clear it by writing ONE*/
+	while(BIT_IS_CLEAR(ADCSRA,ADIF));
+	SET_BIT(ADCSRA,ADIF);
+
+	return ADC;
+}
+
+/* Description :
+ * Convert the given channel continuously (free running mode)*/
+void ADC_startFreeRunning(uint8 channel_num)
+{
+	ADMUX = (ADMUX & 0xE0) | (channel_num & 0x07);
+
+	/*ADTS2:0 = 0 Free running trigger source*/
+	SFIOR &= 0x1F;
+
+	/*Auto trigger & interrupt enable , the first conversion is started by hand*/
+	ADCSRA |= (1<<ADATE) | (1<<ADIE) | (1<<ADSC);
+
+	/*Enable global interrupts*/
+	SET_BIT(SREG,7);
+}
+
+/* Description :
+ * Stop the free running conversions*/
+void ADC_stop(void)
+{
+	ADCSRA &= ~((1<<ADATE) | (1<<ADIE));
+}
+
+/* Description :
+ * Sent the address of the required function to be called with each
+ * free running result from higher/different abstraction level */
+void ADC_setCallBack(void(*a_ptr)(uint16))
+{
+	g_adcCallBackPtr = a_ptr;
+}
+
+/*******************************************************************************
+ *                                ISR Definitions 	                           *
+ *******************************************************************************/
+
+ISR(ADC_vect)
+{
+	DIAG_isrEnter(DIAG_ISR_ADC);
+
+	if(g_adcCallBackPtr != NULL_PTR)
+	{
+		/* Call the Call Back function in the application with the conversion result */
+		g_adcCallBackPtr(ADC);
+	}
+
+	DIAG_isrExit(DIAG_ISR_ADC);
+}
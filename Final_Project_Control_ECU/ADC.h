@@ -0,0 +1,73 @@
+/******************************************************************************
+ *
+ * Module: ADC
+ *
+ * File Name: ADC.h
+ *
+ * Description: Header file for the ATmega32 ADC driver
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef ADC_H_
+#define ADC_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define ADC_MAXIMUM_VALUE    1023
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef enum {
+	AREF,AVCC,INTERNAL_2_56 = 3
+}ADC_ReferenceVoltage;
+
+typedef enum {
+	ADC_FCPU_2 = 1,ADC_FCPU_4,ADC_FCPU_8,ADC_FCPU_16,ADC_FCPU_32,ADC_FCPU_64,ADC_FCPU_128
+}ADC_Prescaler;
+
+typedef struct {
+	ADC_ReferenceVoltage ref_volt;
+	ADC_Prescaler prescaler;
+}ADC_ConfigType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Initialize the ADC with required reference & clock from Config_Ptr*/
+void ADC_init(const ADC_ConfigType * Config_Ptr);
+
+/* Description :
+ * Convert the given channel once by polling and return the result*/
+uint16 ADC_readChannel(uint8 channel_num);
+
+/* Description :
+ * Convert the given channel continuously (free running mode) ,
+ * every result is passed to the call back from the ADC ISR*/
+void ADC_startFreeRunning(uint8 channel_num);
+
+/* Description :
+ * Stop the free running conversions*/
+void ADC_stop(void);
+
+/* Description :
+ * Sent the address of the required function to be called with each
+ * free running result from higher/different abstraction level */
+void ADC_setCallBack(void(*a_ptr)(uint16));
+
+#endif /* ADC_H_ */
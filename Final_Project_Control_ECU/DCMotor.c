@@ -1,81 +1,241 @@
-/******************************************************************************
- *
- * Module: DCMotor driver source file
- *
- * File Name: DCMotor.c
- *
- * Description: Source file for the DCMotor driver
- *
- * Created on: Feb 20, 2024
- *
- * Author: Karim Amr
- *
-******************************************************************************/
-
-
-/*******************************************************************************
- *                            Required Libraries                               *
- *******************************************************************************/
-
-
-#include "DCMotor.h"
-#include "gpio.h"
-#include "PWM.h"
-#include "std_types.h"
-
-/*******************************************************************************
-*							  Functions Definitions 	    				   *
-********************************************************************************/
-
-/* Description :
- * Initialize the DC MOTOR by
- * setting required pins to output
- * and set its initial state to : STOP*/
-void DcMotor_init(void)
-{
-	/*set both pins to output */
-	GPIO_setupPinDirection(DC_MOTOR_PORT1,DC_MOTOR_PIN1,PIN_OUTPUT);
-	GPIO_setupPinDirection(DC_MOTOR_PORT2,DC_MOTOR_PIN2,PIN_OUTPUT);
-
-	/*Set the motor to STOP position*/
-	GPIO_writePin(DC_MOTOR_PORT1,DC_MOTOR_PIN1,LOGIC_LOW);
-	GPIO_writePin(DC_MOTOR_PORT2,DC_MOTOR_PIN2,LOGIC_LOW);
-
-	/*Set initial speed to ZERO using PWM driver */
-	PWM_Timer0_Start(MOTOR_STOP);
-}
-
-/* Description :
- * set both motor speed and direction by the given function arguments
- * State : STOP OR CW OR ACW*/
-void DcMotor_Rotate(DcMotor_State state)
-{
-	switch(state)
-	{
-	case STOP:
-		/*Set Direction*/
-		GPIO_writePin(DC_MOTOR_PORT1,DC_MOTOR_PIN1,LOGIC_LOW);
-		GPIO_writePin(DC_MOTOR_PORT2,DC_MOTOR_PIN2,LOGIC_LOW);
-
-		/*Set speed */
-		PWM_Timer0_Start(MOTOR_STOP); /*OR ZERo ?*/
-		break;
-	case ACW :
-		/*Set Direction*/
-		GPIO_writePin(DC_MOTOR_PORT1,DC_MOTOR_PIN1,LOGIC_LOW);
-		GPIO_writePin(DC_MOTOR_PORT2,DC_MOTOR_PIN2,LOGIC_HIGH);
-
-		/*Set speed */
-		PWM_Timer0_Start(MOTOR_RUN);
-		break;
-	case CW:
-		/*Set Direction*/
-		GPIO_writePin(DC_MOTOR_PORT1,DC_MOTOR_PIN1,LOGIC_HIGH);
-		GPIO_writePin(DC_MOTOR_PORT2,DC_MOTOR_PIN2,LOGIC_LOW);
-
-		/*Set speed */
-		PWM_Timer0_Start(MOTOR_RUN);
-		break;
-	}
-}
-
+/******************************************************************************
+ *
+ * Module: DCMotor driver source file
+ *
+ * File Name: DCMotor.c
+ *
+ * Description: Source file for the DCMotor driver
+ *
+ * Created on: Feb 20, 2024
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+
+#include "DCMotor.h"
+#include "gpio.h"
+#include "PWM.h"
+#include "std_types.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static const PWM_ConfigType s_pwmConfig = {PWM_TIMER0,PWM_FAST,DC_MOTOR_PWM_FREQUENCY};
+
+static const DcMotor_ProfileType s_defaultProfile =
+	{DC_MOTOR_CRUISE_DUTY,DC_MOTOR_ACCEL_TIME,DC_MOTOR_DECEL_TIME,S_CURVE};
+
+static const DcMotor_ProfileType * s_profile = &s_defaultProfile;
+
+/*Requested motion (written by DcMotor_Move) & actual direction*/
+static volatile DcMotor_State s_targetState = STOP;
+static DcMotor_State s_state = STOP;
+
+/*Current ramp : duty goes from s_rampFrom to s_rampTo in s_rampLength updates*/
+static uint8 s_duty = MOTOR_STOP;
+static uint8 s_rampFrom = MOTOR_STOP;
+static uint8 s_rampTo = MOTOR_STOP;
+static uint16 s_rampStep = 0;
+static uint16 s_rampLength = 0;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void DcMotor_setDirection(DcMotor_State state);
+static void DcMotor_startRamp(uint8 duty , uint16 fullTime);
+
+/*******************************************************************************
+*							  Functions Definitions 	    				   *
+********************************************************************************/
+
+/* Description :
+ * Initialize the DC MOTOR by
+ * setting required pins to output
+ * and set its initial state to : STOP*/
+void DcMotor_init(void)
+{
+	/*set both pins to output */
+	GPIO_setupPinDirection(DC_MOTOR_PORT1,DC_MOTOR_PIN1,PIN_OUTPUT);
+	GPIO_setupPinDirection(DC_MOTOR_PORT2,DC_MOTOR_PIN2,PIN_OUTPUT);
+
+	/*Set the motor to STOP position*/
+	GPIO_writePin(DC_MOTOR_PORT1,DC_MOTOR_PIN1,LOGIC_LOW);
+	GPIO_writePin(DC_MOTOR_PORT2,DC_MOTOR_PIN2,LOGIC_LOW);
+
+	/*Start the PWM driver with initial speed ZERO*/
+	PWM_init(&s_pwmConfig);
+
+	s_state = STOP;
+	s_targetState = STOP;
+	s_duty = MOTOR_STOP;
+	s_rampTo = MOTOR_STOP;
+	s_rampStep = s_rampLength = 0;
+}
+
+/* Description :
+ * set both motor speed and direction by the given function arguments
+ * State : STOP OR CW OR ACW*/
+void DcMotor_Rotate(DcMotor_State state)
+{
+	switch(state)
+	{
+	case STOP:
+		/*Set Direction*/
+		GPIO_writePin(DC_MOTOR_PORT1,DC_MOTOR_PIN1,LOGIC_LOW);
+		GPIO_writePin(DC_MOTOR_PORT2,DC_MOTOR_PIN2,LOGIC_LOW);
+
+		/*Set speed */
+		PWM_setDuty(MOTOR_STOP);
+		break;
+	case ACW :
+		/*Set Direction*/
+		GPIO_writePin(DC_MOTOR_PORT1,DC_MOTOR_PIN1,LOGIC_LOW);
+		GPIO_writePin(DC_MOTOR_PORT2,DC_MOTOR_PIN2,LOGIC_HIGH);
+
+		/*Set speed */
+		PWM_setDuty(MOTOR_RUN);
+		break;
+	case CW:
+		/*Set Direction*/
+		GPIO_writePin(DC_MOTOR_PORT1,DC_MOTOR_PIN1,LOGIC_HIGH);
+		GPIO_writePin(DC_MOTOR_PORT2,DC_MOTOR_PIN2,LOGIC_LOW);
+
+		/*Set speed */
+		PWM_setDuty(MOTOR_RUN);
+		break;
+	}
+
+	/*Keep the ramp engine in line with the immediate change*/
+	s_state = s_targetState = state;
+	s_duty = s_rampTo = (STOP == state) ? MOTOR_STOP : MOTOR_RUN;
+	s_rampStep = s_rampLength = 0;
+}
+
+/* Description :
+ * Change the motion profile used by DcMotor_Move
+ * (takes effect from the next ramp)*/
+void DcMotor_setProfile(const DcMotor_ProfileType * profile)
+{
+	s_profile = (NULL_PTR == profile) ? &s_defaultProfile : profile;
+}
+
+/* Description :
+ * Request a ramped motion , the ramp itself is run by DcMotor_update*/
+void DcMotor_Move(DcMotor_State state)
+{
+	s_targetState = state;
+}
+
+/* Description :
+ * Advance the ramp by one step :
+ * - moving the wrong way (or asked to stop) : ramp down to zero then release the bridge
+ * - stopped with a motion requested : set the direction then ramp up to the cruise duty
+ * The duty follows a straight line (trapezoidal profile) or a smooth step
+ * 3x^2 - 2x^3 (S-curve profile) that starts & ends the ramp without a jerk*/
+void DcMotor_update(void)
+{
+	DcMotor_State target = s_targetState;
+	uint16 x ;
+	uint16 x2 ;
+	uint16 shape ;
+
+	if(target != s_state)
+	{
+		if(STOP != s_state)
+		{
+			if(MOTOR_STOP != s_rampTo)
+			{
+				DcMotor_startRamp(MOTOR_STOP,s_profile->decelTime);
+			}
+		}
+		else
+		{
+			DcMotor_setDirection(target);
+			s_state = target;
+			DcMotor_startRamp(s_profile->cruiseDuty,s_profile->accelTime);
+		}
+	}
+
+	if(s_rampStep < s_rampLength)
+	{
+		s_rampStep++;
+
+		/*Ramp position 0..255*/
+		x = (uint16)(((uint32)s_rampStep * 255) / s_rampLength);
+
+		if(S_CURVE == s_profile->shape)
+		{
+			x2 = (x * x) >> 8;
+			shape = (uint16)((3 * (uint32)x2) - ((2 * (uint32)x2 * x) >> 8));
+		}
+		else
+		{
+			shape = x;
+		}
+
+		s_duty = (uint8)((sint16)s_rampFrom +
+				(((sint16)s_rampTo - (sint16)s_rampFrom) * (sint16)shape) / 255);
+
+		if(s_rampStep == s_rampLength)
+		{
+			/*Land exactly on the target whatever the rounding*/
+			s_duty = s_rampTo;
+		}
+
+		PWM_setDuty(s_duty);
+
+		/*Ramped down to zero , release the bridge*/
+		if(MOTOR_STOP == s_duty && s_rampStep == s_rampLength && STOP != s_state)
+		{
+			DcMotor_setDirection(STOP);
+			s_state = STOP;
+		}
+	}
+}
+
+/* Description :
+ * Returns TRUE when the requested motion is reached*/
+boolean DcMotor_isSettled(void)
+{
+	return (s_targetState == s_state && s_rampStep == s_rampLength) ? TRUE : FALSE;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Set the H-bridge inputs for the given direction*/
+static void DcMotor_setDirection(DcMotor_State state)
+{
+	GPIO_writePin(DC_MOTOR_PORT1,DC_MOTOR_PIN1,(CW == state) ? LOGIC_HIGH : LOGIC_LOW);
+	GPIO_writePin(DC_MOTOR_PORT2,DC_MOTOR_PIN2,(ACW == state) ? LOGIC_HIGH : LOGIC_LOW);
+}
+
+/* Description :
+ * Start a ramp from the current duty to the given one , the time
+ * is scaled by the distance so a short ramp doesn't take the full time*/
+static void DcMotor_startRamp(uint8 duty , uint16 fullTime)
+{
+	uint8 distance = (duty > s_duty) ? (duty - s_duty) : (s_duty - duty);
+
+	s_rampFrom = s_duty;
+	s_rampTo = duty;
+	s_rampStep = 0;
+	s_rampLength = (uint16)(((uint32)fullTime * distance) / ((uint32)MOTOR_RUN * DC_MOTOR_RAMP_PERIOD));
+
+	if(0 == s_rampLength)
+	{
+		/*At least one step so the duty is always written*/
+		s_rampLength = 1;
+	}
+}
+
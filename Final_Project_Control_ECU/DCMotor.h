@@ -1,57 +1,96 @@
-/******************************************************************************
- *
- * Module: DCMotor driver header file
- *
- * File Name: DCMotor.h
- *
- * Description: Header file for the DCMotor driver
- *
- * Created on: Feb 20, 2024
- *
- * Author: Karim Amr
- *
-******************************************************************************/
-
-#ifndef DCMOTOR_H_
-#define DCMOTOR_H_
-
-/*******************************************************************************
- *                            Required Libraries                               *
- *******************************************************************************/
-
-
-#include "std_types.h"
-
-/*****************************************************************/
-/*							   Definitions				      	 */
-/*****************************************************************/
-
-/*Select the Motor Driver input pins & ports*/
-#define DC_MOTOR_PORT1  PORTB_ID
-#define DC_MOTOR_PIN1	PIN2_ID
-
-#define DC_MOTOR_PORT2  PORTB_ID
-#define DC_MOTOR_PIN2	PIN1_ID
-
-#define MOTOR_STOP		0   /*Duty Cycle = 0   */
-#define MOTOR_RUN		100 /*Duty Cycle = 1000*/
-
-typedef enum {
-	STOP,CW,ACW
-}DcMotor_State;
-
-/***************************************************************/
-/*					Functions Prototypes					   */
-/***************************************************************/
-
-/*Initialize the DC MOTOR*/
-void DcMotor_init(void);
-
-/*Controls the motors speed and direction according to the given arguments */
-void DcMotor_Rotate(DcMotor_State state);
-
-/***************************************************************/
-
-
-
-#endif /* DCMOTOR_H_ */
+/******************************************************************************
+ *
+ * Module: DCMotor driver header file
+ *
+ * File Name: DCMotor.h
+ *
+ * Description: Header file for the DCMotor driver
+ *
+ * Created on: Feb 20, 2024
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef DCMOTOR_H_
+#define DCMOTOR_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+
+#include "std_types.h"
+
+/*****************************************************************/
+/*							   Definitions				      	 */
+/*****************************************************************/
+
+/*Select the Motor Driver input pins & ports*/
+#define DC_MOTOR_PORT1  PORTB_ID
+#define DC_MOTOR_PIN1	PIN2_ID
+
+#define DC_MOTOR_PORT2  PORTB_ID
+#define DC_MOTOR_PIN2	PIN1_ID
+
+#define MOTOR_STOP		0   /*Duty Cycle = 0   */
+#define MOTOR_RUN		100 /*Duty Cycle = 1000*/
+
+/*PWM frequency of the EN pin : Fast PWM F_CPU/8/256 = 3.9 kHz*/
+#define DC_MOTOR_PWM_FREQUENCY		4000
+
+/*Period of DcMotor_update() calls in ms (one system tick)*/
+#define DC_MOTOR_RAMP_PERIOD		10
+
+/*Default motion profile*/
+#define DC_MOTOR_CRUISE_DUTY		80   /*%*/
+#define DC_MOTOR_ACCEL_TIME			1000 /*ms from stop to cruise duty*/
+#define DC_MOTOR_DECEL_TIME			500  /*ms from cruise duty to stop*/
+
+typedef enum {
+	STOP,CW,ACW
+}DcMotor_State;
+
+typedef enum {
+	TRAPEZOIDAL,S_CURVE
+}DcMotor_RampShape;
+
+/*Motion profile : duty ramps up to the cruise duty then down to stop
+ * Ramp times are for the full range , shorter ramps take less time*/
+typedef struct {
+	uint8 cruiseDuty;		/*%*/
+	uint16 accelTime;		/*ms*/
+	uint16 decelTime;		/*ms*/
+	DcMotor_RampShape shape;
+}DcMotor_ProfileType;
+
+/***************************************************************/
+/*					Functions Prototypes					   */
+/***************************************************************/
+
+/*Initialize the DC MOTOR*/
+void DcMotor_init(void);
+
+/*Controls the motors speed and direction according to the given arguments */
+void DcMotor_Rotate(DcMotor_State state);
+
+/*Change the motion profile used by DcMotor_Move (NULL_PTR = default profile)*/
+void DcMotor_setProfile(const DcMotor_ProfileType * profile);
+
+/*Request a ramped motion , returns immediately & the ramp is run by DcMotor_update
+ * A direction change ramps down to stop before ramping up the other way*/
+void DcMotor_Move(DcMotor_State state);
+
+/*Advance the ramp , must be called every DC_MOTOR_RAMP_PERIOD ms
+ * from a timer ISR (DcMotor_Move may be called from the same ISR or
+ * from the main loop , the request is a single byte)*/
+void DcMotor_update(void);
+
+/*Returns TRUE when the requested motion is reached (cruise duty or stopped)*/
+boolean DcMotor_isSettled(void);
+
+/***************************************************************/
+
+
+
+#endif /* DCMOTOR_H_ */
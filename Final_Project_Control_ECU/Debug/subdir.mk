@@ -4,37 +4,88 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../ADC.c \
 ../BUZZER.c \
 ../DCMotor.c \
 ../Final_Project_Control_ECU.c \
 ../PWM.c \
 ../TIMER1.c \
 ../USART.c \
+../audit_log.c \
+../bench.c \
+../bench_drivers.c \
+../crc16.c \
+../current_sense.c \
+../deferred_work.c \
+../diagnostics.c \
+../door_position.c \
+../door_sequence.c \
 ../external_eeprom.c \
 ../gpio.c \
-../twi.c 
+../lockout.c \
+../rtc.c \
+../stack_monitor.c \
+../timer_service.c \
+../twi.c \
+../twi_devices.c \
+../user_table.c \
+../watchdog.c 
 
 OBJS += \
+./ADC.o \
 ./BUZZER.o \
 ./DCMotor.o \
 ./Final_Project_Control_ECU.o \
 ./PWM.o \
 ./TIMER1.o \
 ./USART.o \
+./audit_log.o \
+./bench.o \
+./bench_drivers.o \
+./crc16.o \
+./current_sense.o \
+./deferred_work.o \
+./diagnostics.o \
+./door_position.o \
+./door_sequence.o \
 ./external_eeprom.o \
 ./gpio.o \
-./twi.o 
+./lockout.o \
+./rtc.o \
+./stack_monitor.o \
+./timer_service.o \
+./twi.o \
+./twi_devices.o \
+./user_table.o \
+./watchdog.o 
 
 C_DEPS += \
+./ADC.d \
 ./BUZZER.d \
 ./DCMotor.d \
 ./Final_Project_Control_ECU.d \
 ./PWM.d \
 ./TIMER1.d \
 ./USART.d \
+./audit_log.d \
+./bench.d \
+./bench_drivers.d \
+./crc16.d \
+./current_sense.d \
+./deferred_work.d \
+./diagnostics.d \
+./door_position.d \
+./door_sequence.d \
 ./external_eeprom.d \
 ./gpio.d \
-./twi.d 
+./lockout.d \
+./rtc.d \
+./stack_monitor.d \
+./timer_service.d \
+./twi.d \
+./twi_devices.d \
+./user_table.d \
+./watchdog.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -1,424 +1,1338 @@
-/******************************************************************************
- *
- * Project: Door Locker Security System (Standard Embedded Diploma Final Project )
- *
- * File Name: Final_Project_Control_ECU.c
- *
- * Created on: Mar 14, 2024
- *
- * Author: Karim Amr
- *
- * Group = 84
- *
- * Description: System that controls Locking/Unlocking door motor using
- * 				password to be set by user
- *
- * 				This is the Control module that controls the system hardware
- * 				such as EEPROM , Motor , Buzzer .
- *
- * 				This code was able to achieve a maximum on only 52% CPU load in Proteus !
- *
-******************************************************************************/
-
-
-/*******************************************************************************
- *                            Required Libraries                               *
- *******************************************************************************/
-
-#include "BUZZER.h"
-#include "external_eeprom.h"
-#include "DCMotor.h"
-#include "USART.h"
-#include "twi.h"
-#include "TIMER1.h"
-#include <util/delay.h> /*To use simple delay functions*/
-
-/********************************************************************************
- *                                 Definitions     	 	                        *
- ********************************************************************************/
-
-/*Length of the Password*/
-#define PASSWORD_LENGTH 5
-
-/*Motor operation time in Seconds*/
-#define MOTOR_START_TIME 			0
-#define MOTOR_UNLOCKING_TIME 		15
-#define MOTOR_STOP_TIME  			3
-#define MOTOR_STOPPING_TIME 		(MOTOR_UNLOCKING_TIME+MOTOR_STOP_TIME)
-#define MOTOR_LOCK_TIME   			15
-#define MOTOR_LOCKING_TIME			(MOTOR_UNLOCKING_TIME+MOTOR_STOP_TIME+MOTOR_LOCK_TIME)
-
-
-#define PASSWORD_ADDRESS 0x0100 /*EEPROM password memory address*/
-
-#define LOCK_DURATION 60000 /*60 Seconds*/
-
-/*From Enum Application State in HMI ECU*/
-#define UNMATCHED_PASSWORD  1
-#define MAIN_MENU			0
-
-/*-----------------------------------------------------------------------------*/
-
-typedef enum
-{
-	EmptyPW , IncorrectPW , CorrectPW
-}Password_Results;
-
-typedef enum
-{
-	Loop , SetPW , EnterPW , OpenningDoor , LockedMode , EmptyLoop
-}UART_commands;
-
-/********************************************************************************
- *                              Global Variables	                            *
- ********************************************************************************/
-
-UART_commands UART_nextState ;
-
-/********************************************************************************
- *                              Function Prototypes	                            *
- ********************************************************************************/
-
-/*Description:
- * Get the two password entries from HMI ECU for matching
- * and to set it in EEPROM if they match */
-void setPassword();
-
-/*Description:
- * Compare each digit of the two password entries arrays
- * if they match , will return feedback to save it inside EEPROM
- * OR if the mismatch , will return feedback to try again */
-uint8 passwordMatching(const uint8 * a_firstEntry , const uint8 * a_secondEntry);
-
-/*Description:
- * Receive password from HMI ECU to compare it with set password in EEPROM
- * in order to proceed forward with the desired operation */
-void passwordEntry(void);
-
-/*Description:
- * Compares the received password with the one set inside
- * the EEPROM and return with the relevant matching result*/
-uint8 passwordEntryMatching(const uint8 * pwBuffer);
-
-/*Description:
- * I it starts  Timer 1 and send feedback to HMI ECU ,
- * then it starts unlocking , stopping & locking the door by moving the motor
- * in the desired direction and duration */
-void doorAction(void);
-
-/*Description:
- * Activate Locked mode on the whole system & activates the buzzer for the
- * required amount of time and returns back to normal operation
- *  ( sent back to Loop) */
-void lockedMode(void);
-
-/********************************************************************************
- *                              Application Code	                            *
- ********************************************************************************/
-
-
-
-int main()
-{
- /************************ Configuration Structure *********************/
-
-   /***************** UART Settings ****************
-	*  Data Bit Mode 		= 8 Bits
-	*  Parity Check 		= Even Parity
-	*  Number of Stop Bits  = One
-	*  Baud Rate			= 9600
-	*************************************************/
-	UART_ConfigType s_UARTconfig = {EightBit,EvenParity,OneStopBit,9600};
-
-   /***************** Timer 1 Settings ****************
-	*  Initial Value 	= 0
-	*  Compare Value 	= 7813 ( every one second )
-	*  Pre-Scalar 		= F_CPU/1024
-	*  Timer1 Mode		= CTC (Compare Mode)
-	*************************************************/
-	Timer1_ConfigType s_Timer1Config = {0,7813,FCPU_1024,Compare};
-
-   /***************** TWI(I2) Settings ****************
-	*  Address  = 10
-	*  Bit Rate = 400 Kb/s
-	*************************************************/
-	TWI_ConfigType s_TWIconfig = {0b00001010,Fast_Mode};
-
-
-	/*********************************************************************/
-
-	/************************ Drivers Initializations *********************/
-
-	UART_init(&s_UARTconfig);
-
-	_delay_ms(10);  /*Allow time for transmission & initialization*/
-
-	TWI_init(&s_TWIconfig);
-
-	_delay_ms(10);  /*Allow time for transmission & initialization*/
-
-	DcMotor_init();
-
-	Buzzer_init();
-
-	/*Set the UART to state to ready until command (Byte) is received*/
-	UART_nextState = UART_recieveByte();
-
-	/***************************** Main Loop ****************************/
-
-	while(1)
-	{
-		/*Checks the required application function*/
-		switch(UART_nextState)
-		{
-
-		case Loop: /*Ready mode until command is received*/
-			UART_nextState = UART_recieveByte();
-			break;
-
-		case SetPW: /*Match & set password inside EEPROM*/
-			setPassword();
-			break;
-
-		case EnterPW: /*Compare the entered password with the one saved inside EEPROM*/
-			passwordEntry();
-			break;
-
-		case OpenningDoor: /*Start door opening operation */
-
-			/*Set the function to be called by TIMER 1 ISR*/
-			Timer1_setCallBack(&doorAction);
-
-			/*Initiate TIMER with the required configuration*/
-			Timer1_init(&s_Timer1Config);
-
-			/*Send feedback command to HMI ECU for time synchronization*/
-			UART_sendByte(UART_nextState);
-
-			/*Send the application to empty loop until the operation is complete*/
-			UART_nextState = EmptyLoop ;
-
-			/*To prevent the One second delay until the first Interrupt occurs*/
-
-			/*Requires that the counter if conditions to be incremented by an extra ONE
-			* for correct timing adjustment*/
-			 /*doorAction();*/
-
-			break;
-
-		case LockedMode :/*Enters the system into locked mode for predefined amount of time */
-
-			lockedMode();
-			break;
-
-		case EmptyLoop :
-			/*The target from the empty loop is to make the application
-			 * do the lowest possible tasks to reduce CPU load
-			 * until the Application status is updated
-			 * & to prevent confliction between tasks*/
-			break;
-		}
-	}
-}
-
-/********************************************************************************
- *                              Functions Definitions                           *
- ********************************************************************************/
-
-void setPassword()
-{
-	/*2 Local array of password size to receive the password digit in it*/
-	uint8 firstPasswordEntry[PASSWORD_LENGTH] = {0} ;
-	uint8 secondPasswordEntry[PASSWORD_LENGTH] = {0} ;
-
-	uint8 checkResults = 0;
-
-	uint8 passwordDigit ;
-
-	/*Receive first password Entry*/
-	UART_recieveData(firstPasswordEntry,PASSWORD_LENGTH);
-
-	_delay_ms(100); /*Allow time for transmission*/
-
-	/*Receive second password Entry*/
-	UART_recieveData(secondPasswordEntry,PASSWORD_LENGTH);
-
-	_delay_ms(100); /*Allow time for transmission*/
-
-	/*Return the results of the password matching inside checkResults */
-	checkResults = passwordMatching(firstPasswordEntry,secondPasswordEntry);
-
-
-	/*If password is unmatched , send the required command to HMI ECU to try again*/
-	if(1 == checkResults)
-	{
-		UART_sendByte(UNMATCHED_PASSWORD);
-	}
-	/*If password is matched , save the password inside EEPROM memory at the pre-defined location*/
-	else if (0 == checkResults)
-	{
-		for(passwordDigit = 0 ; passwordDigit < PASSWORD_LENGTH ; passwordDigit++)
-		{
-			EEPROM_writeByte((PASSWORD_ADDRESS)+passwordDigit,firstPasswordEntry[passwordDigit]);
-			_delay_ms(20); /*Allow transmition time*/
-		}
-		/*send the required command to HMI ECU to proceed to Main Menu*/
-		UART_sendByte(MAIN_MENU);
-	}
-	/*Set application status back to ready mode*/
-	UART_nextState = Loop;
-}
-
-uint8 passwordMatching(const uint8 * a_firstEntry , const uint8 * a_secondEntry)
-{
-	uint8 mismatchFlag = 0; /*Default value for no mismatch */
-
-	uint8 passwordDigit ;
-
-	/*Loop on the two password entries and check if there is any mismatch*/
-	for(passwordDigit = 0 ; passwordDigit < PASSWORD_LENGTH ; passwordDigit++)
-	{
-		if(a_firstEntry[passwordDigit] != a_secondEntry[passwordDigit])
-		{
-			/*If mismatch occur , return with the results & break the loop*/
-			mismatchFlag = 1;
-			break;
-		}
-	}
-	/*If no mismatch occurs , just return the default value*/
-	return mismatchFlag ;
-}
-
-void passwordEntry(void)
-{
-	uint8 checkResults = 0;
-
-	/*Local array of password size to receive the password digits in it*/
-	uint8 passwordBuffer[PASSWORD_LENGTH] = {0};
-
-	/*Receive the password Entry*/
-	UART_recieveData(passwordBuffer,PASSWORD_LENGTH);
-
-	_delay_ms(100); /*Allow time for transmission*/
-
-	/*Send the for password comparing with the one saved in EEPROM
-	 * & return the results*/
-	checkResults = passwordEntryMatching(passwordBuffer);
-
-	/*Send the relative command whether it's correct / incorrect*/
-	checkResults==1?UART_sendByte(IncorrectPW):UART_sendByte(CorrectPW);
-
-	/*Set application status back to ready mode*/
-	UART_nextState = Loop;
-}
-
-uint8 passwordEntryMatching(const uint8 * pwBuffer)
-{
-	uint8 mismatchFlag = 0; /*Default value for no mismatch */
-
-	uint8 passwordDigit ;
-
-	/*Local array of password size call in the saved password from EEPROM*/
-	uint8 savedPassword[PASSWORD_LENGTH] = {0};
-
-	for(passwordDigit = 0 ; passwordDigit < PASSWORD_LENGTH ; passwordDigit++)
-	{
-		/*Read the saved password digits from EEPROM pre-define location
-		 * set it inside the local array*/
-		EEPROM_readByte((PASSWORD_ADDRESS)+passwordDigit,&savedPassword[passwordDigit]);
-		_delay_ms(20); /*Allow transmition time*/
-
-		/*Loop on the password entry and check if there is any mismatch
-		 * with the saved password in EEPROM*/
-		if(pwBuffer[passwordDigit] != savedPassword[passwordDigit])
-		{
-			/*If mismatch occur , return with the results & break the loop*/
-			mismatchFlag = 1;
-			break;
-		}
-	}
-	/*If no mismatch occurs , just return the default value*/
-	return mismatchFlag ;
-}
-
-void doorAction(void)
-{
-	/*Set the counter to static to increase lifetime through out
-	 * the run time & set to volatile to disable compiler
-	 * optimization on the variable*/
-	static volatile uint8 doorTimerCounter = MOTOR_START_TIME;
-
-	/*Timer counter value is within unlocking mode*/
-	if(doorTimerCounter < MOTOR_UNLOCKING_TIME)
-	{
-		/*Instead of setting DC_Motor state at each loop
-		 * in which it sets the PWM settings and state
-		 * every single time , just set at the first of
-		 * each state to save CPU Load & context switching*/
-		if(MOTOR_START_TIME == doorTimerCounter)
-
-		/*Rotate Motor Clockwise at full speed*/
-		DcMotor_Rotate(CW);
-		/*Increment timer by one , which means one second has passed */
-		doorTimerCounter++;
-	}
-
-	/*Timer counter value is within stop mode*/
-	else if (doorTimerCounter >=MOTOR_UNLOCKING_TIME && doorTimerCounter  <MOTOR_STOPPING_TIME)
-	{
-		if(MOTOR_UNLOCKING_TIME == doorTimerCounter)
-		/*Stop the motor rotation*/
-		DcMotor_Rotate(STOP);
-		/*Increment timer by one , which means one second has passed */
-		doorTimerCounter++;
-
-	}
-
-	/*Timer counter value is within locking mode*/
-	else if(doorTimerCounter >= MOTOR_STOPPING_TIME && doorTimerCounter  < MOTOR_LOCKING_TIME)
-	{
-		if(MOTOR_STOPPING_TIME == doorTimerCounter)
-		DcMotor_Rotate(ACW);
-		/*Increment timer by one , which means one second has passed */
-		doorTimerCounter++;
-	}
-
-	/*IF Timer counter reached the last required time , Stop DC motor ,
-	* Stop / DeInit. TIMER 1 , reset counter & set back application to ready mode*/
-	else if(doorTimerCounter == MOTOR_LOCKING_TIME)
-	{
-		DcMotor_Rotate(STOP);
-		Timer1_deInit();
-		doorTimerCounter=0;
-		UART_nextState = Loop ;
-	}
-}
-
-void lockedMode(void)
-{
-	uint8 LockTimer ;
-
-
-	/*Loop on the following function for predefined duration
-	 * to Lock the system functions & operations */
-	for(LockTimer=0 ; LockTimer<(LOCK_DURATION/500) ; LockTimer++) /*60000/500 = 120*/
-	 {
-		/*Creates a Beeping Sound :D*/
-		///////*Alternative method = using Timer 2 PWM wave generation method*//////
-		Buzzer_on();
-
-		_delay_ms(250);
-
-		Buzzer_off();
-
-		_delay_ms(250);
-	 }
-
-	/*Set application back to ready mode*/
-	UART_nextState=Loop;
-
-	/*Sends feedback to HMI ECU that the locked mode has been exited*/
-	UART_sendByte(UART_nextState);
-}
-
-/**********************************************************************/
+/******************************************************************************
+ *
+ * Project: Door Locker Security System (Standard Embedded Diploma Final Project )
+ *
+ * File Name: Final_Project_Control_ECU.c
+ *
+ * Created on: Mar 14, 2024
+ *
+ * Author: Karim Amr
+ *
+ * Group = 84
+ *
+ * Description: System that controls Locking/Unlocking door motor using
+ * 				password to be set by user
+ *
+ * 				This is the Control module that controls the system hardware
+ * 				such as EEPROM , Motor , Buzzer .
+ *
+ * 				This code was able to achieve a maximum on only 52% CPU load in Proteus !
+ *
+******************************************************************************/
+
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "BUZZER.h"
+#include "external_eeprom.h"
+#include "DCMotor.h"
+#include "USART.h"
+#include "twi.h"
+#include "timer_service.h"
+#include "user_table.h"
+#include "audit_log.h"
+#include "crc16.h"
+#include "lockout.h"
+#include "door_sequence.h"
+#include "current_sense.h"
+#include "door_position.h"
+#include "diagnostics.h"
+#include "deferred_work.h"
+#include "watchdog.h"
+#include "rtc.h"
+#include "bench.h"
+#include <util/delay.h> /*To use simple delay functions*/
+#include <avr/interrupt.h>
+#include <avr/sleep.h> /*Idle sleep of the empty loop*/
+#include <avr/wdt.h> /*Watchdog timeouts*/
+
+/********************************************************************************
+ *                                 Definitions     	 	                        *
+ ********************************************************************************/
+
+/*Length of the Password*/
+#define PASSWORD_LENGTH USERS_CODE_LENGTH
+
+/*Buzzer beeping period during the lockout (on / off time)*/
+#define BUZZER_BEEP_TIME 			250
+
+/*The data of a command follows it at once , a peer sending less
+ * than expected only costs this time (ms) instead of a hang*/
+#define UART_PAYLOAD_TIMEOUT		500
+
+/*The main loop checks in at least every MAIN_LOOP_DEADLINE (ms) ,
+ * the supervisor runs every WDG_SUPERVISE_PERIOD (ms) from the system tick*/
+#define MAIN_LOOP_DEADLINE			1000
+#define WDG_SUPERVISE_PERIOD		100
+
+/*The RAM copy of the time is read again from the RTC every hour (s)*/
+#define RTC_SYNC_PERIOD				3600
+
+/*From Enum Application State in HMI ECU*/
+#define UNMATCHED_PASSWORD  1
+#define MAIN_MENU			0
+
+/*Audit log export frame :
+ * START | first record index | payload length | payload | CRC16 (MSB first)
+ * CRC covers the index , the length & the payload
+ * A frame with zero payload length ends the export , an ERROR frame
+ * (zero payload , index of the record that couldn't be read) ends it
+ * at an EEPROM read error*/
+#define EXPORT_FRAME_START		0xA5
+#define EXPORT_FRAME_ERROR		0xE5
+#define EXPORT_CHUNK_RECORDS	8
+
+/*Diagnostics frame : START | payload length | DIAG_ReportType | WORK_StatsType | CRC16 (MSB first)
+ * CRC covers the length & the payload*/
+#define DIAGNOSTICS_FRAME_START	0x5A
+
+/*Door event frame pushed to HMI ECU every second of the door sequence :
+ * DoorPhase / DoorProgress / DoorDone / DoorFault | phase index | seconds inside the phase*/
+#define DOOR_EVENT_SIZE			3
+
+/*-----------------------------------------------------------------------------*/
+
+typedef enum
+{
+	EmptyPW , IncorrectPW , CorrectPW , LockedPW
+}Password_Results;
+
+typedef enum
+{
+	Loop , SetPW , EnterPW , OpenningDoor , LockedMode , SetupStatus ,
+	AddUser , RemoveUser , ReadLog , ExportLog , DoorPhase , DoorProgress ,
+	DoorDone , DoorFault , Diagnostics , SetClock , SetUserAccess , EmptyLoop
+}UART_commands;
+
+/*Replies of the user management commands (same enum in HMI ECU)*/
+typedef enum
+{
+	UserDone , UserUnmatched , UserDenied , UserInvalidID , UserDuplicate ,
+	UserNotFound , UserStorageError
+}User_Results;
+
+/*State kept across a watchdog / external reset for the warm restart*/
+typedef struct
+{
+	AUDIT_StateType audit;	/*Position of the audit log , no scan needed*/
+	uint8 doorRunning;		/*HMI ECU waits for the events of a door sequence*/
+	uint8 lockNotified;		/*HMI ECU was told about the lockout & waits for its end*/
+}Warm_State;
+
+/********************************************************************************
+ *                              Global Variables	                            *
+ ********************************************************************************/
+
+UART_commands UART_nextState ;
+
+/*User authenticated by the last password entry , consumed by the
+ * next privileged command (door opening , password / user changes)*/
+uint8 g_sessionUser = USERS_NO_USER ;
+
+/*Software timer running the door sequence*/
+TIMERS_IdType g_doorTimer = TIMERS_INVALID_ID ;
+
+/*Door phase table being run (timing shared with HMI ECU through door_sequence.c)*/
+DOOR_RunnerType g_door ;
+
+/*Door event prepared by the door timer ISR , sent by the main loop*/
+uint8 g_doorEvent[DOOR_EVENT_SIZE] ;
+
+/*Last motor current event of the running phase , handled by the next door step*/
+volatile CURRENT_EventType g_currentEvent = CURRENT_NO_EVENT ;
+
+/*Set when the bolt reached the end of the running phase , handled by the next door step*/
+volatile boolean g_positionReached = FALSE ;
+
+/*Software timer beeping the buzzer during the lockout*/
+TIMERS_IdType g_buzzerTimer = TIMERS_INVALID_ID ;
+
+/*Main loop supervised by the watchdog*/
+WDG_TaskIdType g_mainTask = WDG_NO_TASK ;
+
+/*Saved into .noinit RAM every time it changes*/
+Warm_State g_warmState ;
+
+/********************************************************************************
+ *                              Function Prototypes	                            *
+ ********************************************************************************/
+
+/*Description:
+ * Get the two password entries from HMI ECU for matching
+ * and to set it in EEPROM if they match
+ * (Admin password at first setup , otherwise the code of the logged in user) */
+void setPassword();
+
+/*Description:
+ * Compare each digit of the two password entries arrays
+ * if they match , will return feedback to save it inside EEPROM
+ * OR if the mismatch , will return feedback to try again */
+uint8 passwordMatching(const uint8 * a_firstEntry , const uint8 * a_secondEntry);
+
+/*Description:
+ * Receive password from HMI ECU to compare it with set password in EEPROM
+ * in order to proceed forward with the desired operation */
+void passwordEntry(void);
+
+/*Description:
+ * Receive a user ID and its code twice from HMI ECU and
+ * add it to the user table if the logged in user is an admin */
+void addUser(void);
+
+/*Description:
+ * Receive a user ID from HMI ECU and remove it from
+ * the user table if the logged in user is an admin */
+void removeUser(void);
+
+/*Description:
+ * Convert the user table status to the reply sent to HMI ECU */
+User_Results usersStatusToResult(USERS_Status a_status);
+
+/*Description:
+ * Receive the first record index & number of records then send back
+ * the number of records available followed by the records themselves */
+void readLog(void);
+
+/*Description:
+ * Receive the index of the first record to export (0 = oldest , or the
+ * index following the last good frame to resume) then stream the log
+ * as CRC protected frames through the interrupt driven UART transmitter */
+void exportLog(void);
+
+/*Description:
+ * Receive whether the measures restart after the report then send the CPU load ,
+ * ISR timing & deferred work measures as one CRC protected frame */
+void sendDiagnostics(void);
+
+/*Description:
+ * Receive the time (4 bytes , seconds since 1970 , LSB first) and set
+ * the RTC if the logged in user is an admin */
+void setClock(void);
+
+/*Description:
+ * Receive a user ID , its access limits , its validity window (2 * 4 bytes
+ * LSB first) & its weekly schedule then set them if the logged in user is an admin */
+void setUserAccess(void);
+
+/*Description:
+ * Return the RTC time for the validity windows of the user codes
+ * ( USERS_TIME_UNKNOWN while the RTC isn't set ) */
+uint32 currentTime(void);
+
+/*Description:
+ * Append an event to the audit log stamped with the RTC time
+ * ( seconds since boot while the RTC isn't set ) */
+void logEvent(AUDIT_EventType a_event , uint8 a_userId);
+
+/*Description:
+ * Keep the warm restart state in .noinit RAM */
+void saveWarmState(void);
+
+/*Description:
+ * Called every second , runs the door phase table moving the motor
+ * in the direction of each phase when it is entered
+ * & prepares the matching event for HMI ECU */
+void doorAction(void);
+
+/*Description:
+ * Called from the ADC ISR when the motor current shows an end-stop or a stall ,
+ * stops the motor at once & leaves the phase decision to the next door step */
+void motorCurrentEvent(CURRENT_EventType a_event);
+
+/*Description:
+ * Called from the position update (timer ISR) when the bolt reached the end
+ * of its movement , stops the motor at once & the next door step ends the phase */
+void positionReached(void);
+
+/*Description:
+ * Prepare a door event & post its sending to the main loop ,
+ * the UART isn't used inside the timer ISR */
+void queueDoorEvent(UART_commands a_event);
+
+/*Description:
+ * Deferred work : send the door event to HMI ECU ,
+ * back to ready mode after the last one */
+void sendDoorEvent(void);
+
+/*Description:
+ * Activate Locked mode on the whole system & starts beeping the buzzer ,
+ * the system keeps answering HMI ECU (every password is refused)
+ * until the lockout time has passed */
+void lockedMode(void);
+
+/*Description:
+ * Toggle the buzzer , called by the beeping software timer */
+void buzzerBeep(void);
+
+/*Description:
+ * Called every second by one software timer for all the one second
+ * services : CPU load sample , RTC time & lockout count down */
+void secondTick(void);
+
+/*Description:
+ * Save the lockout progress & end the locked mode when the time has passed
+ * ( sends Loop to HMI ECU if it is waiting for it) */
+void lockoutService(void);
+
+/********************************************************************************
+ *                              Application Code	                            *
+ ********************************************************************************/
+
+
+
+int main()
+{
+ /************************ Configuration Structure *********************/
+
+   /***************** UART Settings ****************
+	*  Data Bit Mode 		= 8 Bits
+	*  Parity Check 		= Even Parity
+	*  Number of Stop Bits  = One
+	*  Baud Rate			= 9600
+	*************************************************/
+	UART_ConfigType s_UARTconfig = {EightBit,EvenParity,OneStopBit,9600};
+
+   /***************** TWI(I2) Settings ****************
+	*  Address  = 10
+	*  Bit Rate = 400 Kb/s requested , 222 Kb/s actual (TWBR = 10 at 8 MHz)
+	*************************************************/
+	TWI_ConfigType s_TWIconfig = {0b00001010,Fast_Mode};
+
+   /***************** External EEPROM ****************
+	*  Parts    = one 24C16 (2 KB) at 0x50 , more parts extend the address space
+	*  Bit Rate = 400 Kb/s requested
+	*************************************************/
+	EEPROM_ConfigType s_eepromConfig = {Fast_Mode,1,{{EEPROM_24C16,EEPROM_BASE_ADDRESS}}};
+
+   /***************** Lockout Policy ****************
+	*  Wrong passwords  = 3 inside the attempt window
+	*  User attempts    = 3 refused attempts of a known code
+	*  Attempt window   = 300 s (one attempt forgotten per quiet window)
+	*  Lockout          = 60 s doubled on every repeated lockout up to 3600 s
+	*  Cool-down        = 1800 s without a lockout steps the back-off down
+	*************************************************/
+	LOCKOUT_ConfigType s_lockoutConfig = {3,3,300,60,3600,1800};
+
+   /***************** Diagnostics ****************
+	*  Timer period  = one system tick in TIMER1 counts
+	*  Count time    = 8000 ns ( F_CPU/64 )
+	*  Load sample   = every second
+	*************************************************/
+	DIAG_ConfigType s_diagConfig = {TIMERS_COUNTS_PER_TICK,TIMERS_COUNT_NS,TIMERS_TICKS_PER_SECOND};
+
+   /***************** Watchdog ****************
+	*  Timeout          = 2 s without a kick resets the ECU
+	*  Supervise period = 100 ms
+	*************************************************/
+	WDG_ConfigType s_wdgConfig = {WDTO_2S,WDG_SUPERVISE_PERIOD};
+
+   /***************** Real Time Clock ****************
+	*  Chip        = DS1307 at 0x68 (100 Kb/s)
+	*  Sync period = the RAM copy is read again from the chip every hour
+	*************************************************/
+	RTC_ConfigType s_rtcConfig = {RTC_DS1307,RTC_ADDRESS,RTC_SYNC_PERIOD};
+
+
+	/*********************************************************************/
+
+	/************************ Drivers Initializations *********************/
+
+	UART_init(&s_UARTconfig);
+
+	_delay_ms(10);  /*Allow time for transmission & initialization*/
+
+	TWI_init(&s_TWIconfig);
+
+	_delay_ms(10);  /*Allow time for transmission & initialization*/
+
+	/*Map the EEPROM parts of the bus into one address space*/
+	EEPROM_init(&s_eepromConfig);
+
+#if DRIVER_BENCH
+	/*Benchmark build : measure the drivers , report on the UART & stop there*/
+	BENCH_runDrivers();
+	while(1){}
+#endif
+
+	DcMotor_init();
+
+	/*Motor current sensing for the end-stop & stall detection*/
+	CURRENT_init();
+	CURRENT_setCallBack(&motorCurrentEvent);
+
+	/*Bolt position from the encoder & limit switches*/
+	POSITION_init();
+	POSITION_setCallBack(&positionReached);
+
+	Buzzer_init();
+
+	/*Start the system tick (TIMER1 , 10 ms)*/
+	TIMERS_init();
+
+	/*Time the ISRs & the idle time on the system tick counter ,
+	 * the CPU load is sampled every second (secondTick)*/
+	DIAG_init(&s_diagConfig);
+
+	/*Load the time from the RTC , the RAM copy advances every second (secondTick)*/
+	RTC_init(&s_rtcConfig);
+
+	/*Run the motor duty ramps from the system tick*/
+	TIMERS_start(TIMERS_MS_TO_TICKS(DC_MOTOR_RAMP_PERIOD),TIMERS_PERIODIC,&DcMotor_update);
+
+	/*Debounce the limit switches & track the bolt from the system tick*/
+	TIMERS_start(TIMERS_MS_TO_TICKS(POSITION_UPDATE_PERIOD),TIMERS_PERIODIC,&POSITION_update);
+
+	/*Kick the watchdog from the system tick as long as the main loop checks in*/
+	WDG_init(&s_wdgConfig);
+	TIMERS_start(TIMERS_MS_TO_TICKS(WDG_SUPERVISE_PERIOD),TIMERS_PERIODIC,&WDG_supervise);
+	g_mainTask = WDG_register(MAIN_LOOP_DEADLINE);
+
+	/*Build the RAM index of the user table from EEPROM*/
+	USERS_init();
+
+	/*Warm restart : the position of the audit log is kept in RAM ,
+	 * otherwise find the newest record of the log*/
+	if(WDG_restoreState((uint8 *)&g_warmState,sizeof(Warm_State)))
+	{
+		AUDIT_restore(&g_warmState.audit);
+	}
+	else
+	{
+		g_warmState.doorRunning = FALSE;
+		g_warmState.lockNotified = FALSE;
+		AUDIT_init();
+	}
+
+	logEvent(AUDIT_BOOT,USERS_NO_USER);
+
+	if(WDG_RESET_WATCHDOG == WDG_getResetCause())
+	{
+		logEvent(AUDIT_WATCHDOG_RESET,WDG_getLastTask());
+	}
+
+	/*Restore the wrong passwords counter & lockout from EEPROM ,
+	 * a reset during a lockout doesn't end it*/
+	LOCKOUT_init(&s_lockoutConfig);
+
+	/*One software timer for the one second services , started once the
+	 * lockout is restored (the count down isn't changed under LOCKOUT_init)*/
+	TIMERS_start(TIMERS_TICKS_PER_SECOND,TIMERS_PERIODIC,&secondTick);
+
+	if(LOCKOUT_isLocked())
+	{
+		g_buzzerTimer = TIMERS_start(TIMERS_MS_TO_TICKS(BUZZER_BEEP_TIME),TIMERS_PERIODIC,&buzzerBeep);
+	}
+
+	/*The empty loop sleeps between interrupts , IDLE mode keeps
+	 * the timers , ADC & UART running*/
+	set_sleep_mode(SLEEP_MODE_IDLE);
+
+	/*Set the UART to state to ready until command (Byte) is received*/
+	UART_nextState = Loop;
+
+	/*The reset cut a door sequence , end it on HMI ECU that waits for its events*/
+	if(g_warmState.doorRunning)
+	{
+		g_doorEvent[0] = DoorFault;
+		g_doorEvent[1] = 0;
+		g_doorEvent[2] = 0;
+		sendDoorEvent();
+	}
+
+	/*The lockout ended across the reset , end it on HMI ECU that waits for it*/
+	if(g_warmState.lockNotified && FALSE == LOCKOUT_isLocked())
+	{
+		UART_sendByte(Loop);
+		g_warmState.lockNotified = FALSE;
+		saveWarmState();
+	}
+
+	/***************************** Main Loop ****************************/
+
+	while(1)
+	{
+		/*Every pass of the main loop tells the supervisor it isn't stuck*/
+		WDG_checkIn(g_mainTask);
+
+		/*Checks the required application function*/
+		switch(UART_nextState)
+		{
+
+		case Loop: /*Ready mode until command is received*/
+			if(UART_dataAvailable())
+			{
+				DIAG_idleExit();
+				UART_nextState = UART_recieveByte();
+			}
+			else if(FALSE == WORK_isEmpty())
+			{
+				DIAG_idleExit();
+				WORK_run();
+			}
+			else
+			{
+				/*Waiting for a command is idle time*/
+				DIAG_idleEnter();
+				lockoutService();
+			}
+			break;
+
+		case SetPW: /*Match & set password inside EEPROM*/
+			setPassword();
+			break;
+
+		case EnterPW: /*Compare the entered password with the one saved inside EEPROM*/
+			passwordEntry();
+			break;
+
+		case OpenningDoor: /*Start door opening operation */
+
+			/*Only a logged in user with door permission can open the door*/
+			if(USERS_getPermissions(g_sessionUser) & USERS_PERM_DOOR)
+			{
+				/*Saved with the log position by logEvent*/
+				g_warmState.doorRunning = TRUE;
+				logEvent(AUDIT_UNLOCK,g_sessionUser);
+
+				DOOR_start(&g_door,DOOR_TYPE);
+
+				g_currentEvent = CURRENT_NO_EVENT;
+				g_positionReached = FALSE;
+
+				/*Call the door sequence every one second from the system tick*/
+				g_doorTimer = TIMERS_start(TIMERS_TICKS_PER_SECOND,TIMERS_PERIODIC,&doorAction);
+
+				/*Send feedback command to HMI ECU , the door events follow*/
+				UART_sendByte(UART_nextState);
+
+				if(TIMERS_INVALID_ID == g_doorTimer)
+				{
+					/*No software timer left , the door doesn't move : the fault
+					 * event ends the sequence at once (WORK_post is only safe
+					 * from the ISRs , no tick may post meanwhile)*/
+					cli();
+					queueDoorEvent(DoorFault);
+					sei();
+				}
+				/*A one-time code is used up once it opened the door*/
+				else if(USERS_consume(g_sessionUser))
+				{
+					logEvent(AUDIT_USER_REMOVED,g_sessionUser);
+				}
+
+				/*Send the application to empty loop until the operation is complete*/
+				UART_nextState = EmptyLoop ;
+
+			}
+			else
+			{
+				logEvent(AUDIT_ACCESS_DENIED,g_sessionUser);
+
+				/*Refuse , HMI ECU only proceeds on OpenningDoor feedback*/
+				UART_nextState = Loop ;
+				UART_sendByte(UART_nextState);
+			}
+
+			g_sessionUser = USERS_NO_USER;
+			break;
+
+		case SetupStatus : /*Tell HMI ECU whether the admin password is already set*/
+
+			UART_sendByte(USERS_exists(USERS_ADMIN_ID));
+			UART_nextState = Loop;
+			break;
+
+		case AddUser : /*Add / replace a user inside the user table*/
+			addUser();
+			break;
+
+		case RemoveUser : /*Remove a user from the user table*/
+			removeUser();
+			break;
+
+		case ReadLog : /*Send audit log records*/
+			readLog();
+			break;
+
+		case ExportLog : /*Stream the whole audit log*/
+			exportLog();
+			break;
+
+		case Diagnostics : /*Send the CPU load & ISR timing measures*/
+			sendDiagnostics();
+			break;
+
+		case SetClock : /*Set the date & time of the RTC*/
+			setClock();
+			break;
+
+		case SetUserAccess : /*One-time code , validity window & weekly schedule of a user*/
+			setUserAccess();
+			break;
+
+		case LockedMode :/*Enters the system into locked mode for predefined amount of time */
+
+			LOCKOUT_start(TIMERS_getSeconds());
+			lockedMode();
+
+			/*HMI ECU waits for the end of the locked mode*/
+			g_warmState.lockNotified = TRUE;
+			saveWarmState();
+			break;
+
+		case DoorPhase :
+		case DoorProgress :
+		case DoorDone :
+		case DoorFault :
+			/*Events sent to HMI ECU , not commands*/
+			UART_nextState = Loop;
+			break;
+
+		case EmptyLoop :
+			/*The target from the empty loop is to make the application
+			 * do the lowest possible tasks to reduce CPU load
+			 * until the Application status is updated
+			 * & to prevent confliction between tasks*/
+			cli();
+			if(FALSE == WORK_isEmpty())
+			{
+				sei();
+				WORK_run();
+			}
+			else
+			{
+				/*Sleep until the next interrupt (system tick , encoder , ADC) ,
+				 * the instruction after sei() runs before any interrupt so an
+				 * item posted after the check still wakes the loop*/
+				DIAG_idleEnter();
+				sleep_enable();
+				sei();
+				sleep_cpu();
+				sleep_disable();
+			}
+			break;
+		}
+	}
+}
+
+/********************************************************************************
+ *                              Functions Definitions                           *
+ ********************************************************************************/
+
+void setPassword()
+{
+	/*2 Local array of password size to receive the password digit in it*/
+	uint8 firstPasswordEntry[PASSWORD_LENGTH] = {0} ;
+	uint8 secondPasswordEntry[PASSWORD_LENGTH] = {0} ;
+
+	uint8 checkResults = 0;
+	uint8 reply ;
+
+	USERS_Status usersStatus ;
+
+	/*Receive the two password Entries , a missing one is taken as unmatched*/
+	if(UART_RX_OK != UART_receiveExact(firstPasswordEntry,PASSWORD_LENGTH,UART_PAYLOAD_TIMEOUT) ||
+	   UART_RX_OK != UART_receiveExact(secondPasswordEntry,PASSWORD_LENGTH,UART_PAYLOAD_TIMEOUT))
+	{
+		checkResults = 1;
+	}
+	else
+	{
+		/*Return the results of the password matching inside checkResults */
+		checkResults = passwordMatching(firstPasswordEntry,secondPasswordEntry);
+	}
+
+
+	/*If password is unmatched , send the required command to HMI ECU to try again*/
+	if(1 == checkResults)
+	{
+		reply = UNMATCHED_PASSWORD;
+	}
+	/*First setup : no admin yet , the password becomes the admin code*/
+	else if (FALSE == USERS_exists(USERS_ADMIN_ID))
+	{
+		usersStatus = USERS_add(USERS_ADMIN_ID,firstPasswordEntry,
+				USERS_PERM_DOOR | USERS_PERM_ADMIN,0,0);
+
+		/*send the required command to HMI ECU to proceed to Main Menu OR try again*/
+		reply = (USERS_OK == usersStatus) ? MAIN_MENU : UNMATCHED_PASSWORD;
+	}
+	/*Password change : replace the code of the logged in user*/
+	else if (USERS_NO_USER != g_sessionUser)
+	{
+		/*Fails if the new code is already used by another user*/
+		usersStatus = USERS_changeCode(g_sessionUser,firstPasswordEntry);
+
+		if(USERS_OK == usersStatus)
+		{
+			logEvent(AUDIT_PASSWORD_CHANGED,g_sessionUser);
+		}
+
+		reply = (USERS_OK == usersStatus) ? MAIN_MENU : UNMATCHED_PASSWORD;
+	}
+	else
+	{
+		/*Nobody is logged in , nothing is written*/
+		reply = MAIN_MENU;
+	}
+
+	UART_sendByte(reply);
+
+	/*HMI ECU asks for the new password again after UNMATCHED_PASSWORD ,
+	 * the logged in user keeps the session for that retry*/
+	if(MAIN_MENU == reply)
+	{
+		g_sessionUser = USERS_NO_USER;
+	}
+
+	/*Set application status back to ready mode*/
+	UART_nextState = Loop;
+}
+
+uint8 passwordMatching(const uint8 * a_firstEntry , const uint8 * a_secondEntry)
+{
+	uint8 mismatchFlag = 0; /*Default value for no mismatch */
+
+	uint8 passwordDigit ;
+
+	/*Loop on the two password entries and check if there is any mismatch*/
+	for(passwordDigit = 0 ; passwordDigit < PASSWORD_LENGTH ; passwordDigit++)
+	{
+		if(a_firstEntry[passwordDigit] != a_secondEntry[passwordDigit])
+		{
+			/*If mismatch occur , return with the results & break the loop*/
+			mismatchFlag = 1;
+			break;
+		}
+	}
+	/*If no mismatch occurs , just return the default value*/
+	return mismatchFlag ;
+}
+
+void passwordEntry(void)
+{
+	uint8 userId = USERS_NO_USER ;
+
+	uint32 now ;
+
+	USERS_Status usersStatus ;
+
+	/*Local array of password size to receive the password digits in it*/
+	uint8 passwordBuffer[PASSWORD_LENGTH] = {0};
+
+	g_sessionUser = USERS_NO_USER;
+
+	/*Receive the password Entry (HMI ECU sends it with the command once typed) ,
+	 * a missing or cut entry is refused without counting it*/
+	if(UART_RX_OK != UART_receiveExact(passwordBuffer,PASSWORD_LENGTH,UART_PAYLOAD_TIMEOUT))
+	{
+		UART_sendByte(IncorrectPW);
+		UART_nextState = Loop;
+		return;
+	}
+
+	now = TIMERS_getSeconds();
+
+	/*Look the password up inside the user table ,
+	 * the user ID is set if the code is known even if refused*/
+	usersStatus = USERS_verify(passwordBuffer,currentTime(),&userId);
+
+	/*Every password is refused during the lockout , HMI ECU waits for its end*/
+	if(LOCKOUT_isLocked())
+	{
+		g_warmState.lockNotified = TRUE;
+		saveWarmState();
+		UART_sendByte(LockedPW);
+	}
+	/*A match logs the user in unless its own attempt window blocked it*/
+	else if(USERS_OK == usersStatus && FALSE == LOCKOUT_isUserBlocked(userId,now))
+	{
+		LOCKOUT_registerSuccess(userId);
+
+		g_sessionUser = userId;
+		UART_sendByte(CorrectPW);
+	}
+	else
+	{
+		logEvent(AUDIT_FAILED_ATTEMPT,userId);
+
+		/*The counters are kept by this ECU so resetting HMI ECU doesn't clear them ,
+		 * only the unknown codes can lock the whole system*/
+		if(LOCKOUT_registerFailure(userId,now))
+		{
+			lockedMode();
+
+			g_warmState.lockNotified = TRUE;
+			saveWarmState();
+			UART_sendByte(LockedPW);
+		}
+		else
+		{
+			UART_sendByte(IncorrectPW);
+		}
+	}
+
+	/*Set application status back to ready mode*/
+	UART_nextState = Loop;
+}
+
+void addUser(void)
+{
+	uint8 userId ;
+
+	/*2 Local array of password size to receive the code digits in it*/
+	uint8 firstCodeEntry[PASSWORD_LENGTH] = {0} ;
+	uint8 secondCodeEntry[PASSWORD_LENGTH] = {0} ;
+
+	User_Results result ;
+
+	/*Receive the user ID followed by the two code entries*/
+	if(UART_RX_OK != UART_receiveExact(&userId,1,UART_PAYLOAD_TIMEOUT) ||
+	   UART_RX_OK != UART_receiveExact(firstCodeEntry,PASSWORD_LENGTH,UART_PAYLOAD_TIMEOUT) ||
+	   UART_RX_OK != UART_receiveExact(secondCodeEntry,PASSWORD_LENGTH,UART_PAYLOAD_TIMEOUT))
+	{
+		/*Incomplete command , nothing is written*/
+		result = UserUnmatched;
+	}
+	else if(!(USERS_getPermissions(g_sessionUser) & USERS_PERM_ADMIN))
+	{
+		result = UserDenied;
+	}
+	/*The admin slot is only changed through the password change*/
+	else if(USERS_ADMIN_ID == userId || userId >= USERS_MAX_USERS)
+	{
+		result = UserInvalidID;
+	}
+	else if(1 == passwordMatching(firstCodeEntry,secondCodeEntry))
+	{
+		result = UserUnmatched;
+	}
+	else
+	{
+		result = usersStatusToResult(USERS_add(userId,firstCodeEntry,USERS_PERM_DOOR,0,0));
+	}
+
+	if(UserDone == result)
+	{
+		logEvent(AUDIT_USER_ADDED,userId);
+	}
+
+	UART_sendByte(result);
+
+	g_sessionUser = USERS_NO_USER;
+
+	/*Set application status back to ready mode*/
+	UART_nextState = Loop;
+}
+
+void removeUser(void)
+{
+	uint8 userId ;
+
+	User_Results result ;
+
+	/*Receive the user ID*/
+	if(UART_RX_OK != UART_receiveExact(&userId,1,UART_PAYLOAD_TIMEOUT))
+	{
+		/*Incomplete command , nothing is removed*/
+		result = UserInvalidID;
+	}
+	else if(!(USERS_getPermissions(g_sessionUser) & USERS_PERM_ADMIN))
+	{
+		result = UserDenied;
+	}
+	/*The admin can't be removed , the system would be left without one*/
+	else if(USERS_ADMIN_ID == userId || userId >= USERS_MAX_USERS)
+	{
+		result = UserInvalidID;
+	}
+	else
+	{
+		result = usersStatusToResult(USERS_remove(userId));
+	}
+
+	if(UserDone == result)
+	{
+		logEvent(AUDIT_USER_REMOVED,userId);
+	}
+
+	UART_sendByte(result);
+
+	g_sessionUser = USERS_NO_USER;
+
+	/*Set application status back to ready mode*/
+	UART_nextState = Loop;
+}
+
+User_Results usersStatusToResult(USERS_Status a_status)
+{
+	User_Results result ;
+
+	switch(a_status)
+	{
+	case USERS_OK:
+		result = UserDone;
+		break;
+	case USERS_NOT_FOUND:
+		result = UserNotFound;
+		break;
+	case USERS_INVALID_ID:
+		result = UserInvalidID;
+		break;
+	case USERS_DUPLICATE:
+		result = UserDuplicate;
+		break;
+	default:
+		result = UserStorageError;
+		break;
+	}
+	return result;
+}
+
+void readLog(void)
+{
+	/*Records are read & sent in small batches to keep the stack small*/
+	AUDIT_RecordType records[4];
+
+	uint8 recordIndex ;
+	uint8 recordsCount ;
+	uint8 batchCount ;
+	uint8 request[2] ;
+
+	/*Receive the index of the first record (0 = oldest) & the number of records*/
+	if(UART_RX_OK != UART_receiveExact(request,2,UART_PAYLOAD_TIMEOUT))
+	{
+		/*Incomplete command , no record follows*/
+		request[0] = 0;
+		request[1] = 0;
+	}
+	recordIndex = request[0];
+	recordsCount = request[1];
+
+	/*Send the number of records that will follow*/
+	if(recordIndex >= AUDIT_count())
+	{
+		recordsCount = 0;
+	}
+	else if(recordsCount > (AUDIT_count() - recordIndex))
+	{
+		recordsCount = AUDIT_count() - recordIndex;
+	}
+	UART_sendByte(recordsCount);
+
+	while(recordsCount > 0)
+	{
+		batchCount = recordsCount < 4 ? recordsCount : 4;
+
+		/*Read error , fill the remaining records with an erased pattern
+		 * so the receiver still gets the announced number of bytes*/
+		if(ERROR == AUDIT_read(recordIndex,records,&batchCount))
+		{
+			batchCount = recordsCount < 4 ? recordsCount : 4;
+			records[0].sequence = AUDIT_EMPTY_SEQUENCE;
+			records[1].sequence = AUDIT_EMPTY_SEQUENCE;
+			records[2].sequence = AUDIT_EMPTY_SEQUENCE;
+			records[3].sequence = AUDIT_EMPTY_SEQUENCE;
+		}
+
+		UART_sendData((const uint8 *)records,batchCount * AUDIT_RECORD_SIZE);
+
+		/*A long read isn't a hang*/
+		WDG_checkIn(g_mainTask);
+
+		recordIndex += batchCount;
+		recordsCount -= batchCount;
+	}
+
+	/*Set application status back to ready mode*/
+	UART_nextState = Loop;
+}
+
+void exportLog(void)
+{
+	AUDIT_RecordType records[EXPORT_CHUNK_RECORDS];
+
+	uint8 frameHeader[3] ;
+	uint8 frameCRC[2] ;
+	uint8 recordIndex ;
+	uint8 chunkCount ;
+	uint8 readStatus ;
+	uint16 crc ;
+
+	/*Receive the index of the first record to send ,
+	 * nothing is sent if it doesn't come (the exporter asks again)*/
+	if(UART_RX_OK != UART_receiveExact(&recordIndex,1,UART_PAYLOAD_TIMEOUT))
+	{
+		UART_nextState = Loop;
+		return;
+	}
+
+	do
+	{
+		/*One sequential EEPROM read per chunk , it overlaps with the
+		 * transmission of the previous chunk still inside the TX buffer*/
+		chunkCount = EXPORT_CHUNK_RECORDS;
+		readStatus = AUDIT_read(recordIndex,records,&chunkCount);
+
+		/*An EEPROM error ends the export with an error frame ,
+		 * the exporter doesn't take it for the end of the log*/
+		frameHeader[0] = (SUCCESS == readStatus) ? EXPORT_FRAME_START : EXPORT_FRAME_ERROR;
+		frameHeader[1] = recordIndex;
+		frameHeader[2] = chunkCount * AUDIT_RECORD_SIZE;
+
+		crc = CRC16_update(CRC16_INITIAL_VALUE,&frameHeader[1],2);
+		crc = CRC16_update(crc,(const uint8 *)records,frameHeader[2]);
+
+		frameCRC[0] = (uint8)(crc >> 8);
+		frameCRC[1] = (uint8)crc;
+
+		UART_sendDataAsync(frameHeader,3);
+		UART_sendDataAsync((const uint8 *)records,frameHeader[2]);
+		UART_sendDataAsync(frameCRC,2);
+
+		recordIndex += chunkCount;
+
+		/*A long export isn't a hang*/
+		WDG_checkIn(g_mainTask);
+
+	}while(chunkCount > 0); /*The last frame is empty*/
+
+	/*Set application status back to ready mode*/
+	UART_nextState = Loop;
+}
+
+void sendDiagnostics(void)
+{
+	DIAG_ReportType report ;
+	WORK_StatsType workStats ;
+
+	uint8 frameHeader[2] ;
+	uint8 frameCRC[2] ;
+	uint8 resetMeasures ;
+	uint16 crc ;
+
+	/*Receive TRUE to restart the measures once they are sent ,
+	 * the measures are kept if it doesn't come*/
+	if(UART_RX_OK != UART_receiveExact(&resetMeasures,1,UART_PAYLOAD_TIMEOUT))
+	{
+		resetMeasures = FALSE;
+	}
+
+	DIAG_getReport(&report);
+	WORK_getStats(&workStats);
+
+	frameHeader[0] = DIAGNOSTICS_FRAME_START;
+	frameHeader[1] = sizeof(DIAG_ReportType) + sizeof(WORK_StatsType);
+
+	crc = CRC16_update(CRC16_INITIAL_VALUE,&frameHeader[1],1);
+	crc = CRC16_update(crc,(const uint8 *)&report,sizeof(DIAG_ReportType));
+	crc = CRC16_update(crc,(const uint8 *)&workStats,sizeof(WORK_StatsType));
+
+	frameCRC[0] = (uint8)(crc >> 8);
+	frameCRC[1] = (uint8)crc;
+
+	UART_sendData(frameHeader,2);
+	UART_sendData((const uint8 *)&report,sizeof(DIAG_ReportType));
+	UART_sendData((const uint8 *)&workStats,sizeof(WORK_StatsType));
+	UART_sendData(frameCRC,2);
+
+	if(TRUE == resetMeasures)
+	{
+		DIAG_reset();
+		WORK_resetStats();
+	}
+
+	/*Set application status back to ready mode*/
+	UART_nextState = Loop;
+}
+
+void setClock(void)
+{
+	uint8 timeBytes[4] ;
+	uint32 time ;
+
+	User_Results result ;
+
+	if(UART_RX_OK != UART_receiveExact(timeBytes,4,UART_PAYLOAD_TIMEOUT))
+	{
+		/*Incomplete command , the clock isn't changed*/
+		result = UserUnmatched;
+	}
+	else if(!(USERS_getPermissions(g_sessionUser) & USERS_PERM_ADMIN))
+	{
+		result = UserDenied;
+	}
+	else
+	{
+		time = (uint32)timeBytes[0] | ((uint32)timeBytes[1] << 8) |
+				((uint32)timeBytes[2] << 16) | ((uint32)timeBytes[3] << 24);
+
+		/*Out of 2000 .. 2099 or not taken by the chip*/
+		result = RTC_set(time) ? UserDone : UserStorageError;
+	}
+
+	if(UserDone == result)
+	{
+		logEvent(AUDIT_CLOCK_SET,g_sessionUser);
+	}
+
+	UART_sendByte(result);
+
+	g_sessionUser = USERS_NO_USER;
+
+	/*Set application status back to ready mode*/
+	UART_nextState = Loop;
+}
+
+void setUserAccess(void)
+{
+	/*ID | limits | valid from | valid until | schedule*/
+	uint8 payload[2 + 4 + 4 + USERS_SCHEDULE_BYTES] ;
+	uint32 validFrom ;
+	uint32 validUntil ;
+
+	User_Results result ;
+
+	if(UART_RX_OK != UART_receiveExact(payload,sizeof(payload),UART_PAYLOAD_TIMEOUT))
+	{
+		/*Incomplete command , nothing is written*/
+		result = UserUnmatched;
+	}
+	else if(!(USERS_getPermissions(g_sessionUser) & USERS_PERM_ADMIN))
+	{
+		result = UserDenied;
+	}
+	/*The admin is never limited , the system would be left without one*/
+	else if(USERS_ADMIN_ID == payload[0] || payload[0] >= USERS_MAX_USERS)
+	{
+		result = UserInvalidID;
+	}
+	else
+	{
+		validFrom = (uint32)payload[2] | ((uint32)payload[3] << 8) |
+				((uint32)payload[4] << 16) | ((uint32)payload[5] << 24);
+		validUntil = (uint32)payload[6] | ((uint32)payload[7] << 8) |
+				((uint32)payload[8] << 16) | ((uint32)payload[9] << 24);
+
+		result = usersStatusToResult(USERS_setAccess(payload[0],payload[1],
+				validFrom,validUntil,&payload[10]));
+	}
+
+	if(UserDone == result)
+	{
+		logEvent(AUDIT_USER_ACCESS,payload[0]);
+	}
+
+	UART_sendByte(result);
+
+	g_sessionUser = USERS_NO_USER;
+
+	/*Set application status back to ready mode*/
+	UART_nextState = Loop;
+}
+
+uint32 currentTime(void)
+{
+	return RTC_isValid() ? RTC_now() : USERS_TIME_UNKNOWN;
+}
+
+void logEvent(AUDIT_EventType a_event , uint8 a_userId)
+{
+	/*A failed log write must never block the door operation*/
+	AUDIT_log(a_event,a_userId,RTC_now());
+
+	saveWarmState();
+}
+
+void saveWarmState(void)
+{
+	AUDIT_getState(&g_warmState.audit);
+
+	WDG_saveState((const uint8 *)&g_warmState,sizeof(Warm_State));
+}
+
+void doorAction(void)
+{
+	const DOOR_PhaseType * phase ;
+
+	/*The bolt is at the end of the phase movement , the phase is done
+	 * whatever the time left & the next one is entered right now*/
+	if(g_positionReached)
+	{
+		DOOR_skipPhase(&g_door);
+		g_positionReached = FALSE;
+		g_currentEvent = CURRENT_NO_EVENT;
+	}
+	else if(CURRENT_NO_EVENT != g_currentEvent)
+	{
+		/*The end-stop can't be reached before the minimum travel time ,
+		 * an earlier current rise is an obstruction*/
+		if(CURRENT_END_STOP == g_currentEvent &&
+		   g_door.elapsed >= DOOR_currentPhase(&g_door)->minTravel)
+		{
+			/*Phase done , the next one is entered right now*/
+			DOOR_skipPhase(&g_door);
+			g_currentEvent = CURRENT_NO_EVENT;
+		}
+		else
+		{
+			/*Jammed , abort the sequence with the motor stopped*/
+			g_currentEvent = CURRENT_NO_EVENT;
+			CURRENT_stop();
+			POSITION_setTarget(POSITION_NO_TARGET);
+			TIMERS_stop(g_doorTimer);
+
+			queueDoorEvent(DoorFault);
+			return;
+		}
+	}
+
+	switch(DOOR_step(&g_door))
+	{
+	case DOOR_PHASE_ENTERED:
+		phase = DOOR_currentPhase(&g_door);
+
+		/*Instead of setting DC_Motor state at each second
+		 * just set it at the first of each phase to save CPU Load*/
+		DcMotor_Move((DcMotor_State)phase->motor);
+
+		/*Count the bolt movement towards the end of this phase*/
+		POSITION_setTarget((POSITION_TargetType)phase->motor);
+
+		/*Watch the motor current only in the phases ended by an end-stop*/
+		if(0 != phase->minTravel)
+		{
+			CURRENT_start();
+		}
+		else
+		{
+			CURRENT_stop();
+		}
+
+		queueDoorEvent(DoorPhase);
+		break;
+
+	case DOOR_PHASE_RUNNING:
+		queueDoorEvent(DoorProgress);
+		break;
+
+	case DOOR_SEQUENCE_DONE:
+		/*Stop DC motor & the door timer , the main loop
+		 * sets back application to ready mode after sending the event*/
+		DcMotor_Move(STOP);
+		CURRENT_stop();
+		POSITION_setTarget(POSITION_NO_TARGET);
+		TIMERS_stop(g_doorTimer);
+
+		queueDoorEvent(DoorDone);
+		break;
+	}
+}
+
+void queueDoorEvent(UART_commands a_event)
+{
+	/*One event per second , the main loop sends it long before the next one*/
+	g_doorEvent[0] = a_event;
+	g_doorEvent[1] = g_door.index;
+	g_doorEvent[2] = g_door.elapsed;
+
+	/*Posted last , the main loop only reads a complete event*/
+	WORK_post(&sendDoorEvent);
+}
+
+void sendDoorEvent(void)
+{
+	UART_sendData(g_doorEvent,DOOR_EVENT_SIZE);
+
+	if(DoorFault == g_doorEvent[0])
+	{
+		logEvent(AUDIT_DOOR_FAULT,USERS_NO_USER);
+	}
+
+	if(DoorDone == g_doorEvent[0] || DoorFault == g_doorEvent[0])
+	{
+		g_warmState.doorRunning = FALSE;
+		saveWarmState();
+
+		/*Set application status back to ready mode*/
+		UART_nextState = Loop ;
+	}
+}
+
+void positionReached(void)
+{
+	/*No ramp down , the bolt would run past its end position*/
+	DcMotor_Rotate(STOP);
+
+	g_positionReached = TRUE;
+}
+
+void motorCurrentEvent(CURRENT_EventType a_event)
+{
+	/*Don't keep pushing against the end-stop / obstruction ,
+	 * the motor is stopped at once without the ramp down*/
+	DcMotor_Rotate(STOP);
+
+	g_currentEvent = a_event;
+}
+
+void lockedMode(void)
+{
+	logEvent(AUDIT_LOCKOUT,USERS_NO_USER);
+
+	/*Creates a Beeping Sound :D*/
+	if(TIMERS_INVALID_ID == g_buzzerTimer)
+	{
+		g_buzzerTimer = TIMERS_start(TIMERS_MS_TO_TICKS(BUZZER_BEEP_TIME),TIMERS_PERIODIC,&buzzerBeep);
+	}
+
+	/*Set application back to ready mode , commands are still served*/
+	UART_nextState=Loop;
+}
+
+void buzzerBeep(void)
+{
+	static uint8 buzzerState = LOGIC_LOW;
+
+	buzzerState ^= 1;
+
+	if(buzzerState)
+	{
+		Buzzer_on();
+	}
+	else
+	{
+		Buzzer_off();
+	}
+}
+
+void secondTick(void)
+{
+	DIAG_sample();
+	RTC_tick();
+	LOCKOUT_tick();
+}
+
+void lockoutService(void)
+{
+	if(LOCKOUT_service())
+	{
+		TIMERS_stop(g_buzzerTimer);
+		g_buzzerTimer = TIMERS_INVALID_ID;
+		Buzzer_off();
+
+		/*Sends feedback to HMI ECU that the locked mode has been exited ,
+		 * only if it waits for it , otherwise the byte would be taken
+		 * as the reply of its next command*/
+		if(g_warmState.lockNotified)
+		{
+			UART_sendByte(Loop);
+			g_warmState.lockNotified = FALSE;
+			saveWarmState();
+		}
+	}
+}
+
+/**********************************************************************/
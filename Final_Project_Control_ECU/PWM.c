@@ -1,55 +1,185 @@
-/******************************************************************************
- *
- * Module: Timer 0 PWM source file
- *
- * File Name: PWM.c
- *
- * Description: Source file for the TIMER0 PWM AVR driver
- *
- * Created on: Feb 20, 2024
- *
- * Author: Karim Amr
- *
-******************************************************************************/
-
-/*******************************************************************************
- *                            Required Libraries                               *
- *******************************************************************************/
-
-#include "PWM.h"
-#include "std_types.h"
-#include "gpio.h"
-#include "avr/io.h"
-
-/***************************************************************/
-/*					Functions Definitions					   */
-/***************************************************************/
-
-/*Initialize and start the PWM of Timer0 with required duty cycle*/
-void PWM_Timer0_Start(uint8 duty_cycle)
-{
-	/*Sets the Enable pin of OC0 as output for PWM signal */
-	GPIO_setupPinDirection(DC_MOTOR_EN_PORT,DC_MOTOR_EN_PIN,PIN_OUTPUT);
-
-	if(0 == duty_cycle)
-	{
-		/*Turns off Timer0-PWM to save power / CPU load*/
-		TCCR0 = 0 ;
-		OCR0  = 0 ;
-		TCNT0 = 0 ;
-	}
-	else
-	{
-		/*Sets Timer0 mode on Fast PWM
-		 * Set PWM on non-inverting mode
-		 * Set FCPU pre-scaler on FCPU/8
-		 * to set duty cycle freq. on 500 Hz */
-		TCCR0 = (1<<WGM00) |  (1<<WGM01) | (1<<COM01) | (1<<CS01) ;
-
-		/*Counter Starts from Zero */
-		TCNT0 = 0;
-
-		/*Sets the duty cycle value according to function argument */
-		OCR0 = ((duty_cycle * MAX_TIMER_VALUE)/(100));
-	}
-}
+/******************************************************************************
+ *
+ * Module: PWM source file
+ *
+ * File Name: PWM.c
+ *
+ * Description: Source file for the 8-bit timers (TIMER0 / TIMER2) PWM AVR driver
+ *
+ * Created on: Feb 20, 2024
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "PWM.h"
+#include "std_types.h"
+#include "gpio.h"
+#include "avr/io.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+/*Pre-scalers of each timer , the position + 1 is the CS bits value*/
+static const uint16 s_timer0Prescalers[] = {1,8,64,256,1024};
+static const uint16 s_timer2Prescalers[] = {1,8,32,64,128,256,1024};
+
+/*Compare register of the configured timer , a duty update is a single write*/
+static volatile uint8 * s_ocr = &OCR0;
+
+/*Control register & compare output bit of the configured timer ,
+ * the bit is only switched in fast PWM (0 in phase correct)*/
+static volatile uint8 * s_tccr = &TCCR0;
+static uint8 s_fastCompareOutput = 0;
+
+static uint32 s_frequency = 0;
+
+/***************************************************************/
+/*					Functions Definitions					   */
+/***************************************************************/
+
+/*Configure the timer mode & the pre-scaler closest to the target frequency*/
+void PWM_init(const PWM_ConfigType * Config_Ptr)
+{
+	const uint16 * prescalers ;
+	uint8 prescalersCount ;
+	uint8 index ;
+	uint8 clockSelect = 1 ;
+	uint32 steps ;
+	uint32 frequency ;
+	uint32 error ;
+	uint32 bestError = 0xFFFFFFFFUL ;
+	uint8 modeBits ;
+
+	if(PWM_TIMER2 == Config_Ptr->timer)
+	{
+		prescalers = s_timer2Prescalers;
+		prescalersCount = sizeof(s_timer2Prescalers) / sizeof(uint16);
+	}
+	else
+	{
+		prescalers = s_timer0Prescalers;
+		prescalersCount = sizeof(s_timer0Prescalers) / sizeof(uint16);
+	}
+
+	steps = (PWM_PHASE_CORRECT == Config_Ptr->mode) ? PWM_PHASE_CORRECT_STEPS : PWM_FAST_STEPS;
+
+	/*The 8-bit timers have a fixed TOP in PWM modes ,
+	 * the frequency is only set by the pre-scaler*/
+	for(index = 0 ; index < prescalersCount ; index++)
+	{
+		frequency = F_CPU / (prescalers[index] * steps);
+		error = (frequency > Config_Ptr->frequency) ?
+				(frequency - Config_Ptr->frequency) : (Config_Ptr->frequency - frequency);
+
+		if(error < bestError)
+		{
+			bestError = error;
+			clockSelect = index + 1;
+			s_frequency = frequency;
+		}
+	}
+
+	if(PWM_TIMER2 == Config_Ptr->timer)
+	{
+		GPIO_setupPinDirection(PWM_OC2_PORT,PWM_OC2_PIN,PIN_OUTPUT);
+		GPIO_writePin(PWM_OC2_PORT,PWM_OC2_PIN,LOGIC_LOW);
+
+		/*Non-inverting mode , Fast PWM (WGM21 & WGM20) OR Phase correct (WGM20)*/
+		modeBits = (1<<WGM20) | (1<<COM21);
+		s_fastCompareOutput = 0;
+		if(PWM_FAST == Config_Ptr->mode)
+		{
+			modeBits |= (1<<WGM21);
+			s_fastCompareOutput = (1<<COM21);
+		}
+
+		s_ocr = &OCR2;
+		s_tccr = &TCCR2;
+		OCR2  = 0;
+		TCNT2 = 0;
+		TCCR2 = (modeBits & ~s_fastCompareOutput) | clockSelect;
+	}
+	else
+	{
+		/*Sets the Enable pin of OC0 as output for PWM signal */
+		GPIO_setupPinDirection(DC_MOTOR_EN_PORT,DC_MOTOR_EN_PIN,PIN_OUTPUT);
+		GPIO_writePin(DC_MOTOR_EN_PORT,DC_MOTOR_EN_PIN,LOGIC_LOW);
+
+		/*Non-inverting mode , Fast PWM (WGM01 & WGM00) OR Phase correct (WGM00)*/
+		modeBits = (1<<WGM00) | (1<<COM01);
+		s_fastCompareOutput = 0;
+		if(PWM_FAST == Config_Ptr->mode)
+		{
+			modeBits |= (1<<WGM01);
+			s_fastCompareOutput = (1<<COM01);
+		}
+
+		s_ocr = &OCR0;
+		s_tccr = &TCCR0;
+		OCR0  = 0;
+		TCNT0 = 0;
+		TCCR0 = (modeBits & ~s_fastCompareOutput) | clockSelect;
+	}
+}
+
+/*Change the duty cycle (%) writing the compare register only*/
+void PWM_setDuty(uint8 duty_cycle)
+{
+	uint8 compare ;
+
+	if(duty_cycle > 100)
+	{
+		duty_cycle = 100;
+	}
+
+	/*duty * 255 / 100*/
+	compare = (uint8)(((uint16)duty_cycle * PWM_DUTY_SCALE) >> 8);
+
+	if(0 == compare)
+	{
+		/*Fast PWM still puts a one count pulse every period with a compare
+		 * value of 0 , the pin is given back to its port (low) for a true 0 %*/
+		*s_tccr &= ~s_fastCompareOutput;
+		*s_ocr = 0;
+	}
+	else
+	{
+		*s_ocr = compare;
+
+		/*Connected again on the way out of 0 % only*/
+		if(s_fastCompareOutput & ~(*s_tccr))
+		{
+			*s_tccr |= s_fastCompareOutput;
+		}
+	}
+}
+
+/*Return the actual PWM frequency in Hz*/
+uint32 PWM_getFrequency(void)
+{
+	return s_frequency;
+}
+
+/*Stop the timer clock & force the output low*/
+void PWM_deInit(void)
+{
+	*s_ocr = 0;
+
+	if(&OCR2 == s_ocr)
+	{
+		TCCR2 = 0;
+		TCNT2 = 0;
+	}
+	else
+	{
+		TCCR0 = 0;
+		TCNT0 = 0;
+	}
+	s_frequency = 0;
+}
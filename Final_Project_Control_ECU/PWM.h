@@ -1,42 +1,86 @@
-/******************************************************************************
- *
- * Module: Timer 0 PWM header file
- *
- * File Name: PWM.h
- *
- * Description: Header file for the TIMER0 PWM AVR driver
- *
- * Created on: Feb 20, 2024
- *
- * Author: Karim Amr
- *
-******************************************************************************/
-
-#ifndef PWM_H_
-#define PWM_H_
-
-/*******************************************************************************
- *                            Required Libraries                               *
- *******************************************************************************/
-
-#include "std_types.h"
-
-/*****************************************************************/
-/*							   Definitions				      	 */
-/*****************************************************************/
-
-/*Define the port and pin number for EN pin of H-bridge */
-#define DC_MOTOR_EN_PORT    PORTB_ID
-#define DC_MOTOR_EN_PIN  	PIN3_ID
-
-#define MAX_TIMER_VALUE 	255
-
-
-/***************************************************************/
-/*					Functions ProtoTypes					   */
-/***************************************************************/
-
-/*Initialize and start the PWM of Timer0 with required duty cycle*/
-void PWM_Timer0_Start(uint8 duty_cycle);
-
-#endif /* PWM_H_ */
+/******************************************************************************
+ *
+ * Module: PWM header file
+ *
+ * File Name: PWM.h
+ *
+ * Description: Header file for the 8-bit timers (TIMER0 / TIMER2) PWM AVR driver
+ *
+ * Created on: Feb 20, 2024
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef PWM_H_
+#define PWM_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*****************************************************************/
+/*							   Definitions				      	 */
+/*****************************************************************/
+
+/*Define the port and pin number for EN pin of H-bridge (OC0)*/
+#define DC_MOTOR_EN_PORT    PORTB_ID
+#define DC_MOTOR_EN_PIN  	PIN3_ID
+
+/*Output compare pin of TIMER2*/
+#define PWM_OC2_PORT		PORTD_ID
+#define PWM_OC2_PIN			PIN7_ID
+
+#define MAX_TIMER_VALUE 	255
+
+/*Timer counts per PWM period : 256 in fast mode , 510 in phase correct mode*/
+#define PWM_FAST_STEPS				256UL
+#define PWM_PHASE_CORRECT_STEPS		510UL
+
+/*Duty cycle (%) to compare value scaling : 255/100 = 653/256 ,
+ * a multiply & shift instead of a software division on every update*/
+#define PWM_DUTY_SCALE				653U
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef enum
+{
+	PWM_TIMER0 , PWM_TIMER2
+}PWM_TimerId;
+
+typedef enum
+{
+	PWM_FAST , PWM_PHASE_CORRECT
+}PWM_ModeType;
+
+typedef struct
+{
+	PWM_TimerId timer;
+	PWM_ModeType mode;
+	uint32 frequency;	/*Target in Hz , the closest pre-scaler is selected*/
+}PWM_ConfigType;
+
+/***************************************************************/
+/*					Functions ProtoTypes					   */
+/***************************************************************/
+
+/*Configure the timer mode & the pre-scaler closest to the target frequency ,
+ * the output starts at zero duty*/
+void PWM_init(const PWM_ConfigType * Config_Ptr);
+
+/*Change the duty cycle (%) , only the compare register is written
+ * (double buffered by the hardware so the change is glitch free) ,
+ * in fast PWM 0 % also disconnects the output pin (held low)*/
+void PWM_setDuty(uint8 duty_cycle);
+
+/*Return the actual PWM frequency in Hz*/
+uint32 PWM_getFrequency(void);
+
+/*Stop the timer clock & force the output low*/
+void PWM_deInit(void);
+
+#endif /* PWM_H_ */
@@ -1,105 +1,161 @@
- /******************************************************************************
- *
- * Module : USART
- *
- * File Name: UART.h
- *
- * Description : Header file of UART driver
- *
- * Created on: Feb 28, 2024
- *
- * Author: Mohamed Tarek
- *
- * Modified by : Karim Amr
- *
-******************************************************************************/
-
-#ifndef USART_H_
-#define USART_H_
-
-#include "std_types.h"
-
-/*******************************************************************************
- *                                    Definitions                               *
- *******************************************************************************/
-
-typedef enum {
-	FiveBit , SixBit , SevenBit , EightBit
-}UART_BitData ;
-
-typedef enum {
-	DisabledParity , EvenParity=2 , OddParity
-}UART_Parity ;
-
-typedef enum {
-	OneStopBit , TwoStopBits
-}UART_StopBit ;
-
-typedef uint32 UART_BaudRate ;
-
-typedef struct{
- UART_BitData bit_data;
- UART_Parity parity;
- UART_StopBit stop_bit;
- UART_BaudRate baud_rate;
-}UART_ConfigType;
-
-/*******************************************************************************
- *                              Functions Prototypes                           *
- *******************************************************************************/
-
-/* Description
- * Initialize UART by :
- * 1. Selecting clock mode ( Asynchronous / Synchronous) (Static to Asynchronous Operation)
- * 2. Selecting parity mode ( Disabled  , Even , Odd )
- * 3. Selecting number of stop bits ( One_Bit , Two_Bits )
- * 4. Selecting Baud rate
- * 5. Setting data frame bits ( 5 , 6 ,  7 , 8 )
- */
-void UART_init(const UART_ConfigType * Config_Ptr);
-
-/* Description
- * return the value of the received byte through UART frame
- */
-uint8 UART_recieveByte(void);
-
-
-/* Description
- * Send 8-bit data through UART frame
- * uses the UDRE flag check in order to send data without overwriting of prev. unsent data
- */
-void UART_sendByte(uint8 data);
-
-/* Description
- * return the value of the received string through UART frame
- * into an string ( pointer to global string )
- * & replace the '#' that indicates the end of the string
- * with '\0' to set the string Null
- */
-void UART_recieveString(uint8 *Str);
-
-/* Description
- * Send array of string through UART frame
- * until the '#' character is detected
- */
-void UART_sendString(const char *Str);
-
-
-
-/* Description
- * Send array of data through UART frame
- * until the size of array is reached
- */
-void UART_sendData(const uint8 *Data, uint8 dataSize);
-
-
-/* Description
- * return the value of the received array through UART frame
- * into an array ( pointer to global array )
- * until size of array is reached
- */
-void UART_recieveData(uint8 * Data , uint8 dataSize);
-
-
-
-#endif /* USART_H_ */
+ /******************************************************************************
+ *
+ * Module : USART
+ *
+ * File Name: UART.h
+ *
+ * Description : Header file of UART driver
+ *
+ * Created on: Feb 28, 2024
+ *
+ * Author: Mohamed Tarek
+ *
+ * Modified by : Karim Amr
+ *
+******************************************************************************/
+
+#ifndef USART_H_
+#define USART_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                    Definitions                               *
+ *******************************************************************************/
+
+typedef enum {
+	FiveBit , SixBit , SevenBit , EightBit
+}UART_BitData ;
+
+typedef enum {
+	DisabledParity , EvenParity=2 , OddParity
+}UART_Parity ;
+
+typedef enum {
+	OneStopBit , TwoStopBits
+}UART_StopBit ;
+
+typedef uint32 UART_BaudRate ;
+
+/*Size of the interrupt driven transmit buffer (power of two)*/
+#define UART_TX_BUFFER_SIZE 128
+
+/*Size of the interrupt driven receive buffer (power of two)*/
+#define UART_RX_BUFFER_SIZE 32
+
+/*Timeout of the receive functions that never gives up*/
+#define UART_WAIT_FOREVER 0xFFFF
+
+/*Longest string received by UART_recieveString (without the '\0')*/
+#define UART_STRING_MAX_LENGTH 32
+
+typedef enum {
+	UART_RX_OK , UART_RX_TIMEOUT , UART_RX_FULL
+}UART_RxStatus ;
+
+typedef struct{
+ UART_BitData bit_data;
+ UART_Parity parity;
+ UART_StopBit stop_bit;
+ UART_BaudRate baud_rate;
+}UART_ConfigType;
+
+/*******************************************************************************
+ *                              Functions Prototypes                           *
+ *******************************************************************************/
+
+/* Description
+ * Initialize UART by :
+ * 1. Selecting clock mode ( Asynchronous / Synchronous) (Static to Asynchronous Operation)
+ * 2. Selecting parity mode ( Disabled  , Even , Odd )
+ * 3. Selecting number of stop bits ( One_Bit , Two_Bits )
+ * 4. Selecting Baud rate
+ * 5. Setting data frame bits ( 5 , 6 ,  7 , 8 )
+ */
+void UART_init(const UART_ConfigType * Config_Ptr);
+
+/* Description
+ * return the value of the received byte through UART frame
+ * (waits until a byte is inside the receive buffer)
+ */
+uint8 UART_recieveByte(void);
+
+/* Description
+ * return TRUE if a received byte is waiting to be read
+ * so the caller can do other work instead of blocking on UART_recieveByte
+ */
+boolean UART_dataAvailable(void);
+
+
+/* Description
+ * Send 8-bit data through UART frame
+ * uses the UDRE flag check in order to send data without overwriting of prev. unsent data
+ */
+void UART_sendByte(uint8 data);
+
+/* Description
+ * return the value of the received string through UART frame
+ * into an string ( pointer to global string )
+ * & replace the '#' that indicates the end of the string
+ * with '\0' to set the string Null
+ * Str must hold UART_STRING_MAX_LENGTH + 1 characters , a longer string
+ * is cut there & the rest is left inside the receive buffer
+ */
+void UART_recieveString(uint8 *Str);
+
+/* Description
+ * Send array of string through UART frame
+ * until the '#' character is detected
+ */
+void UART_sendString(const char *Str);
+
+
+
+/* Description
+ * Send array of data through UART frame
+ * until the size of array is reached
+ */
+void UART_sendData(const uint8 *Data, uint8 dataSize);
+
+
+/* Description
+ * return the value of the received array through UART frame
+ * into an array ( pointer to global array )
+ * until size of array is reached
+ */
+void UART_recieveData(uint8 * Data , uint8 dataSize);
+
+/* Description
+ * Receive bytes into Data until the delimiter is received (not stored)
+ * or maxSize bytes are stored or timeout milliseconds have passed
+ * ( UART_WAIT_FOREVER to wait without limit) , the number of bytes
+ * stored is returned in receivedSize
+ * Returns UART_RX_OK on the delimiter , UART_RX_FULL if Data got full first
+ */
+UART_RxStatus UART_receiveUntil(uint8 * Data , uint8 delimiter , uint8 maxSize ,
+		uint8 * receivedSize , uint16 timeout);
+
+/* Description
+ * Receive exactly dataSize bytes into Data within timeout milliseconds
+ * ( UART_WAIT_FOREVER to wait without limit)
+ * Returns UART_RX_TIMEOUT if the peer sent less , the bytes received so far
+ * are inside Data
+ */
+UART_RxStatus UART_receiveExact(uint8 * Data , uint8 dataSize , uint16 timeout);
+
+/* Description
+ * Copy array of data into the transmit buffer and return as soon as it is
+ * copied (waits only if the buffer is full) , the bytes are sent back to back
+ * by the Data Register Empty interrupt while the caller prepares the next data
+ * Global interrupts must be enabled
+ */
+void UART_sendDataAsync(const uint8 *Data, uint8 dataSize);
+
+/* Description
+ * Wait until all the bytes of the transmit buffer are handed to the UART
+ */
+void UART_flushTx(void);
+
+
+
+#endif /* USART_H_ */
@@ -0,0 +1,202 @@
+/******************************************************************************
+ *
+ * Module: Audit Log
+ *
+ * File Name: audit_log.c
+ *
+ * Description: Source file for the persistent event log
+ * 				(circular buffer of fixed-size records inside the external EEPROM)
+ *
+ * 				No head pointer is saved , it would cost a second write
+ * 				cycle per event & wear out its location. Instead every
+ * 				record carries a sequence number and the newest one is
+ * 				found once at start up.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "audit_log.h"
+#include "external_eeprom.h"
+#include <util/delay.h> /*To wait for the EEPROM write cycle*/
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static uint8  s_head = 0;	/*Slot of the next record to write*/
+static uint8  s_count = 0;	/*Number of records stored*/
+static uint16 s_nextSequence = 0;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static uint16 AUDIT_slotAddress(uint8 a_slot);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void AUDIT_init(void)
+{
+	AUDIT_RecordType record;
+	uint16 newestSequence = 0;
+	uint8 newestSlot = AUDIT_MAX_RECORDS; /*None found yet*/
+	uint8 slot;
+
+	s_count = 0;
+
+	for(slot = 0 ; slot < AUDIT_MAX_RECORDS ; slot++)
+	{
+		if(ERROR == EEPROM_readBlock(AUDIT_slotAddress(slot),(uint8 *)&record,AUDIT_RECORD_SIZE) ||
+		   AUDIT_EMPTY_SEQUENCE == record.sequence)
+		{
+			continue;
+		}
+
+		s_count++;
+
+		/*Serial number arithmetic , the sequence wraps around*/
+		if(AUDIT_MAX_RECORDS == newestSlot ||
+		   (uint16)(record.sequence - newestSequence) < 0x8000U)
+		{
+			newestSlot = slot;
+			newestSequence = record.sequence;
+		}
+	}
+
+	if(AUDIT_MAX_RECORDS == newestSlot)
+	{
+		/*Empty log*/
+		s_head = 0;
+		s_nextSequence = 0;
+	}
+	else
+	{
+		s_head = (newestSlot + 1) % AUDIT_MAX_RECORDS;
+		s_nextSequence = newestSequence + 1;
+		if(AUDIT_EMPTY_SEQUENCE == s_nextSequence)
+		{
+			s_nextSequence = 0;
+		}
+	}
+}
+
+void AUDIT_restore(const AUDIT_StateType * a_state)
+{
+	/*A broken state falls back to the scan*/
+	if(a_state->head >= AUDIT_MAX_RECORDS || a_state->count > AUDIT_MAX_RECORDS)
+	{
+		AUDIT_init();
+		return;
+	}
+	s_head = a_state->head;
+	s_count = a_state->count;
+	s_nextSequence = a_state->nextSequence;
+}
+
+void AUDIT_getState(AUDIT_StateType * a_state)
+{
+	a_state->nextSequence = s_nextSequence;
+	a_state->head = s_head;
+	a_state->count = s_count;
+}
+
+uint8 AUDIT_log(AUDIT_EventType a_event , uint8 a_userId , uint32 a_timestamp)
+{
+	AUDIT_RecordType record;
+
+	record.timestamp = a_timestamp;
+	record.sequence  = s_nextSequence;
+	record.event     = a_event;
+	record.userId    = a_userId;
+
+	/*The record is inside one page , one write cycle*/
+	if(ERROR == EEPROM_writePage(AUDIT_slotAddress(s_head),(const uint8 *)&record,AUDIT_RECORD_SIZE))
+	{
+		return ERROR;
+	}
+	_delay_ms(EEPROM_WRITE_CYCLE_TIME);
+
+	s_head = (s_head + 1) % AUDIT_MAX_RECORDS;
+
+	if(s_count < AUDIT_MAX_RECORDS)
+	{
+		s_count++;
+	}
+
+	/*Skip the value of an erased record*/
+	s_nextSequence++;
+	if(AUDIT_EMPTY_SEQUENCE == s_nextSequence)
+	{
+		s_nextSequence = 0;
+	}
+
+	return SUCCESS;
+}
+
+uint8 AUDIT_count(void)
+{
+	return s_count;
+}
+
+uint8 AUDIT_read(uint8 a_index , AUDIT_RecordType * a_records , uint8 * a_count)
+{
+	uint8 count = *a_count;
+	uint8 slot;
+	uint8 firstPart;
+
+	*a_count = 0;
+
+	if(a_index >= s_count)
+	{
+		return SUCCESS;
+	}
+	if(count > (s_count - a_index))
+	{
+		count = s_count - a_index;
+	}
+
+	/*Slot of the requested record counted from the oldest one*/
+	slot = (uint8)((s_head + AUDIT_MAX_RECORDS - s_count + a_index) % AUDIT_MAX_RECORDS);
+
+	/*One sequential read up to the end of the log area ,
+	 * a second one from its start if the records wrap around*/
+	firstPart = AUDIT_MAX_RECORDS - slot;
+	if(firstPart > count)
+	{
+		firstPart = count;
+	}
+
+	if(ERROR == EEPROM_readBlock(AUDIT_slotAddress(slot),(uint8 *)a_records,
+			(uint16)firstPart * AUDIT_RECORD_SIZE))
+	{
+		return ERROR;
+	}
+
+	if(count > firstPart &&
+	   ERROR == EEPROM_readBlock(AUDIT_LOG_ADDRESS,(uint8 *)&a_records[firstPart],
+			(uint16)(count - firstPart) * AUDIT_RECORD_SIZE))
+	{
+		return ERROR;
+	}
+
+	*a_count = count;
+	return SUCCESS;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+static uint16 AUDIT_slotAddress(uint8 a_slot)
+{
+	return AUDIT_LOG_ADDRESS + (uint16)a_slot * AUDIT_RECORD_SIZE;
+}
@@ -0,0 +1,101 @@
+/******************************************************************************
+ *
+ * Module: Audit Log
+ *
+ * File Name: audit_log.h
+ *
+ * Description: Header file for the persistent event log
+ * 				(circular buffer of fixed-size records inside the external EEPROM)
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef AUDIT_LOG_H_
+#define AUDIT_LOG_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Log location inside EEPROM : 128 records * 8 bytes = 0x0400 .. 0x07FF
+ * Records never cross an EEPROM page so each one is a single page write*/
+#define AUDIT_LOG_ADDRESS		0x0400
+#define AUDIT_RECORD_SIZE		8
+#define AUDIT_MAX_RECORDS		128
+
+/*Sequence value of an erased (empty) record*/
+#define AUDIT_EMPTY_SEQUENCE	0xFFFF
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef enum
+{
+	AUDIT_BOOT , AUDIT_UNLOCK , AUDIT_FAILED_ATTEMPT , AUDIT_LOCKOUT ,
+	AUDIT_PASSWORD_CHANGED , AUDIT_USER_ADDED , AUDIT_USER_REMOVED ,
+	AUDIT_ACCESS_DENIED , AUDIT_DOOR_FAULT , AUDIT_WATCHDOG_RESET ,
+	AUDIT_CLOCK_SET , AUDIT_USER_ACCESS
+}AUDIT_EventType;
+
+/*EEPROM record layout*/
+typedef struct
+{
+	uint32 timestamp;	/*RTC seconds since 1970 , seconds since boot (< 2000) if the RTC isn't set*/
+	uint16 sequence;	/*Incremented for every record , finds the newest one after reset*/
+	uint8  event;		/*AUDIT_EventType*/
+	uint8  userId;		/*USERS_NO_USER if not related to a user (overdue task of AUDIT_WATCHDOG_RESET)*/
+}AUDIT_RecordType;
+
+/*Position of the log kept in RAM , restored after a warm restart
+ * instead of scanning the log area again*/
+typedef struct
+{
+	uint16 nextSequence;
+	uint8  head;
+	uint8  count;
+}AUDIT_StateType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Scan the log area once and find
+ * the oldest & newest records from their sequence numbers*/
+void AUDIT_init(void);
+
+/* Description :
+ * Start from a state taken by AUDIT_getState before a reset
+ * instead of scanning the log area (AUDIT_init)*/
+void AUDIT_restore(const AUDIT_StateType * a_state);
+
+/* Description :
+ * Copy the position of the log into a_state*/
+void AUDIT_getState(AUDIT_StateType * a_state);
+
+/* Description :
+ * Append one record , overwriting the oldest one when the log is full
+ * Costs exactly one EEPROM page write , returns SUCCESS / ERROR*/
+uint8 AUDIT_log(AUDIT_EventType a_event , uint8 a_userId , uint32 a_timestamp);
+
+/* Description :
+ * Return the number of records stored*/
+uint8 AUDIT_count(void);
+
+/* Description :
+ * Copy *a_count records starting from a_index (0 = oldest) into a_records
+ * using sequential EEPROM reads , *a_count is set to the number of records
+ * copied (0 past the newest one) , returns SUCCESS / ERROR (nothing copied)*/
+uint8 AUDIT_read(uint8 a_index , AUDIT_RecordType * a_records , uint8 * a_count);
+
+#endif /* AUDIT_LOG_H_ */
@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ * Module: Driver Benchmark
+ *
+ * File Name: bench.h
+ *
+ * Description: Header file for the driver microbenchmarks
+ * 				(same file in both ECUs , the cases of each ECU are
+ * 				inside its bench_drivers.c)
+ *
+ * 				TIMER1 runs free at F_CPU so one count is one CPU cycle ,
+ * 				its overflows extend it to 32 bits. Every case is called
+ * 				a number of times & reported on the UART as one line :
+ *
+ * 				bench=<case> ecu=<ECU> calls=<n> min=<cycles> avg=<cycles> max=<cycles>
+ *
+ * 				then "bench=end ecu=<ECU>" once all the cases ran.
+ * 				The cost of an empty call is taken off every measure.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Build with -DDRIVER_BENCH=1 to run the benchmarks instead of the
+ * application (TIMER1 & the UART are taken by the benchmarks)*/
+#ifndef DRIVER_BENCH
+#define DRIVER_BENCH	0
+#endif
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef void (*BENCH_CaseType)(void);
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Start TIMER1 as the cycle counter & measure the cost of an empty call
+ * (the UART must be initialized , a_ecu names the ECU in the report)*/
+void BENCH_init(const char * a_ecu);
+
+/* Description :
+ * Call a_case a_calls times , measuring every call , and send its report line*/
+void BENCH_measure(const char * a_name , BENCH_CaseType a_case , uint16 a_calls);
+
+/* Description :
+ * Send the end line of the report & stop TIMER1*/
+void BENCH_end(void);
+
+/* Description :
+ * Run all the cases of the ECU (bench_drivers.c) , from BENCH_init to BENCH_end*/
+void BENCH_runDrivers(void);
+
+#endif /* BENCH_H_ */
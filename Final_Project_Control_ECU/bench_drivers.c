@@ -0,0 +1,143 @@
+/******************************************************************************
+ *
+ * Module: Driver Benchmark
+ *
+ * File Name: bench_drivers.c
+ *
+ * Description: Benchmark cases of the Control ECU :
+ * 				GPIO , UART , external EEPROM & the password verification
+ *
+ * 				The EEPROM cases use a byte of the free gap between the
+ * 				lockout state & the audit log and write back the value read ,
+ * 				the verification hit uses a temporary user in the last slot
+ * 				(only if it's free , it's removed afterwards).
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "bench.h"
+
+#if DRIVER_BENCH
+
+#include "gpio.h"
+#include "USART.h"
+#include "BUZZER.h"
+#include "external_eeprom.h"
+#include "user_table.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define BENCH_UART_BYTES		16
+
+/*Unused EEPROM byte (user schedules end at 0x03BF , audit log starts at 0x0400)*/
+#define BENCH_EEPROM_ADDRESS	0x03F0
+
+#define BENCH_USER_ID			(USERS_MAX_USERS - 1)
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static const uint8 s_uartData[BENCH_UART_BYTES] = "0123456789ABCDEF";
+
+static uint8 s_eepromValue = 0xFF;
+
+/*Code of the temporary user & a code nobody has*/
+static const uint8 s_userCode[USERS_CODE_LENGTH] = {9,0,2,1,7};
+static const uint8 s_unknownCode[USERS_CODE_LENGTH] = {3,1,4,1,5};
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void BENCH_gpioWritePin(void);
+static void BENCH_uartSendData(void);
+static void BENCH_eepromReadByte(void);
+static void BENCH_eepromWriteByte(void);
+static void BENCH_verifyHit(void);
+static void BENCH_verifyMiss(void);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+/* Description :
+ * Run all the cases of the ECU (bench_drivers.c) , from BENCH_init to BENCH_end*/
+void BENCH_runDrivers(void)
+{
+	boolean userAdded = FALSE;
+
+	Buzzer_init();
+	USERS_init();
+
+	BENCH_init("Control");
+
+	BENCH_measure("GPIO_writePin",&BENCH_gpioWritePin,100);
+	BENCH_measure("UART_sendData_16",&BENCH_uartSendData,4);
+	BENCH_measure("EEPROM_readByte",&BENCH_eepromReadByte,16);
+	BENCH_measure("EEPROM_writeByte",&BENCH_eepromWriteByte,4);
+
+	if(FALSE == USERS_exists(BENCH_USER_ID) &&
+	   USERS_OK == USERS_add(BENCH_USER_ID,s_userCode,USERS_PERM_DOOR,0,0))
+	{
+		userAdded = TRUE;
+		BENCH_measure("USERS_verify_hit",&BENCH_verifyHit,16);
+	}
+	BENCH_measure("USERS_verify_miss",&BENCH_verifyMiss,16);
+	if(userAdded)
+	{
+		USERS_remove(BENCH_USER_ID);
+	}
+
+	BENCH_end();
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+static void BENCH_gpioWritePin(void)
+{
+	/*Buzzer kept off*/
+	GPIO_writePin(BUZZER_PORT,BUZZER_PIN,LOGIC_LOW);
+}
+
+static void BENCH_uartSendData(void)
+{
+	UART_sendData(s_uartData,BENCH_UART_BYTES);
+}
+
+static void BENCH_eepromReadByte(void)
+{
+	EEPROM_readByte(BENCH_EEPROM_ADDRESS,&s_eepromValue);
+}
+
+static void BENCH_eepromWriteByte(void)
+{
+	EEPROM_writeByte(BENCH_EEPROM_ADDRESS,s_eepromValue);
+}
+
+static void BENCH_verifyHit(void)
+{
+	uint8 id;
+
+	USERS_verify(s_userCode,USERS_TIME_UNKNOWN,&id);
+}
+
+static void BENCH_verifyMiss(void)
+{
+	uint8 id;
+
+	USERS_verify(s_unknownCode,USERS_TIME_UNKNOWN,&id);
+}
+
+#endif /* DRIVER_BENCH */
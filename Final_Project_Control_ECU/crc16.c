@@ -0,0 +1,41 @@
+/******************************************************************************
+ *
+ * Module: CRC16
+ *
+ * File Name: crc16.c
+ *
+ * Description: Source file for the CRC-16/CCITT calculation
+ * 				(polynomial 0x1021 , initial value 0xFFFF)
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#include "crc16.h"
+
+uint16 CRC16_update(uint16 a_crc , const uint8 * a_data , uint8 a_length)
+{
+	uint8 byte;
+	uint8 bit;
+
+	for(byte = 0 ; byte < a_length ; byte++)
+	{
+		a_crc ^= (uint16)a_data[byte] << 8;
+
+		/*Bit-wise version , no 512 bytes table in the flash*/
+		for(bit = 0 ; bit < 8 ; bit++)
+		{
+			if(a_crc & 0x8000)
+			{
+				a_crc = (a_crc << 1) ^ 0x1021;
+			}
+			else
+			{
+				a_crc <<= 1;
+			}
+		}
+	}
+	return a_crc;
+}
@@ -0,0 +1,223 @@
+/******************************************************************************
+ *
+ * Module: Current Sense
+ *
+ * File Name: current_sense.c
+ *
+ * Description: Source file for the door motor current sensing
+ * 				(ADC sampling , filtering , end-stop & stall detection)
+ *
+ * 				The ADC runs free & every sample goes through :
+ * 				decimation (block average of 16) -> moving average of 8
+ * 				-> slope detector (end-stop) & level detector (stall)
+ * 				The ISR only does additions & shifts , no division.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "current_sense.h"
+#include "ADC.h"
+#include "door_position.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+/*Decimation*/
+static uint16 s_accumulator = 0;
+static uint8  s_decimationCount = 0;
+
+/*Moving average window of decimated samples*/
+static uint16 s_window[CURRENT_AVERAGE_LENGTH];
+static uint8  s_windowIndex = 0;
+static uint16 s_windowSum = 0;
+static volatile uint16 s_filtered = 0;
+
+/*Detectors*/
+static uint16 s_blanking = 0;
+static uint8  s_stallCount = 0;
+static boolean s_endStopPending = FALSE;
+static volatile boolean s_armed = FALSE;
+
+static void (* volatile s_callBackPtr)(CURRENT_EventType) = NULL_PTR;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void CURRENT_sample(uint16 a_sample);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void CURRENT_init(void)
+{
+   /***************** ADC Settings ****************
+	*  Reference Voltage  = AVCC
+	*  Pre-Scalar 		  = F_CPU/128 (62.5 KHz)
+	*************************************************/
+	ADC_ConfigType s_ADCconfig = {AVCC,ADC_FCPU_128};
+
+	ADC_init(&s_ADCconfig);
+
+	ADC_setCallBack(&CURRENT_sample);
+}
+
+void CURRENT_start(void)
+{
+	uint8 i;
+
+	ADC_stop();
+
+	/*Start from an empty filter , the blanking time is longer than
+	 * the window so the detectors only see a full window*/
+	s_accumulator = 0;
+	s_decimationCount = 0;
+	for(i = 0 ; i < CURRENT_AVERAGE_LENGTH ; i++)
+	{
+		s_window[i] = 0;
+	}
+	s_windowIndex = 0;
+	s_windowSum = 0;
+	s_filtered = 0;
+
+	s_blanking = CURRENT_BLANKING_TIME;
+	s_stallCount = 0;
+	s_endStopPending = FALSE;
+	s_armed = TRUE;
+
+	ADC_startFreeRunning(CURRENT_ADC_CHANNEL);
+}
+
+void CURRENT_stop(void)
+{
+	s_armed = FALSE;
+	ADC_stop();
+}
+
+uint16 CURRENT_getFiltered(void)
+{
+	uint16 filtered;
+
+	/*Updated by the ADC ISR , read again until two reads agree*/
+	do
+	{
+		filtered = s_filtered;
+	}while(filtered != s_filtered);
+
+	return filtered;
+}
+
+void CURRENT_setCallBack(void(*a_ptr)(CURRENT_EventType))
+{
+	s_callBackPtr = a_ptr;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Called by the ADC ISR with every conversion result*/
+static void CURRENT_sample(uint16 a_sample)
+{
+	uint16 decimated;
+	uint16 oldest;
+	CURRENT_EventType event = CURRENT_NO_EVENT;
+
+	s_accumulator += a_sample;
+
+	if(++s_decimationCount < CURRENT_DECIMATION)
+	{
+		return;
+	}
+
+	decimated = s_accumulator >> CURRENT_DECIMATION_SHIFT;
+	s_accumulator = 0;
+	s_decimationCount = 0;
+
+	/*Running sum : add the new sample , remove the one leaving the window*/
+	oldest = s_window[s_windowIndex];
+	s_window[s_windowIndex] = decimated;
+	s_windowIndex = (s_windowIndex + 1) & (CURRENT_AVERAGE_LENGTH - 1);
+	s_windowSum = s_windowSum + decimated - oldest;
+	s_filtered = s_windowSum >> CURRENT_AVERAGE_SHIFT;
+
+	if(FALSE == s_armed)
+	{
+		return;
+	}
+
+	/*Ignore the inrush current of the motor start*/
+	if(0 != s_blanking)
+	{
+		s_blanking--;
+		return;
+	}
+
+	/*Level detector : current held at the stall level*/
+	if(s_filtered >= CURRENT_STALL_LEVEL)
+	{
+		if(++s_stallCount >= CURRENT_STALL_TIME)
+		{
+			event = CURRENT_STALL;
+		}
+	}
+	else
+	{
+		s_stallCount = 0;
+	}
+
+	/*Rise held away from the ends : a jam still rising past the stall level
+	 * is a stall at once , a settled current is an end-stop only if the
+	 * bolt reached its end meanwhile*/
+	if(CURRENT_NO_EVENT == event && s_endStopPending)
+	{
+		if(s_filtered >= CURRENT_STALL_LEVEL)
+		{
+			event = CURRENT_STALL;
+		}
+		else if(decimated <= oldest + CURRENT_SETTLED_SLOPE)
+		{
+			s_endStopPending = FALSE;
+			if(POSITION_isAtEnd())
+			{
+				event = CURRENT_END_STOP;
+			}
+		}
+	}
+
+	/*Slope detector : sharp rise when the bolt hits its end-stop*/
+	if(CURRENT_NO_EVENT == event && FALSE == s_endStopPending &&
+	   decimated > oldest + CURRENT_END_STOP_SLOPE &&
+	   s_filtered >= CURRENT_END_STOP_LEVEL)
+	{
+		if(POSITION_isAtEnd())
+		{
+			event = CURRENT_END_STOP;
+		}
+		else
+		{
+			s_endStopPending = TRUE;
+		}
+	}
+
+	if(CURRENT_NO_EVENT != event)
+	{
+		/*Report the first event only*/
+		s_armed = FALSE;
+
+		if(NULL_PTR != s_callBackPtr)
+		{
+			s_callBackPtr(event);
+		}
+	}
+}
@@ -0,0 +1,92 @@
+/******************************************************************************
+ *
+ * Module: Current Sense
+ *
+ * File Name: current_sense.h
+ *
+ * Description: Header file for the door motor current sensing
+ * 				(ADC sampling , filtering , end-stop & stall detection)
+ *
+ * 				A sharp rise is only an end-stop where the position module
+ * 				sees the bolt at its end , elsewhere (a jam) the decision waits
+ * 				for the current to settle & a current still rising past the
+ * 				stall level is reported as a stall.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef CURRENT_SENSE_H_
+#define CURRENT_SENSE_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Shunt voltage of the H-bridge on ADC0 (PA0)*/
+#define CURRENT_ADC_CHANNEL			0
+
+/*ADC clock F_CPU/128 = 62.5 KHz , 13 clocks per conversion = 4.8 KHz ,
+ * averaged by blocks of 16 samples = 300 Hz filtered sample rate*/
+#define CURRENT_DECIMATION			16
+#define CURRENT_DECIMATION_SHIFT	4
+
+/*Moving average length (filtered samples , power of two)*/
+#define CURRENT_AVERAGE_LENGTH		8
+#define CURRENT_AVERAGE_SHIFT		3
+
+/*Thresholds in ADC counts , with a 0.5 ohm shunt & AVCC = 5 V
+ * one count is 9.8 mA*/
+#define CURRENT_END_STOP_LEVEL		200	/*Current level the end-stop rise must reach*/
+#define CURRENT_END_STOP_SLOPE		40	/*Rise across the averaging window (27 ms)*/
+#define CURRENT_STALL_LEVEL			400	/*Stalled motor current*/
+#define CURRENT_SETTLED_SLOPE		8	/*Rise across the window of a settled current*/
+
+/*Times in filtered samples (300 per second)*/
+#define CURRENT_STALL_TIME			90	/*300 ms above the stall level*/
+#define CURRENT_BLANKING_TIME		150	/*500 ms of start-up (inrush) ignored*/
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef enum
+{
+	CURRENT_NO_EVENT , CURRENT_END_STOP , CURRENT_STALL
+}CURRENT_EventType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Initialize the ADC for the current sense input*/
+void CURRENT_init(void);
+
+/* Description :
+ * Start sampling & arm the detectors after the blanking time ,
+ * called when the motor starts a movement*/
+void CURRENT_start(void);
+
+/* Description :
+ * Stop sampling (motor not moving)*/
+void CURRENT_stop(void);
+
+/* Description :
+ * Return the filtered current in ADC counts*/
+uint16 CURRENT_getFiltered(void);
+
+/* Description :
+ * Sent the address of the function called (from the ADC ISR) with the
+ * first event detected after CURRENT_start , the detectors are then disarmed*/
+void CURRENT_setCallBack(void(*a_ptr)(CURRENT_EventType));
+
+#endif /* CURRENT_SENSE_H_ */
@@ -0,0 +1,130 @@
+/******************************************************************************
+ *
+ * Module: Deferred Work
+ *
+ * File Name: deferred_work.c
+ *
+ * Description: Source file for the deferred work queue
+ *
+ * 				Ring buffer of call backs , the producer (ISRs) only writes
+ * 				s_head & the consumer (main loop) only writes s_tail. Both
+ * 				indexes are single bytes so they are read & written
+ * 				atomically , an item is stored before s_head is moved on
+ * 				so the main loop never sees a half written pointer.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#include "deferred_work.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static void (* volatile s_queue[WORK_QUEUE_SIZE])(void);
+
+/*Free running indexes , the difference is the number of waiting items*/
+static volatile uint8 s_head = 0;		/*Written by the ISRs*/
+static volatile uint8 s_tail = 0;		/*Written by the main loop*/
+
+/*Written by the ISRs only*/
+static volatile uint32 s_posted = 0;
+static volatile uint16 s_dropped = 0;
+static volatile uint8 s_maxDepth = 0;
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+/* Description :
+ * Queue a_work to be run by the main loop (WORK_run)
+ * Called from the ISRs (or with the interrupts disabled)
+ * Returns FALSE if the queue is full , the item is lost*/
+boolean WORK_post(void(*a_work)(void))
+{
+	uint8 head = s_head;
+	uint8 depth = (uint8)(head - s_tail);
+
+	if(depth >= WORK_QUEUE_SIZE)
+	{
+		s_dropped++;
+		return FALSE;
+	}
+
+	s_queue[head & (WORK_QUEUE_SIZE - 1)] = a_work;
+
+	/*Publish the item last*/
+	s_head = head + 1;
+
+	s_posted++;
+	if(depth + 1 > s_maxDepth)
+	{
+		s_maxDepth = depth + 1;
+	}
+	return TRUE;
+}
+
+/* Description :
+ * Run every queued item , the items posted meanwhile included
+ * Called from the main loop only*/
+void WORK_run(void)
+{
+	uint8 tail = s_tail;
+	void (*work)(void);
+
+	while(tail != s_head)
+	{
+		work = s_queue[tail & (WORK_QUEUE_SIZE - 1)];
+
+		/*Free the place before running the item so it can post again*/
+		tail++;
+		s_tail = tail;
+
+		work();
+	}
+}
+
+/* Description :
+ * Return TRUE if no item is waiting*/
+boolean WORK_isEmpty(void)
+{
+	return (s_head == s_tail) ? TRUE : FALSE;
+}
+
+/* Description :
+ * Copy the queue statistics into a_stats*/
+void WORK_getStats(WORK_StatsType * a_stats)
+{
+	uint8 sreg = SREG;
+
+	/*One consistent snapshot , the ISRs update the counters*/
+	cli();
+	a_stats->posted = s_posted;
+	a_stats->dropped = s_dropped;
+	a_stats->depth = (uint8)(s_head - s_tail);
+	a_stats->maxDepth = s_maxDepth;
+	SREG = sreg;
+}
+
+/* Description :
+ * Clear the counters & the high-water mark*/
+void WORK_resetStats(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	s_posted = 0;
+	s_dropped = 0;
+	s_maxDepth = 0;
+	SREG = sreg;
+}
@@ -0,0 +1,81 @@
+/******************************************************************************
+ *
+ * Module: Deferred Work
+ *
+ * File Name: deferred_work.h
+ *
+ * Description: Header file for the deferred work queue
+ * 				(work posted by the ISRs & run by the main loop)
+ *
+ * 				An ISR only does the time critical part of its job (stop the
+ * 				motor , count a pulse , ...) & posts the slow part (UART
+ * 				frames , EEPROM writes) as a work item , the main loop runs
+ * 				the items in the posting order with the interrupts enabled.
+ *
+ * 				The ISRs don't nest so they are one producer , the main loop
+ * 				is the only consumer : the queue needs no locking.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef DEFERRED_WORK_H_
+#define DEFERRED_WORK_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Work items waiting at the same time (power of two , at most 128)*/
+#define WORK_QUEUE_SIZE		8
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+/*Queue statistics , 32-bit member first so the layout is
+ * the same with or without structure packing*/
+typedef struct
+{
+	uint32 posted;			/*Items posted since the last reset*/
+	uint16 dropped;			/*Items lost on a full queue*/
+	uint8 depth;			/*Items waiting right now*/
+	uint8 maxDepth;			/*Most items waiting at the same time*/
+}WORK_StatsType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Queue a_work to be run by the main loop (WORK_run)
+ * Called from the ISRs (or with the interrupts disabled)
+ * Returns FALSE if the queue is full , the item is lost*/
+boolean WORK_post(void(*a_work)(void));
+
+/* Description :
+ * Run every queued item , the items posted meanwhile included
+ * Called from the main loop only*/
+void WORK_run(void);
+
+/* Description :
+ * Return TRUE if no item is waiting*/
+boolean WORK_isEmpty(void);
+
+/* Description :
+ * Copy the queue statistics into a_stats*/
+void WORK_getStats(WORK_StatsType * a_stats);
+
+/* Description :
+ * Clear the counters & the high-water mark*/
+void WORK_resetStats(void);
+
+#endif /* DEFERRED_WORK_H_ */
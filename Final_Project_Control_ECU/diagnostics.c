@@ -0,0 +1,247 @@
+/******************************************************************************
+ *
+ * Module: Diagnostics
+ *
+ * File Name: diagnostics.c
+ *
+ * Description: Source file for the CPU load & interrupt timing measures
+ * 				(same file in both ECUs)
+ *
+ * 				The ISRs don't nest , one entry timestamp is enough.
+ * 				Idle time is counted in TIMER1 counts & can't last longer
+ * 				than one TIMER1 period (its ISR ends it).
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "TIMER1.h"
+#include "stack_monitor.h"
+
+#include "diagnostics.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+/*timerPeriod = 0 until DIAG_init , every hook returns at once*/
+static DIAG_ConfigType s_config = {0,0,0};
+
+/*High-water marks in TIMER1 counts*/
+static volatile uint32 s_counts[DIAG_ISR_COUNT];
+static volatile uint16 s_maxLatency[DIAG_ISR_COUNT];
+static volatile uint16 s_maxDuration[DIAG_ISR_COUNT];
+
+static volatile uint16 s_isrEntry = 0;
+
+static volatile boolean s_idle = FALSE;
+static volatile uint16 s_idleStart = 0;
+static volatile uint32 s_idleCounts = 0;	/*Since the last sample*/
+
+static volatile uint8 s_load = 0;
+static volatile uint8 s_maxLoad = 0;
+static volatile uint32 s_loadSum = 0;
+static volatile uint32 s_samples = 0;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static uint16 DIAG_elapsed(uint16 a_from , uint16 a_to);
+static uint16 DIAG_toMicroseconds(uint16 a_counts);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+/* Description :
+ * Start the measures , TIMER1 must run the system tick in CTC mode*/
+void DIAG_init(const DIAG_ConfigType * Config_Ptr)
+{
+	DIAG_reset();
+	s_config = *Config_Ptr;
+}
+
+/* Description :
+ * First statement of an ISR*/
+void DIAG_isrEnter(DIAG_IsrId a_isr)
+{
+	uint16 now;
+
+	if(0 == s_config.timerPeriod)
+	{
+		return;
+	}
+
+	now = Timer1_getCount();
+
+	/*The ISR ends the idle time of the main loop*/
+	if(s_idle)
+	{
+		s_idleCounts += DIAG_elapsed(s_idleStart,now);
+		s_idle = FALSE;
+	}
+
+	if(DIAG_ISR_TIMER1 == a_isr && now > s_maxLatency[a_isr])
+	{
+		s_maxLatency[a_isr] = now;
+	}
+	s_counts[a_isr]++;
+	s_isrEntry = now;
+}
+
+/* Description :
+ * Last statement of an ISR*/
+void DIAG_isrExit(DIAG_IsrId a_isr)
+{
+	uint16 duration;
+
+	if(0 == s_config.timerPeriod)
+	{
+		return;
+	}
+
+	duration = DIAG_elapsed(s_isrEntry,Timer1_getCount());
+	if(duration > s_maxDuration[a_isr])
+	{
+		s_maxDuration[a_isr] = duration;
+	}
+}
+
+/* Description :
+ * The main loop has nothing to do , idle time runs until the next ISR
+ * or DIAG_idleExit (calling it again while idle changes nothing)*/
+void DIAG_idleEnter(void)
+{
+	if(0 == s_config.timerPeriod || s_idle)
+	{
+		return;
+	}
+
+	/*Start time first , an ISR only reads it once the flag is set*/
+	s_idleStart = Timer1_getCount();
+	s_idle = TRUE;
+}
+
+/* Description :
+ * The main loop has work again*/
+void DIAG_idleExit(void)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	if(s_idle)
+	{
+		s_idleCounts += DIAG_elapsed(s_idleStart,Timer1_getCount());
+		s_idle = FALSE;
+	}
+	SREG = sreg;
+}
+
+/* Description :
+ * Compute the CPU load of the period since the previous call ,
+ * called every samplePeriods TIMER1 periods (from the system tick)*/
+void DIAG_sample(void)
+{
+	uint32 total = (uint32)s_config.timerPeriod * s_config.samplePeriods;
+	uint32 idle = s_idleCounts;
+
+	if(0 == total)
+	{
+		return;
+	}
+
+	s_idleCounts = 0;
+	if(idle > total)
+	{
+		idle = total;
+	}
+	s_load = 100 - (uint8)((idle * 100UL) / total);
+
+	if(s_load > s_maxLoad)
+	{
+		s_maxLoad = s_load;
+	}
+	s_loadSum += s_load;
+	s_samples++;
+}
+
+/* Description :
+ * Copy the measures (in us & %) & the stack usage into a_report*/
+void DIAG_getReport(DIAG_ReportType * a_report)
+{
+	uint8 sreg = SREG;
+	uint8 isr;
+
+	/*One consistent snapshot , the ISRs update the measures*/
+	cli();
+	for(isr = 0 ; isr < DIAG_ISR_COUNT ; isr++)
+	{
+		a_report->isr[isr].count = s_counts[isr];
+		a_report->isr[isr].maxLatency = s_maxLatency[isr];
+		a_report->isr[isr].maxDuration = s_maxDuration[isr];
+	}
+	a_report->samples = s_samples;
+	a_report->load = s_load;
+	a_report->maxLoad = s_maxLoad;
+	a_report->averageLoad = (0 != s_samples) ? (uint8)(s_loadSum / s_samples) : 0;
+	a_report->reserved = 0;
+	SREG = sreg;
+
+	for(isr = 0 ; isr < DIAG_ISR_COUNT ; isr++)
+	{
+		a_report->isr[isr].maxLatency = DIAG_toMicroseconds(a_report->isr[isr].maxLatency);
+		a_report->isr[isr].maxDuration = DIAG_toMicroseconds(a_report->isr[isr].maxDuration);
+	}
+
+	a_report->stackHeadroom = STACK_getHeadroom();
+	a_report->stackFree = STACK_getFree();
+}
+
+/* Description :
+ * Clear the counters & the high-water marks*/
+void DIAG_reset(void)
+{
+	uint8 sreg = SREG;
+	uint8 isr;
+
+	cli();
+	for(isr = 0 ; isr < DIAG_ISR_COUNT ; isr++)
+	{
+		s_counts[isr] = 0;
+		s_maxLatency[isr] = 0;
+		s_maxDuration[isr] = 0;
+	}
+	s_load = 0;
+	s_maxLoad = 0;
+	s_loadSum = 0;
+	s_samples = 0;
+	SREG = sreg;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * TIMER1 counts from a_from to a_to , the counter may have been
+ * cleared by the compare match once in between*/
+static uint16 DIAG_elapsed(uint16 a_from , uint16 a_to)
+{
+	return (a_to >= a_from) ? a_to - a_from : (s_config.timerPeriod - a_from) + a_to;
+}
+
+static uint16 DIAG_toMicroseconds(uint16 a_counts)
+{
+	uint32 time = ((uint32)a_counts * s_config.countTime) / 1000UL;
+
+	return (time > 0xFFFF) ? 0xFFFF : (uint16)time;
+}
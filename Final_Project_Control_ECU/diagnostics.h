@@ -0,0 +1,112 @@
+/******************************************************************************
+ *
+ * Module: Diagnostics
+ *
+ * File Name: diagnostics.h
+ *
+ * Description: Header file for the CPU load & interrupt timing measures
+ * 				(same file in both ECUs , the drivers call the ISR hooks)
+ *
+ * 				Timestamps are the TIMER1 counter running the system tick
+ * 				(CTC , cleared by the compare match). The time between the
+ * 				idle hook & the next ISR entry is idle time , the compare
+ * 				match clears the counter so its value at the entry of the
+ * 				TIMER1 ISR is the latency of that ISR (also the longest
+ * 				time the interrupts were held off by the other ISRs or
+ * 				the masked sections of the main loop).
+ *
+ * 				Nothing is measured until DIAG_init is called , the
+ * 				resolution is one TIMER1 count (8 us at F_CPU/64).
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef DIAGNOSTICS_H_
+#define DIAGNOSTICS_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+/*Instrumented interrupts (TWI is polled , it has no ISR)*/
+typedef enum
+{
+	DIAG_ISR_TIMER1 , DIAG_ISR_USART_UDRE , DIAG_ISR_USART_RXC , DIAG_ISR_ADC , DIAG_ISR_INT0 , DIAG_ISR_COUNT
+}DIAG_IsrId;
+
+typedef struct
+{
+	uint16 timerPeriod;		/*TIMER1 counts between two compare matches*/
+	uint16 countTime;		/*ns per TIMER1 count*/
+	uint16 samplePeriods;	/*TIMER1 periods between two DIAG_sample calls*/
+}DIAG_ConfigType;
+
+/*Report layout , 32-bit members first so the layout is
+ * the same with or without structure packing*/
+typedef struct
+{
+	uint32 count;			/*Entries since the last reset*/
+	uint16 maxLatency;		/*us from the compare match to the entry (TIMER1 only)*/
+	uint16 maxDuration;		/*us from the entry to the exit*/
+}DIAG_IsrStatsType;
+
+typedef struct
+{
+	DIAG_IsrStatsType isr[DIAG_ISR_COUNT];
+	uint32 samples;			/*Load samples since the last reset*/
+	uint16 stackHeadroom;	/*Bytes of RAM the stack never reached since reset*/
+	uint16 stackFree;		/*Bytes of RAM below the stack pointer right now*/
+	uint8 load;				/*CPU load of the last sample (%)*/
+	uint8 maxLoad;			/*Highest sample since the last reset (%)*/
+	uint8 averageLoad;		/*Average since the last reset (%)*/
+	uint8 reserved;
+}DIAG_ReportType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Start the measures , TIMER1 must run the system tick in CTC mode*/
+void DIAG_init(const DIAG_ConfigType * Config_Ptr);
+
+/* Description :
+ * First statement of an ISR*/
+void DIAG_isrEnter(DIAG_IsrId a_isr);
+
+/* Description :
+ * Last statement of an ISR*/
+void DIAG_isrExit(DIAG_IsrId a_isr);
+
+/* Description :
+ * The main loop has nothing to do , idle time runs until the next ISR
+ * or DIAG_idleExit (calling it again while idle changes nothing)*/
+void DIAG_idleEnter(void);
+
+/* Description :
+ * The main loop has work again*/
+void DIAG_idleExit(void);
+
+/* Description :
+ * Compute the CPU load of the period since the previous call ,
+ * called every samplePeriods TIMER1 periods (from the system tick)*/
+void DIAG_sample(void);
+
+/* Description :
+ * Copy the measures (in us & %) & the stack usage into a_report*/
+void DIAG_getReport(DIAG_ReportType * a_report);
+
+/* Description :
+ * Clear the counters & the high-water marks*/
+void DIAG_reset(void);
+
+#endif /* DIAGNOSTICS_H_ */
@@ -0,0 +1,248 @@
+/******************************************************************************
+ *
+ * Module: Door Position
+ *
+ * File Name: door_position.c
+ *
+ * Description: Source file for the door bolt position tracking
+ * 				(encoder pulses on INT0 & debounced limit switches)
+ *
+ * 				The limit switches are the reference , they reset the pulse
+ * 				count at each end so counting errors never add up.
+ * 				The pulse count alone only ends a movement if pulses were
+ * 				seen during it , so a missing encoder can't end a phase.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "common_macros.h"
+#include "gpio.h"
+#include "diagnostics.h"
+
+#include "door_position.h"
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef struct
+{
+	uint8 port;
+	uint8 pin;
+	uint8 stable;		/*Debounced state , TRUE = pressed*/
+	uint8 count;		/*Successive reads different from the stable state*/
+}POSITION_SwitchType;
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static volatile sint16 s_pulses = 0;
+
+/*Pulses of the current movement , written by the INT0 ISR only*/
+static volatile uint16 s_movePulses = 0;
+
+/*+1 opening , -1 closing , 0 not moving*/
+static volatile sint8 s_direction = 0;
+
+static volatile POSITION_TargetType s_target = POSITION_NO_TARGET;
+
+static POSITION_SwitchType s_openLimit =
+	{POSITION_OPEN_LIMIT_PORT,POSITION_OPEN_LIMIT_PIN,FALSE,0};
+static POSITION_SwitchType s_closedLimit =
+	{POSITION_CLOSED_LIMIT_PORT,POSITION_CLOSED_LIMIT_PIN,FALSE,0};
+
+static void (* volatile s_callBackPtr)(void) = NULL_PTR;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void POSITION_debounce(POSITION_SwitchType * a_switch);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void POSITION_init(void)
+{
+	/*Inputs with pull-ups*/
+	GPIO_setupPinDirection(POSITION_ENCODER_PORT,POSITION_ENCODER_PIN,PIN_INPUT);
+	GPIO_writePin(POSITION_ENCODER_PORT,POSITION_ENCODER_PIN,LOGIC_HIGH);
+
+	GPIO_setupPinDirection(POSITION_OPEN_LIMIT_PORT,POSITION_OPEN_LIMIT_PIN,PIN_INPUT);
+	GPIO_writePin(POSITION_OPEN_LIMIT_PORT,POSITION_OPEN_LIMIT_PIN,LOGIC_HIGH);
+
+	GPIO_setupPinDirection(POSITION_CLOSED_LIMIT_PORT,POSITION_CLOSED_LIMIT_PIN,PIN_INPUT);
+	GPIO_writePin(POSITION_CLOSED_LIMIT_PORT,POSITION_CLOSED_LIMIT_PIN,LOGIC_HIGH);
+
+	s_pulses = 0;
+	s_direction = 0;
+	s_target = POSITION_NO_TARGET;
+
+   /*************************************************
+	***************** MCUCR / GICR Settings *********
+	*  ISC01:0 = 3 INT0 on rising edge
+	*  INT0    = 1 Enable external interrupt 0
+	*************************************************/
+	MCUCR |= (1<<ISC01) | (1<<ISC00);
+	GICR  |= (1<<INT0);
+
+	/*Enable global interrupts*/
+	SET_BIT(SREG,7);
+}
+
+void POSITION_setTarget(POSITION_TargetType a_target)
+{
+	/*Stop counting while the movement settings change*/
+	s_direction = 0;
+	s_movePulses = 0;
+	s_target = a_target;
+
+	if(POSITION_OPEN == a_target)
+	{
+		s_direction = 1;
+	}
+	else if(POSITION_CLOSED == a_target)
+	{
+		s_direction = -1;
+	}
+}
+
+sint16 POSITION_getPulses(void)
+{
+	sint16 pulses;
+
+	/*Updated by the INT0 ISR , read again until two reads agree*/
+	do
+	{
+		pulses = s_pulses;
+	}while(pulses != s_pulses);
+
+	return pulses;
+}
+
+boolean POSITION_isOpen(void)
+{
+	return s_openLimit.stable;
+}
+
+boolean POSITION_isClosed(void)
+{
+	return s_closedLimit.stable;
+}
+
+boolean POSITION_isAtEnd(void)
+{
+	/*Also called from the ADC ISR , one read of each shared variable*/
+	POSITION_TargetType target = s_target;
+	sint16 pulses = POSITION_getPulses();
+
+	if(POSITION_OPEN == target)
+	{
+		return s_openLimit.stable || pulses >= (POSITION_TRAVEL_PULSES - POSITION_END_WINDOW);
+	}
+	else if(POSITION_CLOSED == target)
+	{
+		return s_closedLimit.stable || pulses <= POSITION_END_WINDOW;
+	}
+
+	return FALSE;
+}
+
+void POSITION_update(void)
+{
+	boolean reached = FALSE;
+	sint16 pulses;
+
+	POSITION_debounce(&s_openLimit);
+	POSITION_debounce(&s_closedLimit);
+
+	/*The limit switches are the reference of the pulse count
+	 * (this ISR isn't interrupted by INT0 so the writes are safe)*/
+	if(s_closedLimit.stable)
+	{
+		s_pulses = 0;
+	}
+	else if(s_openLimit.stable)
+	{
+		s_pulses = POSITION_TRAVEL_PULSES;
+	}
+	pulses = s_pulses;
+
+	if(POSITION_OPEN == s_target)
+	{
+		reached = s_openLimit.stable ||
+				(0 != s_movePulses && pulses >= POSITION_TRAVEL_PULSES);
+	}
+	else if(POSITION_CLOSED == s_target)
+	{
+		reached = s_closedLimit.stable ||
+				(0 != s_movePulses && pulses <= 0);
+	}
+
+	if(reached)
+	{
+		/*Report once , the door sequence sets the next target*/
+		s_target = POSITION_NO_TARGET;
+
+		if(NULL_PTR != s_callBackPtr)
+		{
+			s_callBackPtr();
+		}
+	}
+}
+
+void POSITION_setCallBack(void(*a_ptr)(void))
+{
+	s_callBackPtr = a_ptr;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Accept a new switch state only after POSITION_DEBOUNCE_COUNT equal reads*/
+static void POSITION_debounce(POSITION_SwitchType * a_switch)
+{
+	/*Active low*/
+	uint8 pressed = (LOGIC_LOW == GPIO_readPin(a_switch->port,a_switch->pin)) ? TRUE : FALSE;
+
+	if(pressed == a_switch->stable)
+	{
+		a_switch->count = 0;
+	}
+	else if(++a_switch->count >= POSITION_DEBOUNCE_COUNT)
+	{
+		a_switch->stable = pressed;
+		a_switch->count = 0;
+	}
+}
+
+/*******************************************************************************
+ *                                ISR Definitions 	                           *
+ *******************************************************************************/
+
+ISR(INT0_vect)
+{
+	DIAG_isrEnter(DIAG_ISR_INT0);
+
+	s_pulses += s_direction;
+
+	if(0 != s_direction)
+	{
+		s_movePulses++;
+	}
+
+	DIAG_isrExit(DIAG_ISR_INT0);
+}
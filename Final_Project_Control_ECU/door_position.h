@@ -0,0 +1,103 @@
+/******************************************************************************
+ *
+ * Module: Door Position
+ *
+ * File Name: door_position.h
+ *
+ * Description: Header file for the door bolt position tracking
+ * 				(encoder pulses on INT0 & debounced limit switches)
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef DOOR_POSITION_H_
+#define DOOR_POSITION_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Motor shaft encoder (single channel) on INT0 (PD2) , counted on rising edges ,
+ * the direction comes from the motor command*/
+#define POSITION_ENCODER_PORT		PORTD_ID
+#define POSITION_ENCODER_PIN		PIN2_ID
+
+/*Limit switches , active low with internal pull-ups
+ * (not fitted = never active)*/
+#define POSITION_OPEN_LIMIT_PORT	PORTD_ID
+#define POSITION_OPEN_LIMIT_PIN		PIN4_ID
+#define POSITION_CLOSED_LIMIT_PORT	PORTD_ID
+#define POSITION_CLOSED_LIMIT_PIN	PIN5_ID
+
+/*Encoder pulses of the full bolt travel (closed = 0)*/
+#define POSITION_TRAVEL_PULSES		600
+
+/*Pulses before the target end where the bolt is taken as at its end
+ * (end-stop current accepted , 5% of the travel)*/
+#define POSITION_END_WINDOW			30
+
+/*A switch must read the same for this number of POSITION_update calls*/
+#define POSITION_DEBOUNCE_COUNT		3
+
+/*Period of POSITION_update() calls in ms (one system tick)*/
+#define POSITION_UPDATE_PERIOD		10
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+/*Movement target (same order as DOOR_MotorCommand)*/
+typedef enum
+{
+	POSITION_NO_TARGET , POSITION_OPEN , POSITION_CLOSED
+}POSITION_TargetType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Setup the encoder interrupt & the limit switch inputs ,
+ * the bolt is assumed closed at power up until a limit switch says otherwise*/
+void POSITION_init(void);
+
+/* Description :
+ * Set the end the bolt is moving to , the pulses are counted towards it
+ * & the call back is called once when it is reached*/
+void POSITION_setTarget(POSITION_TargetType a_target);
+
+/* Description :
+ * Return the bolt position in encoder pulses (0 = closed)*/
+sint16 POSITION_getPulses(void);
+
+/* Description :
+ * Return the debounced state of the limit switches*/
+boolean POSITION_isOpen(void);
+boolean POSITION_isClosed(void);
+
+/* Description :
+ * Return TRUE if the bolt is within POSITION_END_WINDOW pulses of the target
+ * end or its limit switch is closed (FALSE without a target)*/
+boolean POSITION_isAtEnd(void);
+
+/* Description :
+ * Debounce the limit switches , correct the pulse count at the ends &
+ * check the target , must be called every POSITION_UPDATE_PERIOD ms
+ * from a timer ISR*/
+void POSITION_update(void);
+
+/* Description :
+ * Sent the address of the function called (from POSITION_update)
+ * when the target end is reached*/
+void POSITION_setCallBack(void(*a_ptr)(void));
+
+#endif /* DOOR_POSITION_H_ */
@@ -0,0 +1,116 @@
+/******************************************************************************
+ *
+ * Module: Door Sequence
+ *
+ * File Name: door_sequence.c
+ *
+ * Description: Source file for the door actuation sequence
+ * 				(same file in both ECUs , the phase table is the only
+ * 				definition of the door timing)
+ *
+ * 				A new door type is a new phase table , the step function
+ * 				only moves a pointer along it once per second.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "door_sequence.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+/*Motor driven bolt : unlock , hold open , lock back*/
+static const DOOR_PhaseType s_standardPhases[] =
+{
+	{15 , DOOR_MOTOR_OPEN  , 5 , 9 , "Unlocking       "},
+	{3  , DOOR_MOTOR_STOP  , 0 , 0 , "Unlocked !      "},
+	{15 , DOOR_MOTOR_CLOSE , 5 , 7 , "Locking         "}
+};
+
+/*Spring latch : the motor only pulls the latch , the spring returns it*/
+static const DOOR_PhaseType s_latchOnlyPhases[] =
+{
+	{2 , DOOR_MOTOR_OPEN , 1 , 10 , "Unlatching      "},
+	{5 , DOOR_MOTOR_STOP , 0 , 0  , "Push the door ! "}
+};
+
+static const DOOR_SequenceType s_sequences[DOOR_TYPES_COUNT] =
+{
+	{s_standardPhases  , sizeof(s_standardPhases)  / sizeof(DOOR_PhaseType)},
+	{s_latchOnlyPhases , sizeof(s_latchOnlyPhases) / sizeof(DOOR_PhaseType)}
+};
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void DOOR_start(DOOR_RunnerType * a_runner , DOOR_TypeId a_type)
+{
+	if(a_type >= DOOR_TYPES_COUNT)
+	{
+		a_type = DOOR_STANDARD;
+	}
+	a_runner->phase = s_sequences[a_type].phases;
+	a_runner->end = s_sequences[a_type].phases + s_sequences[a_type].count;
+	a_runner->index = 0;
+	a_runner->elapsed = 0;
+}
+
+DOOR_EventType DOOR_step(DOOR_RunnerType * a_runner)
+{
+	DOOR_EventType event;
+
+	if(a_runner->phase == a_runner->end)
+	{
+		return DOOR_SEQUENCE_DONE;
+	}
+
+	/*Current phase over , move to the next one*/
+	if(a_runner->elapsed >= a_runner->phase->duration)
+	{
+		a_runner->phase++;
+		a_runner->index++;
+		a_runner->elapsed = 0;
+
+		if(a_runner->phase == a_runner->end)
+		{
+			return DOOR_SEQUENCE_DONE;
+		}
+	}
+
+	event = (0 == a_runner->elapsed) ? DOOR_PHASE_ENTERED : DOOR_PHASE_RUNNING;
+
+	a_runner->elapsed++;
+
+	return event;
+}
+
+void DOOR_skipPhase(DOOR_RunnerType * a_runner)
+{
+	if(a_runner->phase != a_runner->end)
+	{
+		a_runner->elapsed = a_runner->phase->duration;
+	}
+}
+
+const DOOR_PhaseType * DOOR_currentPhase(const DOOR_RunnerType * a_runner)
+{
+	return a_runner->phase;
+}
+
+const DOOR_PhaseType * DOOR_getPhase(DOOR_TypeId a_type , uint8 a_index)
+{
+	if(a_type >= DOOR_TYPES_COUNT || a_index >= s_sequences[a_type].count)
+	{
+		return NULL_PTR;
+	}
+	return &s_sequences[a_type].phases[a_index];
+}
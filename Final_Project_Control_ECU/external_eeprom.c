@@ -1,82 +1,183 @@
- /******************************************************************************
- *
- * Module: External EEPROM
- *
- * File Name: external_eeprom.c
- *
- * Description: Source file for the External EEPROM Memory
- *
- * Author: Mohamed Tarek
- *
- *******************************************************************************/
-#include "external_eeprom.h"
-#include "twi.h"
-
-uint8 EEPROM_writeByte(uint16 u16addr, uint8 u8data)
-{
-	/* Send the Start Bit */
-    TWI_start();
-    if (TWI_getStatus() != TWI_START)
-        return ERROR;
-		
-    /* Send the device address, we need to get A8 A9 A10 address bits from the
-     * memory location address and R/W=0 (write) */
-    TWI_writeByte((uint8)(0xA0 | ((u16addr & 0x0700)>>7)));
-    if (TWI_getStatus() != TWI_MT_SLA_W_ACK)
-        return ERROR; 
-		 
-    /* Send the required memory location address */
-    TWI_writeByte((uint8)(u16addr));
-    if (TWI_getStatus() != TWI_MT_DATA_ACK)
-        return ERROR;
-		
-    /* write byte to eeprom */
-    TWI_writeByte(u8data);
-    if (TWI_getStatus() != TWI_MT_DATA_ACK)
-        return ERROR;
-
-    /* Send the Stop Bit */
-    TWI_stop();
-	
-    return SUCCESS;
-}
-
-uint8 EEPROM_readByte(uint16 u16addr, uint8 *u8data)
-{
-	/* Send the Start Bit */
-    TWI_start();
-    if (TWI_getStatus() != TWI_START)
-        return ERROR;
-		
-    /* Send the device address, we need to get A8 A9 A10 address bits from the
-     * memory location address and R/W=0 (write) */
-    TWI_writeByte((uint8)((0xA0) | ((u16addr & 0x0700)>>7)));
-    if (TWI_getStatus() != TWI_MT_SLA_W_ACK)
-        return ERROR;
-		
-    /* Send the required memory location address */
-    TWI_writeByte((uint8)(u16addr));
-    if (TWI_getStatus() != TWI_MT_DATA_ACK)
-        return ERROR;
-		
-    /* Send the Repeated Start Bit */
-    TWI_start();
-    if (TWI_getStatus() != TWI_REP_START)
-        return ERROR;
-		
-    /* Send the device address, we need to get A8 A9 A10 address bits from the
-     * memory location address and R/W=1 (Read) */
-    TWI_writeByte((uint8)((0xA0) | ((u16addr & 0x0700)>>7) | 1));
-    if (TWI_getStatus() != TWI_MT_SLA_R_ACK)
-        return ERROR;
-
-    /* Read Byte from Memory without send ACK */
-    *u8data = TWI_readByteWithNACK();
-    if (TWI_getStatus() != TWI_MR_DATA_NACK)
-        return ERROR;
-
-    /* Send the Stop Bit */
-    TWI_stop();
-
-    return SUCCESS;
-}
+ /******************************************************************************
+ *
+ * Module: External EEPROM
+ *
+ * File Name: external_eeprom.c
+ *
+ * Description: Source file for the External EEPROM Memory
+ *
+ * Author: Mohamed Tarek
+ *
+ * Modified by : Karim Amr
+ *
+ *******************************************************************************/
+#include "external_eeprom.h"
+#include "twi_devices.h"
+
+typedef struct
+{
+    uint32 size;
+    uint8 pageSize;
+    uint8 addressBytes;
+    uint8 blockBits;
+}EEPROM_PartInfoType;
+
+typedef struct
+{
+    TWIDEV_IdType device;
+    uint32 base;            /* First address of the part in the address space */
+    uint32 size;
+    uint8 pageSize;
+}EEPROM_MappedChipType;
+
+/* Geometry of the parts , in the order of EEPROM_PartType */
+static const EEPROM_PartInfoType s_parts[] =
+{
+    {2048UL ,16 ,1,3},  /* 24C16 : A10:A8 in the device address */
+    {4096UL ,32 ,2,0},  /* 24C32 */
+    {8192UL ,32 ,2,0},  /* 24C64 */
+    {16384UL,64 ,2,0},  /* 24C128 */
+    {32768UL,64 ,2,0},  /* 24C256 */
+    {65536UL,128,2,0}   /* 24C512 */
+};
+
+static EEPROM_MappedChipType s_chips[EEPROM_MAX_CHIPS];
+static uint8 s_chipCount = 0;
+static uint32 s_size = 0;
+
+static const EEPROM_MappedChipType * EEPROM_findChip(uint16 u16addr);
+static uint8 EEPROM_lastAddress(const EEPROM_ChipType * chip);
+
+uint8 EEPROM_init(const EEPROM_ConfigType * Config_Ptr)
+{
+    uint8 i;
+    uint8 j;
+    const EEPROM_PartInfoType * part;
+    TWIDEV_ConfigType device;
+
+    s_chipCount = 0;
+    s_size = 0;
+
+    for (i = 0; i < Config_Ptr->chips && i < EEPROM_MAX_CHIPS; i++)
+    {
+        part = &s_parts[Config_Ptr->chip[i].part];
+        if ((s_size + part->size) > 65536UL)
+            return ERROR;
+
+        /* A 24C16 answers on 8 addresses (block bits) , two parts
+         * answering on the same address would collide on the bus */
+        for (j = 0; j < i; j++)
+        {
+            if ((Config_Ptr->chip[i].address <= EEPROM_lastAddress(&Config_Ptr->chip[j])) &&
+                (Config_Ptr->chip[j].address <= EEPROM_lastAddress(&Config_Ptr->chip[i])))
+                return ERROR;
+        }
+
+        device.address = Config_Ptr->chip[i].address;
+        device.addressBytes = part->addressBytes;
+        device.blockBits = part->blockBits;
+        device.bitRate = Config_Ptr->bitRate;
+
+        s_chips[i].device = TWIDEV_register(&device);
+        if (s_chips[i].device == TWIDEV_INVALID)
+            return ERROR;
+
+        s_chips[i].base = s_size;
+        s_chips[i].size = part->size;
+        s_chips[i].pageSize = part->pageSize;
+        s_size += part->size;
+        s_chipCount++;
+    }
+
+    return SUCCESS;
+}
+
+uint32 EEPROM_getSize(void)
+{
+    return s_size;
+}
+
+uint32 EEPROM_setBitRate(TWI_BaudRate bitRate)
+{
+    uint8 i;
+
+    for (i = 0; i < s_chipCount; i++)
+    {
+        TWIDEV_setBitRate(s_chips[i].device, bitRate);
+    }
+    return TWI_setBitRate(bitRate);
+}
+
+uint8 EEPROM_writeByte(uint16 u16addr, uint8 u8data)
+{
+    return EEPROM_writePage(u16addr, &u8data, 1);
+}
+
+uint8 EEPROM_readByte(uint16 u16addr, uint8 *u8data)
+{
+    return EEPROM_readBlock(u16addr, u8data, 1);
+}
+
+uint8 EEPROM_writePage(uint16 u16addr, const uint8 *u8data, uint8 u8length)
+{
+    const EEPROM_MappedChipType * chip = EEPROM_findChip(u16addr);
+
+    /* The whole block must be inside one page , otherwise the
+     * EEPROM internal address counter rolls over to the page start
+     * (a page never crosses two parts) */
+    if ((chip == NULL_PTR) || (u8length == 0) ||
+        (((u16addr % chip->pageSize) + u8length) > chip->pageSize))
+        return ERROR;
+
+    if (FALSE == TWIDEV_write(chip->device, (uint16)(u16addr - chip->base), u8data, u8length))
+        return ERROR;
+
+    return SUCCESS;
+}
+
+uint8 EEPROM_readBlock(uint16 u16addr, uint8 *u8data, uint16 u16length)
+{
+    const EEPROM_MappedChipType * chip;
+    uint32 address = u16addr;
+    uint32 end = (uint32)u16addr + u16length;
+    uint16 length;
+
+    if ((u16length == 0) || (end > s_size))
+        return ERROR;
+
+    /* Sequential read inside each part , a block that goes on
+     * to the next part is read in two transfers */
+    while (address < end)
+    {
+        chip = EEPROM_findChip((uint16)address);
+        length = (uint16)(((chip->base + chip->size) < end) ? (chip->base + chip->size - address) : (end - address));
+
+        if (FALSE == TWIDEV_read(chip->device, (uint16)(address - chip->base), u8data, length))
+            return ERROR;
+
+        u8data += length;
+        address += length;
+    }
+
+    return SUCCESS;
+}
+
+/* Part holding the address , NULL_PTR outside the address space */
+static const EEPROM_MappedChipType * EEPROM_findChip(uint16 u16addr)
+{
+    uint8 i;
+
+    for (i = 0; i < s_chipCount; i++)
+    {
+        if ((u16addr - s_chips[i].base) < s_chips[i].size)
+            return &s_chips[i];
+    }
+    return NULL_PTR;
+}
+
+/* Last 7-bit address the part answers on , the block bits of a 24C16
+ * are part of its device address */
+static uint8 EEPROM_lastAddress(const EEPROM_ChipType * chip)
+{
+    return (uint8)(chip->address | ((1 << s_parts[chip->part].blockBits) - 1));
+}
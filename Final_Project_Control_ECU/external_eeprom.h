@@ -1,32 +1,83 @@
- /******************************************************************************
- *
- * Module: External EEPROM
- *
- * File Name: external_eeprom.h
- *
- * Description: Header file for the External EEPROM Memory
- *
- * Author: Mohamed Tarek
- *
- *******************************************************************************/
-
-
-#ifndef EXTERNAL_EEPROM_H_
-#define EXTERNAL_EEPROM_H_
-
-#include "std_types.h"
-
-/*******************************************************************************
- *                      Preprocessor Macros                                    *
- *******************************************************************************/
-#define ERROR 0
-#define SUCCESS 1
-
-/*******************************************************************************
- *                      Functions Prototypes                                   *
- *******************************************************************************/
-
-uint8 EEPROM_writeByte(uint16 u16addr,uint8 u8data);
-uint8 EEPROM_readByte(uint16 u16addr,uint8 *u8data);
- 
-#endif /* EXTERNAL_EEPROM_H_ */
+ /******************************************************************************
+ *
+ * Module: External EEPROM
+ *
+ * File Name: external_eeprom.h
+ *
+ * Description: Header file for the External EEPROM Memory
+ *
+ * Author: Mohamed Tarek
+ *
+ *******************************************************************************/
+
+
+#ifndef EXTERNAL_EEPROM_H_
+#define EXTERNAL_EEPROM_H_
+
+#include "std_types.h"
+#include "twi.h"
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+#define ERROR 0
+#define SUCCESS 1
+
+/* Smallest page of the supported parts , a block aligned on it
+ * never crosses a page of any part */
+#define EEPROM_PAGE_SIZE        16
+
+/* Maximum internal write cycle time of the 24Cxx family in ms */
+#define EEPROM_WRITE_CYCLE_TIME 10
+
+/* Parts that can share the bus , they form one address space
+ * in the order of the configuration (at most 64 KB) */
+#define EEPROM_MAX_CHIPS        4
+
+/* 7-bit address of the 24Cxx with A2:A0 = 0 */
+#define EEPROM_BASE_ADDRESS     0x50
+
+/*******************************************************************************
+ *                      Type Definitions                                       *
+ *******************************************************************************/
+
+typedef enum
+{
+    EEPROM_24C16 , EEPROM_24C32 , EEPROM_24C64 , EEPROM_24C128 , EEPROM_24C256 , EEPROM_24C512
+}EEPROM_PartType;
+
+typedef struct
+{
+    EEPROM_PartType part;
+    uint8 address;          /* 7-bit address set by the A2:A0 pins (24C16 : block 0) */
+}EEPROM_ChipType;
+
+typedef struct
+{
+    TWI_BaudRate bitRate;
+    uint8 chips;
+    EEPROM_ChipType chip[EEPROM_MAX_CHIPS];
+}EEPROM_ConfigType;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/* Register the parts on the TWI bus , returns ERROR if they don't fit
+ * (registry full or more than 64 KB) or if two parts answer on the
+ * same address (a 24C16 takes 8 addresses) */
+uint8 EEPROM_init(const EEPROM_ConfigType * Config_Ptr);
+
+/* Size of the address space in bytes */
+uint32 EEPROM_getSize(void);
+
+uint8 EEPROM_writeByte(uint16 u16addr,uint8 u8data);
+uint8 EEPROM_readByte(uint16 u16addr,uint8 *u8data);
+uint8 EEPROM_writePage(uint16 u16addr,const uint8 *u8data,uint8 u8length);
+uint8 EEPROM_readBlock(uint16 u16addr,uint8 *u8data,uint16 u16length);
+
+/* Set the SCL rate of the EEPROM transactions , applied before each one
+ * (other devices on the bus may use another rate) , returns the actual rate */
+uint32 EEPROM_setBitRate(TWI_BaudRate bitRate);
+ 
+#endif /* EXTERNAL_EEPROM_H_ */
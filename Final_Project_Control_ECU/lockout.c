@@ -0,0 +1,374 @@
+/******************************************************************************
+ *
+ * Module: Lockout
+ *
+ * File Name: lockout.c
+ *
+ * Description: Source file for the lockout policy engine
+ * 				(attempt windows , exponential back-off & cool-down)
+ * 				with its state persisted inside the external EEPROM
+ *
+ * 				Every attempt is evaluated in constant time : instead of
+ * 				keeping the attempt times , each counter keeps the time of
+ * 				its last attempt and forgets one attempt per quiet window
+ * 				when the next attempt comes (leaky bucket).
+ *
+ * 				Rotating slots : the state is never rewritten in place ,
+ * 				each update is written to the slot after the newest one
+ * 				with an incremented sequence number & a check byte so a
+ * 				write interrupted by a reset is simply ignored.
+ * 				Only attempts (not key presses) & lockout checkpoints write.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "lockout.h"
+#include "external_eeprom.h"
+#include "user_table.h"
+#include <util/delay.h> /*To wait for the EEPROM write cycle*/
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+/*EEPROM slot layout*/
+typedef struct
+{
+	uint16 sequence;
+	uint16 lockRemaining;	/*Seconds , 0 = not locked*/
+	uint8  failedAttempts;
+	uint8  strikes;			/*Back-off level*/
+	uint8  reserved;
+	uint8  check;			/*XOR of the previous bytes with 0x5A*/
+}LOCKOUT_SlotType;
+
+/*Attempt window of one user (RAM only)*/
+typedef struct
+{
+	uint32 lastFailure;
+	uint32 blockedUntil;
+	uint8  failedAttempts;
+	uint8  strikes;
+}LOCKOUT_UserType;
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static const LOCKOUT_ConfigType * s_config;
+
+/*Global window*/
+static uint8  s_failedAttempts = 0;
+static uint32 s_lastFailure = 0;
+
+/*Back-off level , steps down once per cool-down after the last lockout end*/
+static uint8  s_strikes = 0;
+static uint32 s_lastLockoutEnd = 0;
+
+static volatile uint16 s_lockRemaining = 0;
+
+static LOCKOUT_UserType s_users[USERS_MAX_USERS];
+
+/*Remaining time at the last write , decides when the next checkpoint is due*/
+static uint16 s_savedRemaining = 0;
+
+static uint8  s_nextSlot = 0;
+static uint16 s_nextSequence = 0;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static uint8 LOCKOUT_checkByte(const LOCKOUT_SlotType * a_slot);
+static uint8 LOCKOUT_decay(uint8 a_count , uint32 a_since , uint32 a_now , uint16 a_period);
+static uint16 LOCKOUT_backOff(uint8 a_strikes);
+static uint16 LOCKOUT_readRemaining(void);
+static void LOCKOUT_save(void);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void LOCKOUT_init(const LOCKOUT_ConfigType * a_config)
+{
+	LOCKOUT_SlotType slot;
+	LOCKOUT_SlotType newest;
+	uint8 slotIndex;
+	uint8 newestIndex = LOCKOUT_SLOTS; /*None found yet*/
+
+	s_config = a_config;
+
+	for(slotIndex = 0 ; slotIndex < USERS_MAX_USERS ; slotIndex++)
+	{
+		s_users[slotIndex].failedAttempts = 0;
+		s_users[slotIndex].strikes = 0;
+		s_users[slotIndex].blockedUntil = 0;
+	}
+
+	for(slotIndex = 0 ; slotIndex < LOCKOUT_SLOTS ; slotIndex++)
+	{
+		if(ERROR == EEPROM_readBlock(LOCKOUT_STATE_ADDRESS + slotIndex * LOCKOUT_SLOT_SIZE,
+				(uint8 *)&slot,LOCKOUT_SLOT_SIZE) ||
+		   slot.check != LOCKOUT_checkByte(&slot))
+		{
+			continue;
+		}
+
+		/*Serial number arithmetic , the sequence wraps around*/
+		if(LOCKOUT_SLOTS == newestIndex ||
+		   (uint16)(slot.sequence - newest.sequence) < 0x8000U)
+		{
+			newestIndex = slotIndex;
+			newest = slot;
+		}
+	}
+
+	if(LOCKOUT_SLOTS == newestIndex)
+	{
+		/*Never written , start clean*/
+		s_failedAttempts = 0;
+		s_strikes = 0;
+		s_lockRemaining = 0;
+		s_nextSlot = 0;
+		s_nextSequence = 0;
+	}
+	else
+	{
+		s_failedAttempts = newest.failedAttempts;
+		s_strikes = (newest.strikes > LOCKOUT_MAX_STRIKES) ? LOCKOUT_MAX_STRIKES : newest.strikes;
+		s_lockRemaining = newest.lockRemaining;
+		s_nextSlot = (newestIndex + 1) % LOCKOUT_SLOTS;
+		s_nextSequence = newest.sequence + 1;
+	}
+	s_savedRemaining = s_lockRemaining;
+
+	/*The stored times are lost with the tick on reset ,
+	 * the windows restart from the boot time*/
+	s_lastFailure = 0;
+	s_lastLockoutEnd = 0;
+}
+
+boolean LOCKOUT_isLocked(void)
+{
+	return (0 != LOCKOUT_readRemaining()) ? TRUE : FALSE;
+}
+
+uint16 LOCKOUT_getRemaining(void)
+{
+	return LOCKOUT_readRemaining();
+}
+
+boolean LOCKOUT_isUserBlocked(uint8 a_userId , uint32 a_now)
+{
+	if(a_userId >= USERS_MAX_USERS)
+	{
+		return FALSE;
+	}
+	return (a_now < s_users[a_userId].blockedUntil) ? TRUE : FALSE;
+}
+
+boolean LOCKOUT_registerFailure(uint8 a_userId , uint32 a_now)
+{
+	LOCKOUT_UserType * user;
+	uint16 duration;
+
+	/*Known code refused (outside its validity window , blocked , ...)*/
+	if(a_userId < USERS_MAX_USERS)
+	{
+		user = &s_users[a_userId];
+
+		user->failedAttempts = LOCKOUT_decay(user->failedAttempts,user->lastFailure,
+				a_now,s_config->attemptWindow) + 1;
+		user->lastFailure = a_now;
+
+		if(user->failedAttempts >= s_config->userMaxAttempts)
+		{
+			/*Block this user only , the others can still open the door*/
+			duration = LOCKOUT_backOff(user->strikes);
+			user->blockedUntil = a_now + duration;
+			user->failedAttempts = 0;
+			if(user->strikes < LOCKOUT_MAX_STRIKES)
+			{
+				user->strikes++;
+			}
+		}
+		return FALSE;
+	}
+
+	/*Unknown code : global window*/
+	s_failedAttempts = LOCKOUT_decay(s_failedAttempts,s_lastFailure,
+			a_now,s_config->attemptWindow) + 1;
+	s_lastFailure = a_now;
+
+	if(s_failedAttempts >= s_config->maxAttempts)
+	{
+		/*Saves the state too*/
+		LOCKOUT_start(a_now);
+		return TRUE;
+	}
+
+	LOCKOUT_save();
+	return FALSE;
+}
+
+void LOCKOUT_registerSuccess(uint8 a_userId)
+{
+	if(a_userId < USERS_MAX_USERS)
+	{
+		s_users[a_userId].failedAttempts = 0;
+	}
+
+	if(0 != s_failedAttempts)
+	{
+		s_failedAttempts--;
+		LOCKOUT_save();
+	}
+}
+
+void LOCKOUT_start(uint32 a_now)
+{
+	uint16 duration;
+	uint8 strikes;
+
+	/*Step the back-off down once per cool-down passed since the last lockout ,
+	 * moving the reference by the steps taken so they aren't taken twice ,
+	 * done here so every lockout (wrong passwords or command) applies it*/
+	strikes = LOCKOUT_decay(s_strikes,s_lastLockoutEnd,a_now,s_config->coolDown);
+	s_lastLockoutEnd += (uint32)(s_strikes - strikes) * s_config->coolDown;
+	s_strikes = strikes;
+
+	duration = LOCKOUT_backOff(s_strikes);
+
+	if(s_strikes < LOCKOUT_MAX_STRIKES)
+	{
+		s_strikes++;
+	}
+
+	/*The cool-down counts from the end of this lockout*/
+	s_lastLockoutEnd = a_now + duration;
+
+	s_failedAttempts = 0;
+	s_lockRemaining = duration;
+	LOCKOUT_save();
+}
+
+void LOCKOUT_tick(void)
+{
+	if(0 != s_lockRemaining)
+	{
+		s_lockRemaining--;
+	}
+}
+
+boolean LOCKOUT_service(void)
+{
+	uint16 remaining = LOCKOUT_readRemaining();
+
+	if(0 == s_savedRemaining)
+	{
+		/*Not locked*/
+		return FALSE;
+	}
+
+	if(0 == remaining)
+	{
+		/*Lockout ended , save it so it isn't resumed after a reset*/
+		LOCKOUT_save();
+		return TRUE;
+	}
+
+	if((s_savedRemaining - remaining) >= LOCKOUT_CHECKPOINT_PERIOD)
+	{
+		LOCKOUT_save();
+	}
+	return FALSE;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+static uint8 LOCKOUT_checkByte(const LOCKOUT_SlotType * a_slot)
+{
+	const uint8 * bytes = (const uint8 *)a_slot;
+	uint8 check = 0x5A;
+	uint8 i;
+
+	for(i = 0 ; i < (LOCKOUT_SLOT_SIZE - 1) ; i++)
+	{
+		check ^= bytes[i];
+	}
+	return check;
+}
+
+/* Description :
+ * Forget one count per period passed since a_since (never below zero)*/
+static uint8 LOCKOUT_decay(uint8 a_count , uint32 a_since , uint32 a_now , uint16 a_period)
+{
+	uint32 periods;
+
+	if(0 == a_count || a_now <= a_since || 0 == a_period)
+	{
+		return a_count;
+	}
+
+	periods = (a_now - a_since) / a_period;
+
+	return (periods >= a_count) ? 0 : (uint8)(a_count - periods);
+}
+
+/* Description :
+ * Lockout duration of a back-off level : base * 2^strikes limited to the maximum*/
+static uint16 LOCKOUT_backOff(uint8 a_strikes)
+{
+	uint32 duration = (uint32)s_config->baseLockout << a_strikes;
+
+	return (duration > s_config->maxLockout) ? s_config->maxLockout : (uint16)duration;
+}
+
+/* Description :
+ * The 16-bit counter is decremented by the ISR , read it
+ * again until two reads agree*/
+static uint16 LOCKOUT_readRemaining(void)
+{
+	uint16 remaining;
+
+	do
+	{
+		remaining = s_lockRemaining;
+	}while(remaining != s_lockRemaining);
+
+	return remaining;
+}
+
+/* Description :
+ * Write the current state to the next slot (one page write)*/
+static void LOCKOUT_save(void)
+{
+	LOCKOUT_SlotType slot;
+
+	slot.sequence = s_nextSequence;
+	slot.lockRemaining = LOCKOUT_readRemaining();
+	slot.failedAttempts = s_failedAttempts;
+	slot.strikes = s_strikes;
+	slot.reserved = 0xFF;
+	slot.check = LOCKOUT_checkByte(&slot);
+
+	/*On a write error the RAM state is still valid , it is only lost on reset*/
+	if(SUCCESS == EEPROM_writePage(LOCKOUT_STATE_ADDRESS + s_nextSlot * LOCKOUT_SLOT_SIZE,
+			(const uint8 *)&slot,LOCKOUT_SLOT_SIZE))
+	{
+		_delay_ms(EEPROM_WRITE_CYCLE_TIME);
+
+		s_nextSlot = (s_nextSlot + 1) % LOCKOUT_SLOTS;
+		s_nextSequence++;
+	}
+	s_savedRemaining = slot.lockRemaining;
+}
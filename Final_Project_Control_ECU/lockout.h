@@ -0,0 +1,107 @@
+/******************************************************************************
+ *
+ * Module: Lockout
+ *
+ * File Name: lockout.h
+ *
+ * Description: Header file for the lockout policy engine
+ * 				(attempt windows , exponential back-off & cool-down)
+ * 				with its state persisted inside the external EEPROM
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef LOCKOUT_H_
+#define LOCKOUT_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*State location inside EEPROM : 8 slots * 8 bytes = 0x0200 .. 0x023F
+ * Every update goes to the next slot so the wear is spread on 8 slots*/
+#define LOCKOUT_STATE_ADDRESS		0x0200
+#define LOCKOUT_SLOT_SIZE			8
+#define LOCKOUT_SLOTS				8
+
+/*Back-off steps are limited so the shift can't overflow*/
+#define LOCKOUT_MAX_STRIKES			15
+
+/*The remaining lockout time is saved every period (seconds) , a reset
+ * during a lockout resumes from the last saved value so it can only make
+ * the lockout longer , never shorter*/
+#define LOCKOUT_CHECKPOINT_PERIOD	15
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+/*Policy settings , all times in seconds*/
+typedef struct
+{
+	uint8  maxAttempts;		/*Wrong passwords inside the global window before the system is locked*/
+	uint8  userMaxAttempts;	/*Refused attempts of one user before that user is blocked*/
+	uint16 attemptWindow;	/*The attempt counters forget one attempt per quiet window*/
+	uint16 baseLockout;		/*First lockout duration , doubled on every repeated lockout*/
+	uint16 maxLockout;		/*Lockout duration limit*/
+	uint16 coolDown;		/*Time without a lockout that steps the back-off down once*/
+}LOCKOUT_ConfigType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Set the policy & restore the counter , back-off level & lockout
+ * state from the newest valid slot*/
+void LOCKOUT_init(const LOCKOUT_ConfigType * a_config);
+
+/* Description :
+ * Return TRUE while the system is locked*/
+boolean LOCKOUT_isLocked(void);
+
+/* Description :
+ * Return the remaining lockout time in seconds*/
+uint16 LOCKOUT_getRemaining(void);
+
+/* Description :
+ * Return TRUE while the given user is blocked by its own attempt window*/
+boolean LOCKOUT_isUserBlocked(uint8 a_userId , uint32 a_now);
+
+/* Description :
+ * Count a refused attempt at a_now (seconds) in constant time
+ * An unknown code (a_userId = USERS_NO_USER) counts in the global window
+ * and returns TRUE if it started a system lockout , a refused known code
+ * counts in the window of its user only & may block that user*/
+boolean LOCKOUT_registerFailure(uint8 a_userId , uint32 a_now);
+
+/* Description :
+ * A correct password clears the attempts of its user & forgives one
+ * global wrong password (a single typo) , the back-off level is kept*/
+void LOCKOUT_registerSuccess(uint8 a_userId);
+
+/* Description :
+ * Lock the system immediately for the current back-off duration ,
+ * stepped down first by the cool-downs passed since the last lockout*/
+void LOCKOUT_start(uint32 a_now);
+
+/* Description :
+ * Count down the lockout , must be called every second
+ * (from the timer service ISR , no EEPROM access inside)*/
+void LOCKOUT_tick(void);
+
+/* Description :
+ * Save the checkpoints & the end of the lockout , must be called from
+ * the main loop , returns TRUE once when the lockout has just ended*/
+boolean LOCKOUT_service(void);
+
+#endif /* LOCKOUT_H_ */
@@ -0,0 +1,304 @@
+/******************************************************************************
+ *
+ * Module: Real Time Clock
+ *
+ * File Name: rtc.c
+ *
+ * Description: Source file for the DS1307 / DS3231 real time clock driver
+ *
+ * 				Both chips keep the date in BCD registers 0x00 .. 0x06
+ * 				(24 hour mode , Monday = day 1) , a stopped clock is flagged
+ * 				by CH (seconds bit 7) on the DS1307 & OSF (status bit 7)
+ * 				on the DS3231.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include "common_macros.h"
+#include "twi.h"
+#include "twi_devices.h"
+#include "deferred_work.h"
+
+#include "rtc.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define RTC_TIME_REGISTER		0x00
+#define RTC_TIME_SIZE			7
+
+#define RTC_CLOCK_HALT			7	/*DS1307 seconds register*/
+#define RTC_12_HOUR_MODE		6	/*Hours register*/
+
+#define RTC_DS3231_STATUS		0x0F
+#define RTC_OSCILLATOR_STOP		7
+
+/*1970-01-01 was a Thursday , 3 days after a Monday*/
+#define RTC_EPOCH_WEEK_HOURS	72
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static volatile uint32 s_time = 0;
+static volatile uint16 s_sinceSync = 0;
+
+static boolean s_valid = FALSE;
+static RTC_ChipType s_chip = RTC_DS1307;
+static uint16 s_syncPeriod = 0;
+static TWIDEV_IdType s_device = TWIDEV_INVALID;
+
+/*Days before each month of a common year*/
+static const uint16 s_monthDays[12] = {0,31,59,90,120,151,181,212,243,273,304,334};
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static boolean RTC_read(uint32 * a_time);
+static uint8 RTC_fromBcd(uint8 a_bcd);
+static uint8 RTC_toBcd(uint8 a_value);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+boolean RTC_init(const RTC_ConfigType * Config_Ptr)
+{
+	TWIDEV_ConfigType device = {Config_Ptr->address,1,0,Normal_Mode};
+	uint32 time;
+
+	s_chip = Config_Ptr->chip;
+	s_syncPeriod = Config_Ptr->syncPeriod;
+
+	/*The DS3231 takes the fast mode , the DS1307 only the standard one*/
+	if(RTC_DS3231 == s_chip)
+	{
+		device.bitRate = Fast_Mode;
+	}
+	s_device = TWIDEV_register(&device);
+
+	s_valid = RTC_read(&time);
+	if(s_valid)
+	{
+		s_time = time;
+	}
+	return s_valid;
+}
+
+void RTC_tick(void)
+{
+	s_time++;
+
+	if(s_syncPeriod != 0 && ++s_sinceSync >= s_syncPeriod)
+	{
+		/*The bus is only used by the main loop*/
+		if(WORK_post(&RTC_sync))
+		{
+			s_sinceSync = 0;
+		}
+	}
+}
+
+void RTC_sync(void)
+{
+	uint32 time;
+	uint8 sreg;
+
+	if(RTC_read(&time))
+	{
+		/*The tick ISR mustn't change the copy between the byte writes*/
+		sreg = SREG;
+		CLEAR_BIT(SREG,7);
+		s_time = time;
+		SREG = sreg;
+		s_valid = TRUE;
+	}
+}
+
+uint32 RTC_now(void)
+{
+	uint32 time;
+
+	/*Same double read as TIMERS_getTicks*/
+	do
+	{
+		time = s_time;
+	}while(time != s_time);
+
+	return time;
+}
+
+boolean RTC_isValid(void)
+{
+	return s_valid;
+}
+
+boolean RTC_set(uint32 a_time)
+{
+	uint8 regs[RTC_TIME_SIZE];
+	uint8 status;
+	uint8 sreg;
+	uint16 days;
+	uint8 year;
+	uint8 month;
+	boolean leap;
+	uint32 seconds;
+
+	if(a_time < RTC_EPOCH_2000 || a_time >= RTC_EPOCH_2100)
+	{
+		return FALSE;
+	}
+
+	seconds = (a_time - RTC_EPOCH_2000) % RTC_SECONDS_PER_DAY;
+	days = (uint16)((a_time - RTC_EPOCH_2000) / RTC_SECONDS_PER_DAY);
+
+	/*2000 .. 2099 : every 4th year is a leap year , 2000 first*/
+	year = (uint8)((days / 1461) * 4);
+	days %= 1461;
+	if(days >= 366)
+	{
+		days -= 366;
+		year += 1 + days / 365;
+		days %= 365;
+	}
+	leap = (0 == (year % 4));
+
+	/*Last month that starts on or before the day*/
+	for(month = 11 ; month > 0 ; month--)
+	{
+		if(days >= s_monthDays[month] + ((leap && month >= 2) ? 1 : 0))
+		{
+			break;
+		}
+	}
+	days -= s_monthDays[month] + ((leap && month >= 2) ? 1 : 0);
+
+	regs[0] = RTC_toBcd((uint8)(seconds % 60));	/*CH = 0 , the clock runs*/
+	regs[1] = RTC_toBcd((uint8)((seconds / 60) % 60));
+	regs[2] = RTC_toBcd((uint8)(seconds / RTC_SECONDS_PER_HOUR));	/*24 hour mode*/
+	regs[3] = (uint8)(RTC_hourOfWeek(a_time) / 24 + 1);
+	regs[4] = RTC_toBcd((uint8)(days + 1));
+	regs[5] = RTC_toBcd(month + 1);
+	regs[6] = RTC_toBcd(year);
+
+	if(FALSE == TWIDEV_write(s_device,RTC_TIME_REGISTER,regs,RTC_TIME_SIZE))
+	{
+		return FALSE;
+	}
+
+	if(RTC_DS3231 == s_chip)
+	{
+		/*The time is good again*/
+		if(FALSE == TWIDEV_read(s_device,RTC_DS3231_STATUS,&status,1))
+		{
+			return FALSE;
+		}
+		CLEAR_BIT(status,RTC_OSCILLATOR_STOP);
+		if(FALSE == TWIDEV_write(s_device,RTC_DS3231_STATUS,&status,1))
+		{
+			return FALSE;
+		}
+	}
+
+	sreg = SREG;
+	CLEAR_BIT(SREG,7);
+	s_time = a_time;
+	s_sinceSync = 0;
+	SREG = sreg;
+	s_valid = TRUE;
+
+	return TRUE;
+}
+
+uint8 RTC_hourOfWeek(uint32 a_time)
+{
+	return (uint8)((a_time / RTC_SECONDS_PER_HOUR + RTC_EPOCH_WEEK_HOURS) % RTC_HOURS_PER_WEEK);
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Read the date registers & convert them to seconds since 1970
+ * Returns FALSE if the chip doesn't answer , is stopped or holds no valid date*/
+static boolean RTC_read(uint32 * a_time)
+{
+	uint8 regs[RTC_TIME_SIZE];
+	uint8 status;
+	uint8 year;
+	uint8 month;
+	uint8 date;
+	uint8 hours;
+	uint16 days;
+
+	if(FALSE == TWIDEV_read(s_device,RTC_TIME_REGISTER,regs,RTC_TIME_SIZE))
+	{
+		return FALSE;
+	}
+
+	if(RTC_DS1307 == s_chip)
+	{
+		if(BIT_IS_SET(regs[0],RTC_CLOCK_HALT))
+		{
+			return FALSE;
+		}
+	}
+	else if(FALSE == TWIDEV_read(s_device,RTC_DS3231_STATUS,&status,1) ||
+			BIT_IS_SET(status,RTC_OSCILLATOR_STOP))
+	{
+		return FALSE;
+	}
+
+	/*Hours in 12 hour mode : bit 5 = PM , 12 AM is midnight*/
+	if(BIT_IS_SET(regs[2],RTC_12_HOUR_MODE))
+	{
+		hours = RTC_fromBcd(regs[2] & 0x1F) % 12 + (BIT_IS_SET(regs[2],5) ? 12 : 0);
+	}
+	else
+	{
+		hours = RTC_fromBcd(regs[2] & 0x3F);
+	}
+
+	date = RTC_fromBcd(regs[4] & 0x3F);
+	month = RTC_fromBcd(regs[5] & 0x1F);	/*Without the DS3231 century bit*/
+	year = RTC_fromBcd(regs[6]);
+
+	if(month < 1 || month > 12 || date < 1 || date > 31 || year > 99 || hours > 23)
+	{
+		return FALSE;
+	}
+
+	/*Days since 2000-01-01 , 2000 was a leap year*/
+	days = (uint16)year * 365 + (year + 3) / 4 + s_monthDays[month - 1] + (date - 1);
+	if(month > 2 && 0 == (year % 4))
+	{
+		days++;
+	}
+
+	*a_time = RTC_EPOCH_2000 + (uint32)days * RTC_SECONDS_PER_DAY +
+			(uint32)hours * RTC_SECONDS_PER_HOUR +
+			(uint16)RTC_fromBcd(regs[1] & 0x7F) * 60 + RTC_fromBcd(regs[0] & 0x7F);
+
+	return TRUE;
+}
+
+static uint8 RTC_fromBcd(uint8 a_bcd)
+{
+	return (a_bcd >> 4) * 10 + (a_bcd & 0x0F);
+}
+
+static uint8 RTC_toBcd(uint8 a_value)
+{
+	return (uint8)(((a_value / 10) << 4) | (a_value % 10));
+}
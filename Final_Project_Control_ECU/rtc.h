@@ -0,0 +1,102 @@
+/******************************************************************************
+ *
+ * Module: Real Time Clock
+ *
+ * File Name: rtc.h
+ *
+ * Description: Header file for the DS1307 / DS3231 real time clock driver
+ *
+ * 				The time is kept as seconds since 1970-01-01 00:00 (local
+ * 				time , the chip has no time zone) in a RAM copy that RTC_tick
+ * 				advances every second , reading the time is a 32-bit copy.
+ * 				The copy is read again from the chip at init & every sync
+ * 				period (main loop , through the deferred work queue) so it
+ * 				doesn't drift with the system tick.
+ *
+ * 				Until the clock is set (chip stopped , battery lost or absent)
+ * 				the copy counts the seconds since boot & RTC_isValid is FALSE.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef RTC_H_
+#define RTC_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*7-bit TWI address of both chips*/
+#define RTC_ADDRESS				0x68
+
+/*The chips count the years 00 .. 99 from 2000*/
+#define RTC_EPOCH_2000			946684800UL
+#define RTC_EPOCH_2100			4102444800UL
+
+#define RTC_SECONDS_PER_HOUR	3600UL
+#define RTC_SECONDS_PER_DAY		86400UL
+
+/*Hours of a week , hour 0 is Monday 00:00*/
+#define RTC_HOURS_PER_WEEK		168
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef enum
+{
+	RTC_DS1307 , RTC_DS3231
+}RTC_ChipType;
+
+typedef struct
+{
+	RTC_ChipType chip;
+	uint8 address;			/*7-bit TWI address (RTC_ADDRESS)*/
+	uint16 syncPeriod;		/*Seconds between two reads of the chip*/
+}RTC_ConfigType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Register the chip on the TWI bus & load the time from it
+ * Returns FALSE if the chip doesn't answer or its time isn't set*/
+boolean RTC_init(const RTC_ConfigType * Config_Ptr);
+
+/* Description :
+ * Advance the time by one second , called every second (system tick ISR)
+ * Posts the sync with the chip to the main loop every sync period*/
+void RTC_tick(void);
+
+/* Description :
+ * Read the time again from the chip (main loop only)*/
+void RTC_sync(void);
+
+/* Description :
+ * Return the time in seconds since 1970 (seconds since boot if not valid)*/
+uint32 RTC_now(void);
+
+/* Description :
+ * Return TRUE once the time was read from a running chip or set*/
+boolean RTC_isValid(void);
+
+/* Description :
+ * Set the chip & the RAM copy to a_time (seconds since 1970 , 2000 .. 2099)
+ * Returns FALSE if the time is out of range or the chip didn't take it*/
+boolean RTC_set(uint32 a_time);
+
+/* Description :
+ * Return the hour of the week of a_time (0 = Monday 00:00 .. 167)*/
+uint8 RTC_hourOfWeek(uint32 a_time);
+
+#endif /* RTC_H_ */
@@ -0,0 +1,90 @@
+/******************************************************************************
+ *
+ * Module: Stack Monitor
+ *
+ * File Name: stack_monitor.c
+ *
+ * Description: Source file for the stack usage measure
+ * 				(same file in both ECUs)
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <avr/io.h>
+
+#include "stack_monitor.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+/*End of .data , .bss & .noinit (from the linker script)*/
+extern uint8 _end;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+/*Run by the startup code between the stack pointer setup (.init2) & the
+ * copy of .data (.init4) , naked & in assembly as there is no stack frame*/
+void STACK_paint(void) __attribute__((naked , used , section(".init3")));
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+/* Description :
+ * Return the bytes of free RAM the stack never reached since reset
+ * (high-water mark , counted up from _end to the first overwritten byte)*/
+uint16 STACK_getHeadroom(void)
+{
+	const uint8 * byte = &_end;
+	const uint8 * stackPointer = (const uint8 *)SP;
+	uint16 headroom = 0;
+
+	while(byte < stackPointer && STACK_PAINT_PATTERN == *byte)
+	{
+		byte++;
+		headroom++;
+	}
+	return headroom;
+}
+
+/* Description :
+ * Return the bytes of free RAM between _end & the stack pointer right now*/
+uint16 STACK_getFree(void)
+{
+	return (uint16)((const uint8 *)SP - &_end);
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Paint the RAM from _end up to the stack pointer*/
+void STACK_paint(void)
+{
+	__asm__ __volatile__(
+		"ldi r30 , lo8(_end)"		"\n\t"
+		"ldi r31 , hi8(_end)"		"\n\t"
+		"ldi r24 , %0"				"\n\t"
+		"in r26 , __SP_L__"			"\n\t"
+		"in r27 , __SP_H__"			"\n\t"
+		"1:"						"\n\t"
+		"st Z+ , r24"				"\n\t"
+		"cp r30 , r26"				"\n\t"
+		"cpc r31 , r27"				"\n\t"
+		"brlo 1b"					"\n\t"
+		:
+		: "M" (STACK_PAINT_PATTERN)
+		: "r24" , "r26" , "r27" , "r30" , "r31" , "memory"
+	);
+}
@@ -0,0 +1,162 @@
+/******************************************************************************
+ *
+ * Module: Timer Service
+ *
+ * File Name: timer_service.c
+ *
+ * Description: Source file for the software timer service
+ * 				(system tick & software timers on top of TIMER1)
+ *
+ * 				TIMER1 runs free in CTC mode and never stops , every
+ * 				application timing (door sequence , buzzer , lockout , ...)
+ * 				is a software timer counted down from the same tick.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "timer_service.h"
+#include "TIMER1.h"
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef struct
+{
+	void (*callBack)(void);
+	uint16 remaining;
+	uint16 period;          /*0 = one shot*/
+	uint8  armed;           /*Single byte so it is written atomically*/
+}TIMERS_TimerType;
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static volatile uint32 s_ticks = 0;
+
+static volatile TIMERS_TimerType s_timers[TIMERS_MAX_TIMERS];
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void TIMERS_tick(void);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void TIMERS_init(void)
+{
+   /***************** Timer 1 Settings ****************
+	*  Initial Value 	= 0
+	*  Compare Value 	= 1249 ( every 10 ms )
+	*  Pre-Scalar 		= F_CPU/64
+	*  Timer1 Mode		= CTC (Compare Mode)
+	*************************************************/
+	Timer1_ConfigType s_Timer1Config = {0,(uint16)TIMERS_COUNTS_PER_TICK-1,FCPU_64,Compare};
+
+	uint8 timer;
+
+	for(timer = 0 ; timer < TIMERS_MAX_TIMERS ; timer++)
+	{
+		s_timers[timer].armed = FALSE;
+	}
+	s_ticks = 0;
+
+	Timer1_setCallBack(&TIMERS_tick);
+
+	Timer1_init(&s_Timer1Config);
+}
+
+uint32 TIMERS_getTicks(void)
+{
+	uint32 ticks;
+
+	/*The 32-bit counter is updated by the ISR between the byte reads ,
+	 * read again until two reads agree instead of masking interrupts*/
+	do
+	{
+		ticks = s_ticks;
+	}while(ticks != s_ticks);
+
+	return ticks;
+}
+
+uint32 TIMERS_getSeconds(void)
+{
+	return TIMERS_getTicks() / TIMERS_TICKS_PER_SECOND;
+}
+
+TIMERS_IdType TIMERS_start(uint16 a_ticks , TIMERS_ModeType a_mode , void(*a_callBack)(void))
+{
+	TIMERS_IdType timer;
+
+	if(NULL_PTR == a_callBack || 0 == a_ticks)
+	{
+		return TIMERS_INVALID_ID;
+	}
+
+	for(timer = 0 ; timer < TIMERS_MAX_TIMERS ; timer++)
+	{
+		if(FALSE == s_timers[timer].armed)
+		{
+			/*Arm the timer last , the ISR skips the timers that are not armed
+			 * so it never sees a half written call back pointer*/
+			s_timers[timer].callBack = a_callBack;
+			s_timers[timer].remaining = a_ticks;
+			s_timers[timer].period = (TIMERS_PERIODIC == a_mode) ? a_ticks : 0;
+			s_timers[timer].armed = TRUE;
+			return timer;
+		}
+	}
+	return TIMERS_INVALID_ID;
+}
+
+void TIMERS_stop(TIMERS_IdType a_id)
+{
+	if(a_id < TIMERS_MAX_TIMERS)
+	{
+		s_timers[a_id].armed = FALSE;
+	}
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Called by the TIMER1 compare ISR every tick , counts down
+ * the armed timers & calls the expired ones*/
+static void TIMERS_tick(void)
+{
+	uint8 timer;
+
+	s_ticks++;
+
+	for(timer = 0 ; timer < TIMERS_MAX_TIMERS ; timer++)
+	{
+		if(s_timers[timer].armed && 0 == --s_timers[timer].remaining)
+		{
+			if(0 == s_timers[timer].period)
+			{
+				/*One shot : free the timer before calling so
+				 * the call back can start a new one*/
+				s_timers[timer].armed = FALSE;
+			}
+			else
+			{
+				s_timers[timer].remaining = s_timers[timer].period;
+			}
+			s_timers[timer].callBack();
+		}
+	}
+}
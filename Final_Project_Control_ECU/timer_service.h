@@ -0,0 +1,85 @@
+/******************************************************************************
+ *
+ * Module: Timer Service
+ *
+ * File Name: timer_service.h
+ *
+ * Description: Header file for the software timer service
+ * 				(system tick & software timers on top of TIMER1)
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef TIMER_SERVICE_H_
+#define TIMER_SERVICE_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*System tick period*/
+#define TIMERS_TICK_MS			10
+#define TIMERS_TICKS_PER_SECOND	(1000/TIMERS_TICK_MS)
+
+/*TIMER1 clock & counts of one tick (8 us per count at 8 MHz)*/
+#define TIMERS_PRESCALER		64
+#define TIMERS_COUNTS_PER_TICK	((F_CPU/TIMERS_PRESCALER)/TIMERS_TICKS_PER_SECOND)
+#define TIMERS_COUNT_NS			((uint16)((TIMERS_PRESCALER * 1000000UL) / (F_CPU / 1000UL)))
+
+/*Convert milliseconds to ticks (rounded up)*/
+#define TIMERS_MS_TO_TICKS(ms)	(((ms) + TIMERS_TICK_MS - 1) / TIMERS_TICK_MS)
+
+/*Number of software timers that can run at the same time*/
+#define TIMERS_MAX_TIMERS		8
+
+#define TIMERS_INVALID_ID		0xFF
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef uint8 TIMERS_IdType;
+
+typedef enum
+{
+	TIMERS_ONE_SHOT , TIMERS_PERIODIC
+}TIMERS_ModeType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Start TIMER1 in CTC mode generating the system tick
+ * and clear all software timers*/
+void TIMERS_init(void);
+
+/* Description :
+ * Return the number of ticks since TIMERS_init*/
+uint32 TIMERS_getTicks(void);
+
+/* Description :
+ * Return the number of seconds since TIMERS_init*/
+uint32 TIMERS_getSeconds(void);
+
+/* Description :
+ * Start a software timer that calls a_callBack after a_ticks ticks
+ * (and every a_ticks ticks if periodic)
+ * The call back runs inside the TIMER1 ISR so it must be short
+ * Returns TIMERS_INVALID_ID if all timers are in use*/
+TIMERS_IdType TIMERS_start(uint16 a_ticks , TIMERS_ModeType a_mode , void(*a_callBack)(void));
+
+/* Description :
+ * Stop a running software timer (ignored if already stopped)*/
+void TIMERS_stop(TIMERS_IdType a_id);
+
+#endif /* TIMER_SERVICE_H_ */
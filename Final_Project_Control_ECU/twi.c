@@ -1,106 +1,310 @@
- /******************************************************************************
- *
- * Module: TWI(I2C)
- *
- * File Name: twi.h
- *
- * Description: Source file for the TWI(I2C) AVR driver
- *
- * Author: Mohamed Tarek
- *
- * Modified by : Karim Amr
- *
-******************************************************************************/
- 
-#include "twi.h"
-#include "common_macros.h"
-#include <avr/io.h>
-
-void TWI_init(const TWI_ConfigType * Config_Ptr)
-{
-    /* Bit Rate: set bit rate from Config_Ptr using zero pre-scaler TWPS=00 and F_CPU value*/
-	/*It's advised by AVR to leave pre-scalar to One*/
-
-    TWBR = (uint8)((F_CPU/(2UL*(Config_Ptr->bit_rate)))-8UL);
-
-    /*Status Register = 0 ; Pre-scalar bits = 0*/
-	TWSR = 0x00;
-	
-    /* Two Wire Bus address set by Config_Ptr
-     * and Left Shifted by ONE to be sent as 7-bits address
-       General Call Recognition: Off */
-    TWAR = ((Config_Ptr->address)<<1);
-
-    TWCR = (1<<TWEN); /* enable TWI */
-}
-
-void TWI_start(void)
-{
-    /* 
-	 * Clear the TWINT flag before sending the start bit TWINT=1
-	 * send the start bit by TWSTA=1
-	 * Enable TWI Module TWEN=1 
-	 */
-    TWCR = (1 << TWINT) | (1 << TWSTA) | (1 << TWEN);
-    
-    /* Wait for TWINT flag set in TWCR Register (start bit is send successfully) */
-    while(BIT_IS_CLEAR(TWCR,TWINT));
-}
-
-void TWI_stop(void)
-{
-    /* 
-	 * Clear the TWINT flag before sending the stop bit TWINT=1
-	 * send the stop bit by TWSTO=1
-	 * Enable TWI Module TWEN=1 
-	 */
-    TWCR = (1 << TWINT) | (1 << TWSTO) | (1 << TWEN);
-}
-
-void TWI_writeByte(uint8 data)
-{
-    /* Put data On TWI data Register */
-    TWDR = data;
-    /* 
-	 * Clear the TWINT flag before sending the data TWINT=1
-	 * Enable TWI Module TWEN=1 
-	 */ 
-    TWCR = (1 << TWINT) | (1 << TWEN);
-    /* Wait for TWINT flag set in TWCR Register(data is send successfully) */
-    while(BIT_IS_CLEAR(TWCR,TWINT));
-}
-
-uint8 TWI_readByteWithACK(void)
-{
-	/* 
-	 * Clear the TWINT flag before reading the data TWINT=1
-	 * Enable sending ACK after reading or receiving data TWEA=1
-	 * Enable TWI Module TWEN=1 
-	 */ 
-    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWEA);
-    /* Wait for TWINT flag set in TWCR Register (data received successfully) */
-    while(BIT_IS_CLEAR(TWCR,TWINT));
-    /* Read Data */
-    return TWDR;
-}
-
-uint8 TWI_readByteWithNACK(void)
-{
-	/* 
-	 * Clear the TWINT flag before reading the data TWINT=1
-	 * Enable TWI Module TWEN=1 
-	 */
-    TWCR = (1 << TWINT) | (1 << TWEN);
-    /* Wait for TWINT flag set in TWCR Register (data received successfully) */
-    while(BIT_IS_CLEAR(TWCR,TWINT));
-    /* Read Data */
-    return TWDR;
-}
-
-uint8 TWI_getStatus(void)
-{
-    uint8 status;
-    /* masking to eliminate first 3 bits and get the last 5 bits (status bits) */
-    status = TWSR & 0xF8;
-    return status;
-}
+ /******************************************************************************
+ *
+ * Module: TWI(I2C)
+ *
+ * File Name: twi.h
+ *
+ * Description: Source file for the TWI(I2C) AVR driver
+ *
+ * Author: Mohamed Tarek
+ *
+ * Modified by : Karim Amr
+ *
+******************************************************************************/
+ 
+#include "twi.h"
+#include "common_macros.h"
+#include "gpio.h"
+#include <avr/io.h>
+#include <util/delay.h> /* To bound the waits & time the bus clear clocks */
+
+/* TWINT is checked every TWI_POLL_TIME_US while waiting */
+#define TWI_POLL_TIME_US    2
+#define TWI_TIMEOUT_POLLS   (TWI_TIMEOUT_US / TWI_POLL_TIME_US)
+
+/* Bus pins , driven by hand to clear a stuck bus */
+#define TWI_PORT_ID         PORTC_ID
+#define TWI_SCL_PIN_ID      PIN0_ID
+#define TWI_SDA_PIN_ID      PIN1_ID
+
+/* Half period of the bus clear clock (100 KHz) */
+#define TWI_RECOVER_HALF_US 5
+
+/* Set when the last wait timed out , reported by TWI_getStatus */
+static volatile boolean s_timedOut = FALSE;
+
+/* TWPS values : pre-scaler = 4^TWPS */
+#define TWI_PRESCALERS      4
+
+/* Last requested rate & the rate the registers give */
+static uint32 s_requestedRate = 0;
+static uint32 s_actualRate = 0;
+
+static void TWI_waitFlag(void);
+static void TWI_waitStop(void);
+static void TWI_releaseLine(uint8 pin);
+static void TWI_pullLineLow(uint8 pin);
+
+void TWI_init(const TWI_ConfigType * Config_Ptr)
+{
+    /* Bit Rate: TWBR & pre-scaler closest to Config_Ptr->bit_rate */
+    s_requestedRate = 0;
+    TWI_setBitRate(Config_Ptr->bit_rate);
+	
+    /* Two Wire Bus address set by Config_Ptr
+     * and Left Shifted by ONE to be sent as 7-bits address
+       General Call Recognition: Off */
+    TWAR = ((Config_Ptr->address)<<1);
+
+    TWCR = (1<<TWEN); /* enable TWI */
+}
+
+void TWI_start(void)
+{
+    /* 
+	 * Clear the TWINT flag before sending the start bit TWINT=1
+	 * send the start bit by TWSTA=1
+	 * Enable TWI Module TWEN=1 
+	 */
+    s_timedOut = FALSE;
+    TWCR = (1 << TWINT) | (1 << TWSTA) | (1 << TWEN);
+    
+    /* Wait for TWINT flag set in TWCR Register (start bit is send successfully) */
+    TWI_waitFlag();
+}
+
+void TWI_stop(void)
+{
+    /* 
+	 * Clear the TWINT flag before sending the stop bit TWINT=1
+	 * send the stop bit by TWSTO=1
+	 * Enable TWI Module TWEN=1 
+	 */
+    TWCR = (1 << TWINT) | (1 << TWSTO) | (1 << TWEN);
+
+    /* The next START can only be sent once the STOP is on the bus */
+    TWI_waitStop();
+}
+
+void TWI_writeByte(uint8 data)
+{
+    /* Put data On TWI data Register */
+    TWDR = data;
+    /* 
+	 * Clear the TWINT flag before sending the data TWINT=1
+	 * Enable TWI Module TWEN=1 
+	 */ 
+    TWCR = (1 << TWINT) | (1 << TWEN);
+    /* Wait for TWINT flag set in TWCR Register(data is send successfully) */
+    TWI_waitFlag();
+}
+
+uint8 TWI_readByteWithACK(void)
+{
+	/* 
+	 * Clear the TWINT flag before reading the data TWINT=1
+	 * Enable sending ACK after reading or receiving data TWEA=1
+	 * Enable TWI Module TWEN=1 
+	 */ 
+    TWCR = (1 << TWINT) | (1 << TWEN) | (1 << TWEA);
+    /* Wait for TWINT flag set in TWCR Register (data received successfully) */
+    TWI_waitFlag();
+    /* Read Data */
+    return TWDR;
+}
+
+uint8 TWI_readByteWithNACK(void)
+{
+	/* 
+	 * Clear the TWINT flag before reading the data TWINT=1
+	 * Enable TWI Module TWEN=1 
+	 */
+    TWCR = (1 << TWINT) | (1 << TWEN);
+    /* Wait for TWINT flag set in TWCR Register (data received successfully) */
+    TWI_waitFlag();
+    /* Read Data */
+    return TWDR;
+}
+
+uint8 TWI_getStatus(void)
+{
+    uint8 status;
+
+    if(s_timedOut)
+    {
+        return TWI_TIMEOUT;
+    }
+    /* masking to eliminate first 3 bits and get the last 5 bits (status bits) */
+    status = TWSR & 0xF8;
+    return status;
+}
+
+void TWI_abort(void)
+{
+    switch(TWI_getStatus())
+    {
+    case TWI_TIMEOUT:
+        /* A slave holds the bus , no STOP can be sent */
+        TWI_recoverBus();
+        break;
+
+    case TWI_BUS_ERROR:
+        /* TWSTO releases the lines without sending a STOP */
+        TWCR = (1 << TWINT) | (1 << TWSTO) | (1 << TWEN);
+        TWI_waitStop();
+        break;
+
+    case TWI_ARB_LOST:
+        /* The other master owns the bus , just leave it */
+        TWCR = (1 << TWINT) | (1 << TWEN);
+        break;
+
+    default:
+        TWI_stop();
+        break;
+    }
+}
+
+void TWI_recoverBus(void)
+{
+    uint8 clock;
+
+    /* Give the pins back to the port , TWBR , TWSR & TWAR keep their values */
+    TWCR = 0;
+
+    /* Lines are open drain : released = input (external pull-ups) , low = output 0 */
+    TWI_releaseLine(TWI_SDA_PIN_ID);
+    TWI_releaseLine(TWI_SCL_PIN_ID);
+    _delay_us(TWI_RECOVER_HALF_US);
+
+    /* The slave shifts out the rest of its byte , it releases SDA within 9 clocks */
+    for(clock = 0 ; clock < 9 && LOGIC_LOW == GPIO_readPin(TWI_PORT_ID,TWI_SDA_PIN_ID) ; clock++)
+    {
+        TWI_pullLineLow(TWI_SCL_PIN_ID);
+        _delay_us(TWI_RECOVER_HALF_US);
+        TWI_releaseLine(TWI_SCL_PIN_ID);
+        _delay_us(TWI_RECOVER_HALF_US);
+    }
+
+    /* STOP : SDA rises while SCL is high */
+    TWI_pullLineLow(TWI_SDA_PIN_ID);
+    _delay_us(TWI_RECOVER_HALF_US);
+    TWI_releaseLine(TWI_SCL_PIN_ID);
+    _delay_us(TWI_RECOVER_HALF_US);
+    TWI_releaseLine(TWI_SDA_PIN_ID);
+    _delay_us(TWI_RECOVER_HALF_US);
+
+    s_timedOut = FALSE;
+    TWCR = (1 << TWEN); /* enable TWI */
+}
+
+uint32 TWI_setBitRate(uint32 a_rate)
+{
+    uint8 twps;
+    uint8 bestTwps = 0;
+    uint8 bestTwbr = 0xFF;
+    uint32 twbr;
+    uint32 divider;
+    uint32 rate;
+
+    if(a_rate == s_requestedRate)
+    {
+        return s_actualRate;
+    }
+
+    s_requestedRate = a_rate;
+    s_actualRate = 0;
+
+    /* SCL = F_CPU / (16 + 2 * TWBR * 4^TWPS) , every pre-scaler is tried
+     * with the smallest TWBR that doesn't go above the requested rate */
+    for(twps = 0 ; twps < TWI_PRESCALERS ; twps++)
+    {
+        divider = 2UL << (2 * twps);
+        twbr = 0;
+        if((F_CPU / a_rate) > 16UL)
+        {
+            twbr = ((F_CPU / a_rate) - 16UL + divider - 1) / divider;
+        }
+        if(twbr < TWI_MIN_TWBR)
+        {
+            twbr = TWI_MIN_TWBR;
+        }
+        if(twbr > 0xFF)
+        {
+            continue; /* Too slow for this pre-scaler */
+        }
+
+        rate = F_CPU / (16UL + divider * twbr);
+        if(rate > s_actualRate)
+        {
+            s_actualRate = rate;
+            bestTwps = twps;
+            bestTwbr = (uint8)twbr;
+        }
+    }
+
+    if(0 == s_actualRate)
+    {
+        /* Below the slowest rate , take it */
+        s_actualRate = F_CPU / (16UL + (2UL << (2 * (TWI_PRESCALERS - 1))) * 0xFFUL);
+        bestTwps = TWI_PRESCALERS - 1;
+    }
+
+    TWBR = bestTwbr;
+    TWSR = bestTwps; /* Only the pre-scaler bits are writable */
+
+    return s_actualRate;
+}
+
+uint32 TWI_getBitRate(void)
+{
+    return s_actualRate;
+}
+
+/* Description :
+ * Wait for TWINT at most TWI_TIMEOUT_US , a timeout is kept for TWI_getStatus*/
+static void TWI_waitFlag(void)
+{
+    uint16 polls = TWI_TIMEOUT_POLLS;
+
+    while(BIT_IS_CLEAR(TWCR,TWINT))
+    {
+        if(0 == polls)
+        {
+            s_timedOut = TRUE;
+            return;
+        }
+        polls--;
+        _delay_us(TWI_POLL_TIME_US);
+    }
+}
+
+/* Description :
+ * Wait for the STOP to be sent (TWSTO cleared by the hardware) at most TWI_TIMEOUT_US*/
+static void TWI_waitStop(void)
+{
+    uint16 polls = TWI_TIMEOUT_POLLS;
+
+    while(BIT_IS_SET(TWCR,TWSTO))
+    {
+        if(0 == polls)
+        {
+            s_timedOut = TRUE;
+            return;
+        }
+        polls--;
+        _delay_us(TWI_POLL_TIME_US);
+    }
+}
+
+static void TWI_releaseLine(uint8 pin)
+{
+    GPIO_setupPinDirection(TWI_PORT_ID,pin,PIN_INPUT);
+    GPIO_writePin(TWI_PORT_ID,pin,LOGIC_LOW); /* No internal pull-up */
+}
+
+static void TWI_pullLineLow(uint8 pin)
+{
+    GPIO_writePin(TWI_PORT_ID,pin,LOGIC_LOW);
+    GPIO_setupPinDirection(TWI_PORT_ID,pin,PIN_OUTPUT);
+}
@@ -1,59 +1,98 @@
- /******************************************************************************
- *
- * Module: TWI(I2C)
- *
- * File Name: twi.h
- *
- * Description: Header file for the TWI(I2C) AVR driver
- *
- * Author: Mohamed Tarek
- *
- * Modified by : Karim Amr
- *
-******************************************************************************/
-
-#ifndef TWI_H_
-#define TWI_H_
-
-#include "std_types.h"
-
-typedef uint8 TWI_Address ;
-
-/*Any Value higher than Fast_Mode will cause -ve TWBR */
-typedef enum
-{
-	Normal_Mode=100000UL,Fast_Mode=400000UL,Fast_Plus_Mode=1000000UL,High_Speed_Mode=3400000UL
-}TWI_BaudRate;
-
-typedef struct{
- TWI_Address address;
- TWI_BaudRate bit_rate;
-}TWI_ConfigType;
-
-
-/*******************************************************************************
- *                      Preprocessor Macros                                    *
- *******************************************************************************/
-
-/* I2C Status Bits in the TWSR Register */
-#define TWI_START         0x08 /* start has been sent */
-#define TWI_REP_START     0x10 /* repeated start */
-#define TWI_MT_SLA_W_ACK  0x18 /* Master transmit ( slave address + Write request ) to slave + ACK received from slave. */
-#define TWI_MT_SLA_R_ACK  0x40 /* Master transmit ( slave address + Read request ) to slave + ACK received from slave. */
-#define TWI_MT_DATA_ACK   0x28 /* Master transmit data and ACK has been received from Slave. */
-#define TWI_MR_DATA_ACK   0x50 /* Master received data and send ACK to slave. */
-#define TWI_MR_DATA_NACK  0x58 /* Master received data but doesn't send ACK to slave. */
-
-/*******************************************************************************
- *                      Functions Prototypes                                   *
- *******************************************************************************/
-void TWI_init(const TWI_ConfigType * Config_Ptr);
-void TWI_start(void);
-void TWI_stop(void);
-void TWI_writeByte(uint8 data);
-uint8 TWI_readByteWithACK(void);
-uint8 TWI_readByteWithNACK(void);
-uint8 TWI_getStatus(void);
-
-
-#endif /* TWI_H_ */
+ /******************************************************************************
+ *
+ * Module: TWI(I2C)
+ *
+ * File Name: twi.h
+ *
+ * Description: Header file for the TWI(I2C) AVR driver
+ *
+ * Author: Mohamed Tarek
+ *
+ * Modified by : Karim Amr
+ *
+******************************************************************************/
+
+#ifndef TWI_H_
+#define TWI_H_
+
+#include "std_types.h"
+
+typedef uint8 TWI_Address ;
+
+/*Requested SCL rates , TWI_init & TWI_setBitRate use the closest rate the
+ * TWBR / TWPS pair can give that is not above the request*/
+typedef enum
+{
+	Normal_Mode=100000UL,Fast_Mode=400000UL,Fast_Plus_Mode=1000000UL,High_Speed_Mode=3400000UL
+}TWI_BaudRate;
+
+typedef struct{
+ TWI_Address address;
+ TWI_BaudRate bit_rate;
+}TWI_ConfigType;
+
+
+/*******************************************************************************
+ *                      Preprocessor Macros                                    *
+ *******************************************************************************/
+
+/* I2C Status Bits in the TWSR Register */
+#define TWI_START         0x08 /* start has been sent */
+#define TWI_REP_START     0x10 /* repeated start */
+#define TWI_MT_SLA_W_ACK  0x18 /* Master transmit ( slave address + Write request ) to slave + ACK received from slave. */
+#define TWI_MT_SLA_R_ACK  0x40 /* Master transmit ( slave address + Read request ) to slave + ACK received from slave. */
+#define TWI_MT_DATA_ACK   0x28 /* Master transmit data and ACK has been received from Slave. */
+#define TWI_MR_DATA_ACK   0x50 /* Master received data and send ACK to slave. */
+#define TWI_MR_DATA_NACK  0x58 /* Master received data but doesn't send ACK to slave. */
+#define TWI_MT_SLA_W_NACK 0x20 /* Slave address + Write request sent , no ACK (busy or absent slave). */
+#define TWI_MT_DATA_NACK  0x30 /* Master transmit data and no ACK from Slave. */
+#define TWI_ARB_LOST      0x38 /* Another master took the bus. */
+#define TWI_MR_SLA_R_NACK 0x48 /* Slave address + Read request sent , no ACK. */
+#define TWI_NO_INFO       0xF8 /* No bus action in progress. */
+#define TWI_BUS_ERROR     0x00 /* Illegal START / STOP seen on the bus. */
+
+/* Driver status (not a TWSR value) : TWINT didn't come within TWI_TIMEOUT_US ,
+ * a slave holds SCL or SDA low */
+#define TWI_TIMEOUT       0x01
+
+/* Longest wait for one bus action (one byte takes 90 us at 100 Kb/s) */
+#define TWI_TIMEOUT_US    1000
+
+/* Smallest TWBR the datasheet allows in master mode ,
+ * caps SCL at F_CPU / 36 (222 Kb/s at 8 MHz) */
+#define TWI_MIN_TWBR      10
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+void TWI_init(const TWI_ConfigType * Config_Ptr);
+void TWI_start(void);
+void TWI_stop(void);
+void TWI_writeByte(uint8 data);
+uint8 TWI_readByteWithACK(void);
+uint8 TWI_readByteWithNACK(void);
+uint8 TWI_getStatus(void);
+
+/* Description :
+ * End a failed transaction & release the bus for the next one , whatever
+ * the failure : STOP after a NACK , bus error & arbitration lost are cleared ,
+ * a timeout runs the bus clear sequence (TWI_recoverBus)*/
+void TWI_abort(void);
+
+/* Description :
+ * Clear a bus held low by a slave stopped in the middle of a byte :
+ * up to 9 SCL clocks until it releases SDA then a STOP ,
+ * the TWI module is enabled again with the same settings*/
+void TWI_recoverBus(void);
+
+/* Description :
+ * Change the SCL rate between two transactions , returns the actual rate
+ * The TWPS / TWBR pair is searched only when the requested rate changes*/
+uint32 TWI_setBitRate(uint32 a_rate);
+
+/* Description :
+ * Return the actual SCL rate in bit/s*/
+uint32 TWI_getBitRate(void);
+
+
+#endif /* TWI_H_ */
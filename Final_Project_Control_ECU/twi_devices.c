@@ -0,0 +1,307 @@
+/******************************************************************************
+ *
+ * Module: TWI Devices
+ *
+ * File Name: twi_devices.c
+ *
+ * Description: Source file for the registry of the TWI bus devices
+ *
+ * 				Write transfer : START , SLA+W , address bytes , data , STOP
+ * 				Read transfer  : START , SLA+W , address bytes , REPEATED START ,
+ * 								 SLA+R , data (NACK on the last byte) , STOP
+ * 				A device without address bytes skips the write phase.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <util/delay.h>
+#include "twi.h"
+
+#include "twi_devices.h"
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef struct
+{
+	TWIDEV_ConfigType config;
+	uint16 errors;
+}TWIDEV_DeviceType;
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static TWIDEV_DeviceType s_devices[TWIDEV_MAX_DEVICES];
+static uint8 s_deviceCount = 0;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static boolean TWIDEV_sendAddress(const TWIDEV_ConfigType * a_config , uint16 a_address);
+static boolean TWIDEV_writeTransfer(const TWIDEV_ConfigType * a_config , uint16 a_address ,
+		const uint8 * a_data , uint16 a_length);
+static boolean TWIDEV_readTransfer(const TWIDEV_ConfigType * a_config , uint16 a_address ,
+		uint8 * a_data , uint16 a_length);
+static void TWIDEV_failed(TWIDEV_DeviceType * a_device , uint8 a_attempt);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+TWIDEV_IdType TWIDEV_register(const TWIDEV_ConfigType * Config_Ptr)
+{
+	if(s_deviceCount >= TWIDEV_MAX_DEVICES)
+	{
+		return TWIDEV_INVALID;
+	}
+
+	s_devices[s_deviceCount].config = *Config_Ptr;
+	s_devices[s_deviceCount].errors = 0;
+
+	return s_deviceCount++;
+}
+
+void TWIDEV_setBitRate(TWIDEV_IdType a_id , uint32 a_bitRate)
+{
+	if(a_id < s_deviceCount)
+	{
+		s_devices[a_id].config.bitRate = a_bitRate;
+	}
+}
+
+boolean TWIDEV_write(TWIDEV_IdType a_id , uint16 a_address , const uint8 * a_data , uint16 a_length)
+{
+	uint8 attempt;
+	TWIDEV_DeviceType * device;
+
+	if(a_id >= s_deviceCount || 0 == a_length)
+	{
+		return FALSE;
+	}
+	device = &s_devices[a_id];
+
+	for(attempt = 0 ; attempt < TWIDEV_ATTEMPTS ; attempt++)
+	{
+		TWI_setBitRate((0 == attempt) ? device->config.bitRate : TWIDEV_RETRY_BIT_RATE);
+		if(TWIDEV_writeTransfer(&device->config,a_address,a_data,a_length))
+		{
+			return TRUE;
+		}
+		TWIDEV_failed(device,attempt);
+	}
+
+	return FALSE;
+}
+
+boolean TWIDEV_read(TWIDEV_IdType a_id , uint16 a_address , uint8 * a_data , uint16 a_length)
+{
+	uint8 attempt;
+	TWIDEV_DeviceType * device;
+
+	if(a_id >= s_deviceCount || 0 == a_length)
+	{
+		return FALSE;
+	}
+	device = &s_devices[a_id];
+
+	for(attempt = 0 ; attempt < TWIDEV_ATTEMPTS ; attempt++)
+	{
+		TWI_setBitRate((0 == attempt) ? device->config.bitRate : TWIDEV_RETRY_BIT_RATE);
+		if(TWIDEV_readTransfer(&device->config,a_address,a_data,a_length))
+		{
+			return TRUE;
+		}
+		TWIDEV_failed(device,attempt);
+	}
+
+	return FALSE;
+}
+
+boolean TWIDEV_probe(TWIDEV_IdType a_id)
+{
+	boolean found;
+
+	if(a_id >= s_deviceCount)
+	{
+		return FALSE;
+	}
+
+	TWI_setBitRate(s_devices[a_id].config.bitRate);
+	TWI_start();
+	if(TWI_START != TWI_getStatus())
+	{
+		TWI_abort();
+		return FALSE;
+	}
+
+	TWI_writeByte((uint8)(s_devices[a_id].config.address << 1));
+	found = (TWI_MT_SLA_W_ACK == TWI_getStatus());
+
+	/*A NACK or a timeout is ended like any failed transfer*/
+	if(found)
+	{
+		TWI_stop();
+	}
+	else
+	{
+		TWI_abort();
+	}
+
+	return found;
+}
+
+uint16 TWIDEV_getErrors(TWIDEV_IdType a_id)
+{
+	return (a_id < s_deviceCount) ? s_devices[a_id].errors : 0;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * START , SLA+W (with the block bits) & the address bytes (MSB first)
+ * Returns FALSE at the first unexpected status*/
+static boolean TWIDEV_sendAddress(const TWIDEV_ConfigType * a_config , uint16 a_address)
+{
+	uint8 block;
+	uint8 byte;
+
+	/*The address bits above the address bytes select the block*/
+	block = (uint8)((a_address >> (8 * a_config->addressBytes)) & ((1 << a_config->blockBits) - 1));
+
+	TWI_start();
+	if(TWI_START != TWI_getStatus())
+	{
+		return FALSE;
+	}
+
+	TWI_writeByte((uint8)((a_config->address | block) << 1));
+	if(TWI_MT_SLA_W_ACK != TWI_getStatus())
+	{
+		return FALSE;
+	}
+
+	for(byte = a_config->addressBytes ; byte > 0 ; byte--)
+	{
+		TWI_writeByte((uint8)(a_address >> (8 * (byte - 1))));
+		if(TWI_MT_DATA_ACK != TWI_getStatus())
+		{
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+/* Description :
+ * One write transfer , returns FALSE at the first unexpected status
+ * leaving the bus to the caller (TWI_abort)*/
+static boolean TWIDEV_writeTransfer(const TWIDEV_ConfigType * a_config , uint16 a_address ,
+		const uint8 * a_data , uint16 a_length)
+{
+	uint16 i;
+
+	if(FALSE == TWIDEV_sendAddress(a_config,a_address))
+	{
+		return FALSE;
+	}
+
+	for(i = 0 ; i < a_length ; i++)
+	{
+		TWI_writeByte(a_data[i]);
+		if(TWI_MT_DATA_ACK != TWI_getStatus())
+		{
+			return FALSE;
+		}
+	}
+
+	TWI_stop();
+	return TRUE;
+}
+
+/* Description :
+ * One sequential read , same error handling as TWIDEV_writeTransfer*/
+static boolean TWIDEV_readTransfer(const TWIDEV_ConfigType * a_config , uint16 a_address ,
+		uint8 * a_data , uint16 a_length)
+{
+	uint8 block;
+	uint8 expected = TWI_START;
+	uint16 i;
+
+	if(a_config->addressBytes > 0)
+	{
+		/*Write phase : load the address counter of the device*/
+		if(FALSE == TWIDEV_sendAddress(a_config,a_address))
+		{
+			return FALSE;
+		}
+		expected = TWI_REP_START;
+	}
+
+	block = (uint8)((a_address >> (8 * a_config->addressBytes)) & ((1 << a_config->blockBits) - 1));
+
+	TWI_start();
+	if(expected != TWI_getStatus())
+	{
+		return FALSE;
+	}
+
+	TWI_writeByte((uint8)(((a_config->address | block) << 1) | 1));
+	if(TWI_MT_SLA_R_ACK != TWI_getStatus())
+	{
+		return FALSE;
+	}
+
+	/*ACK every byte except the last one , the device keeps
+	 * incrementing its address counter*/
+	for(i = 0 ; i < (a_length - 1) ; i++)
+	{
+		a_data[i] = TWI_readByteWithACK();
+		if(TWI_MR_DATA_ACK != TWI_getStatus())
+		{
+			return FALSE;
+		}
+	}
+
+	a_data[i] = TWI_readByteWithNACK();
+	if(TWI_MR_DATA_NACK != TWI_getStatus())
+	{
+		return FALSE;
+	}
+
+	TWI_stop();
+	return TRUE;
+}
+
+/* Description :
+ * Count the failed attempt , release the bus & back off
+ * (1 , 2 , 4 ms ... nothing after the last attempt)*/
+static void TWIDEV_failed(TWIDEV_DeviceType * a_device , uint8 a_attempt)
+{
+	uint8 wait;
+
+	a_device->errors++;
+	TWI_abort();
+
+	if(a_attempt >= (TWIDEV_ATTEMPTS - 1))
+	{
+		return;
+	}
+
+	/*_delay_ms needs a constant , wait 1 ms at a time*/
+	for(wait = (uint8)(TWIDEV_FIRST_BACKOFF << a_attempt) ; wait > 0 ; wait--)
+	{
+		_delay_ms(1);
+	}
+}
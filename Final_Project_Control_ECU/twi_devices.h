@@ -0,0 +1,96 @@
+/******************************************************************************
+ *
+ * Module: TWI Devices
+ *
+ * File Name: twi_devices.h
+ *
+ * Description: Header file for the registry of the TWI bus devices
+ * 				(EEPROMs , RTC , I/O expanders ...)
+ *
+ * 				A device is described once (address , word address size ,
+ * 				block bits & fastest SCL) & every transfer runs on its own
+ * 				SCL rate , a failed attempt is aborted & retried with a
+ * 				back-off so a glitching part costs a few ms , not a hang.
+ *
+ * 				The transfers are blocking & only called from the main loop ,
+ * 				one ends (STOP or bus clear) before the next one starts so
+ * 				the devices take the bus in the order they are called.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef TWI_DEVICES_H_
+#define TWI_DEVICES_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Number of devices that can be registered*/
+#define TWIDEV_MAX_DEVICES		6
+
+#define TWIDEV_INVALID			0xFF
+
+/*A failed transfer is aborted (STOP / bus clear) and tried again after
+ * 1 , 2 then 4 ms : a glitch costs a few ms , a dead part returns FALSE*/
+#define TWIDEV_ATTEMPTS			4
+#define TWIDEV_FIRST_BACKOFF	1
+
+/*The retries may come from a marginal bus , they run at the standard rate*/
+#define TWIDEV_RETRY_BIT_RATE	Normal_Mode
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef uint8 TWIDEV_IdType;
+
+typedef struct
+{
+	uint8 address;			/*7-bit address (block 0 for the 24C04 .. 24C16)*/
+	uint8 addressBytes;		/*Word / register address bytes after the SLA (0 .. 2)*/
+	uint8 blockBits;		/*High word address bits folded into the SLA (24C16 = 3)*/
+	uint32 bitRate;			/*Fastest SCL rate of the part (bit/s)*/
+}TWIDEV_ConfigType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Add a device to the bus , the configuration is copied
+ * Returns TWIDEV_INVALID if all places are in use*/
+TWIDEV_IdType TWIDEV_register(const TWIDEV_ConfigType * Config_Ptr);
+
+/* Description :
+ * Change the SCL rate of the device transfers*/
+void TWIDEV_setBitRate(TWIDEV_IdType a_id , uint32 a_bitRate);
+
+/* Description :
+ * Write a_length bytes from a_address (word / register address of the device)
+ * Returns FALSE if all the attempts failed*/
+boolean TWIDEV_write(TWIDEV_IdType a_id , uint16 a_address , const uint8 * a_data , uint16 a_length);
+
+/* Description :
+ * Read a_length bytes from a_address (sequential read)
+ * Returns FALSE if all the attempts failed*/
+boolean TWIDEV_read(TWIDEV_IdType a_id , uint16 a_address , uint8 * a_data , uint16 a_length);
+
+/* Description :
+ * Return TRUE if the device acknowledges its address (one attempt)*/
+boolean TWIDEV_probe(TWIDEV_IdType a_id);
+
+/* Description :
+ * Return the failed attempts of the device since power on*/
+uint16 TWIDEV_getErrors(TWIDEV_IdType a_id);
+
+#endif /* TWI_DEVICES_H_ */
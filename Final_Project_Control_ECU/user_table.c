@@ -0,0 +1,423 @@
+/******************************************************************************
+ *
+ * Module: User Table
+ *
+ * File Name: user_table.c
+ *
+ * Description: Source file for the multi-user credential table
+ * 				stored inside the external EEPROM
+ *
+ * 				Each user is one 16-byte record (one EEPROM page) , the
+ * 				code itself is never stored , only its 32-bit hash.
+ * 				A small open-addressed hash table in RAM maps the upper
+ * 				16 bits of the hash (fingerprint) to the record slot so a
+ * 				code is verified with one probe sequence & one record read
+ * 				instead of scanning the whole table inside EEPROM.
+ *
+ * 				A user limited to a weekly schedule has a 168-bit bitmap
+ * 				(one bit per hour of the week) prepared by the admin tool ,
+ * 				the check reads the single byte holding the current hour.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "user_table.h"
+#include "external_eeprom.h"
+#include "rtc.h" /*For the hour of the week*/
+#include <stddef.h> /*For offsetof*/
+#include <util/delay.h> /*To wait for the EEPROM write cycle*/
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef struct
+{
+	uint16 fingerprint;
+	uint8  slot; /*USERS_NO_USER = empty bucket*/
+}USERS_IndexEntry;
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static USERS_IndexEntry s_index[USERS_INDEX_SIZE];
+
+/*Bit per slot , set if the slot holds a user*/
+static uint16 s_usedSlots = 0;
+
+/*Permission bits cached per slot to avoid EEPROM reads*/
+static uint8 s_permissions[USERS_MAX_USERS];
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static uint32 USERS_hashCode(const uint8 * a_code);
+static void USERS_buildIndex(void);
+static void USERS_indexInsert(uint32 a_hash , uint8 a_slot);
+static uint8 USERS_lookup(uint32 a_hash , USERS_RecordType * a_record);
+static uint8 USERS_readRecord(uint8 a_slot , USERS_RecordType * a_record);
+static uint8 USERS_writeRecord(const USERS_RecordType * a_record);
+static uint8 USERS_writeSchedule(uint8 a_id , const uint8 * a_schedule);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void USERS_init(void)
+{
+	USERS_buildIndex();
+}
+
+uint8 USERS_count(void)
+{
+	uint8 count = 0;
+	uint16 slots = s_usedSlots;
+
+	/*Count the set bits*/
+	while(slots)
+	{
+		slots &= (slots - 1);
+		count++;
+	}
+	return count;
+}
+
+boolean USERS_exists(uint8 a_id)
+{
+	if(a_id >= USERS_MAX_USERS)
+	{
+		return FALSE;
+	}
+	return (s_usedSlots & (1U << a_id)) ? TRUE : FALSE;
+}
+
+USERS_Status USERS_add(uint8 a_id , const uint8 * a_code , uint8 a_permissions ,
+		uint32 a_validFrom , uint32 a_validUntil)
+{
+	USERS_RecordType record;
+	uint32 hash;
+	uint8 owner;
+	boolean replacing;
+
+	if(a_id >= USERS_MAX_USERS)
+	{
+		return USERS_INVALID_ID;
+	}
+
+	hash = USERS_hashCode(a_code);
+
+	/*Two users can't share the same code , the lookup would be ambiguous*/
+	owner = USERS_lookup(hash,&record);
+	if(owner != USERS_NO_USER && owner != a_id)
+	{
+		return USERS_DUPLICATE;
+	}
+
+	replacing = USERS_exists(a_id);
+
+	record.codeHash    = hash;
+	record.validFrom   = a_validFrom;
+	record.validUntil  = a_validUntil;
+	record.id          = a_id;
+	record.permissions = a_permissions;
+	record.status      = USERS_SLOT_USED;
+	record.reserved    = 0xFF;
+
+	if(ERROR == USERS_writeRecord(&record))
+	{
+		return USERS_STORAGE_ERROR;
+	}
+
+	if(replacing)
+	{
+		/*The old hash is still inside the index , rebuild it*/
+		USERS_buildIndex();
+	}
+	else
+	{
+		s_usedSlots |= (1U << a_id);
+		s_permissions[a_id] = a_permissions;
+		USERS_indexInsert(hash,a_id);
+	}
+	return USERS_OK;
+}
+
+USERS_Status USERS_changeCode(uint8 a_id , const uint8 * a_code)
+{
+	USERS_RecordType record;
+
+	if(FALSE == USERS_exists(a_id))
+	{
+		return USERS_NOT_FOUND;
+	}
+	if(ERROR == USERS_readRecord(a_id,&record))
+	{
+		return USERS_STORAGE_ERROR;
+	}
+	return USERS_add(a_id,a_code,record.permissions,record.validFrom,record.validUntil);
+}
+
+USERS_Status USERS_remove(uint8 a_id)
+{
+	if(FALSE == USERS_exists(a_id))
+	{
+		return USERS_NOT_FOUND;
+	}
+
+	/*Only the status byte is cleared , the rest of the record is left as is*/
+	if(ERROR == EEPROM_writeByte(USERS_TABLE_ADDRESS + (uint16)a_id * USERS_RECORD_SIZE
+			+ offsetof(USERS_RecordType,status),0xFF))
+	{
+		return USERS_STORAGE_ERROR;
+	}
+	_delay_ms(EEPROM_WRITE_CYCLE_TIME);
+
+	/*Removing from an open-addressed table would break the probe
+	 * sequences of the following entries , so rebuild it (rare operation)*/
+	USERS_buildIndex();
+
+	return USERS_OK;
+}
+
+USERS_Status USERS_setAccess(uint8 a_id , uint8 a_limits , uint32 a_validFrom ,
+		uint32 a_validUntil , const uint8 * a_schedule)
+{
+	USERS_RecordType record;
+
+	if(FALSE == USERS_exists(a_id))
+	{
+		return USERS_NOT_FOUND;
+	}
+	if(ERROR == USERS_readRecord(a_id,&record))
+	{
+		return USERS_STORAGE_ERROR;
+	}
+
+	/*The schedule is in place before the record points to it*/
+	if((a_limits & USERS_LIMIT_SCHEDULE) && ERROR == USERS_writeSchedule(a_id,a_schedule))
+	{
+		return USERS_STORAGE_ERROR;
+	}
+
+	record.permissions = (record.permissions & ~USERS_LIMITS) | (a_limits & USERS_LIMITS);
+	record.validFrom   = a_validFrom;
+	record.validUntil  = a_validUntil;
+
+	if(ERROR == USERS_writeRecord(&record))
+	{
+		return USERS_STORAGE_ERROR;
+	}
+
+	s_permissions[a_id] = record.permissions;
+	return USERS_OK;
+}
+
+boolean USERS_consume(uint8 a_id)
+{
+	if(!(USERS_getPermissions(a_id) & USERS_LIMIT_ONE_TIME))
+	{
+		return FALSE;
+	}
+	return (USERS_OK == USERS_remove(a_id)) ? TRUE : FALSE;
+}
+
+USERS_Status USERS_verify(const uint8 * a_code , uint32 a_now , uint8 * a_id)
+{
+	USERS_RecordType record;
+	uint8 slot;
+	uint8 hour;
+	uint8 hours;
+
+	slot = USERS_lookup(USERS_hashCode(a_code),&record);
+
+	if(USERS_NO_USER == slot)
+	{
+		return USERS_NOT_FOUND;
+	}
+
+	/*The user is known even if refused , the lockout policy counts it*/
+	*a_id = slot;
+
+	/*Validity window , a limited code can't be checked without time = refused*/
+	if(record.validFrom != 0 || record.validUntil != 0)
+	{
+		if(USERS_TIME_UNKNOWN == a_now ||
+		   (record.validFrom != 0 && a_now < record.validFrom) ||
+		   (record.validUntil != 0 && a_now > record.validUntil))
+		{
+			return USERS_EXPIRED;
+		}
+	}
+
+	/*Schedule : one bit of the precomputed weekly bitmap , no time = refused*/
+	if(record.permissions & USERS_LIMIT_SCHEDULE)
+	{
+		if(USERS_TIME_UNKNOWN == a_now)
+		{
+			return USERS_OUTSIDE_HOURS;
+		}
+
+		hour = RTC_hourOfWeek(a_now);
+		if(ERROR == EEPROM_readByte(USERS_SCHEDULE_ADDRESS + (uint16)slot * USERS_SCHEDULE_SIZE
+				+ hour / 8,&hours) || !(hours & (1 << (hour % 8))))
+		{
+			return USERS_OUTSIDE_HOURS;
+		}
+	}
+
+	return USERS_OK;
+}
+
+uint8 USERS_getPermissions(uint8 a_id)
+{
+	if(FALSE == USERS_exists(a_id))
+	{
+		return 0;
+	}
+	return s_permissions[a_id];
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * 32-bit FNV-1a hash over the code digits*/
+static uint32 USERS_hashCode(const uint8 * a_code)
+{
+	uint32 hash = 2166136261UL;
+	uint8 digit;
+
+	for(digit = 0 ; digit < USERS_CODE_LENGTH ; digit++)
+	{
+		hash ^= a_code[digit];
+		hash *= 16777619UL;
+	}
+	return hash;
+}
+
+/* Description :
+ * Clear the RAM index and refill it from the records inside EEPROM*/
+static void USERS_buildIndex(void)
+{
+	USERS_RecordType record;
+	uint8 slot;
+
+	for(slot = 0 ; slot < USERS_INDEX_SIZE ; slot++)
+	{
+		s_index[slot].slot = USERS_NO_USER;
+	}
+	s_usedSlots = 0;
+
+	for(slot = 0 ; slot < USERS_MAX_USERS ; slot++)
+	{
+		if(SUCCESS == USERS_readRecord(slot,&record) &&
+		   USERS_SLOT_USED == record.status && slot == record.id)
+		{
+			s_usedSlots |= (1U << slot);
+			s_permissions[slot] = record.permissions;
+			USERS_indexInsert(record.codeHash,slot);
+		}
+	}
+}
+
+/* Description :
+ * Insert the slot at the first free bucket of the hash probe sequence
+ * (linear probing , the table is never more than half full)*/
+static void USERS_indexInsert(uint32 a_hash , uint8 a_slot)
+{
+	uint8 bucket = (uint8)a_hash & (USERS_INDEX_SIZE - 1);
+
+	while(s_index[bucket].slot != USERS_NO_USER)
+	{
+		bucket = (bucket + 1) & (USERS_INDEX_SIZE - 1);
+	}
+	s_index[bucket].fingerprint = (uint16)(a_hash >> 16);
+	s_index[bucket].slot = a_slot;
+}
+
+/* Description :
+ * Walk the probe sequence of the hash , confirm fingerprint hits against
+ * the full hash stored inside EEPROM & return the matching slot
+ * (record copied into a_record) or USERS_NO_USER*/
+static uint8 USERS_lookup(uint32 a_hash , USERS_RecordType * a_record)
+{
+	uint8 bucket = (uint8)a_hash & (USERS_INDEX_SIZE - 1);
+	uint16 fingerprint = (uint16)(a_hash >> 16);
+	uint8 probes;
+
+	for(probes = 0 ; probes < USERS_INDEX_SIZE ; probes++)
+	{
+		if(USERS_NO_USER == s_index[bucket].slot)
+		{
+			break;
+		}
+		if(fingerprint == s_index[bucket].fingerprint &&
+		   SUCCESS == USERS_readRecord(s_index[bucket].slot,a_record) &&
+		   USERS_SLOT_USED == a_record->status && a_hash == a_record->codeHash)
+		{
+			return s_index[bucket].slot;
+		}
+		bucket = (bucket + 1) & (USERS_INDEX_SIZE - 1);
+	}
+	return USERS_NO_USER;
+}
+
+/* Description :
+ * Read one full record with a single sequential EEPROM read*/
+static uint8 USERS_readRecord(uint8 a_slot , USERS_RecordType * a_record)
+{
+	return EEPROM_readBlock(USERS_TABLE_ADDRESS + (uint16)a_slot * USERS_RECORD_SIZE,
+			(uint8 *)a_record,USERS_RECORD_SIZE);
+}
+
+/* Description :
+ * Write one full record , one record = one page = one EEPROM write cycle*/
+static uint8 USERS_writeRecord(const USERS_RecordType * a_record)
+{
+	if(ERROR == EEPROM_writePage(USERS_TABLE_ADDRESS + (uint16)a_record->id * USERS_RECORD_SIZE,
+			(const uint8 *)a_record,USERS_RECORD_SIZE))
+	{
+		return ERROR;
+	}
+	_delay_ms(EEPROM_WRITE_CYCLE_TIME);
+	return SUCCESS;
+}
+
+/* Description :
+ * Write the weekly schedule of a user , one page write per EEPROM page it covers*/
+static uint8 USERS_writeSchedule(uint8 a_id , const uint8 * a_schedule)
+{
+	uint16 address = USERS_SCHEDULE_ADDRESS + (uint16)a_id * USERS_SCHEDULE_SIZE;
+	uint8 written = 0;
+	uint8 length;
+
+	while(written < USERS_SCHEDULE_BYTES)
+	{
+		/*Up to the end of the page*/
+		length = EEPROM_PAGE_SIZE - (address % EEPROM_PAGE_SIZE);
+		if(length > USERS_SCHEDULE_BYTES - written)
+		{
+			length = USERS_SCHEDULE_BYTES - written;
+		}
+
+		if(ERROR == EEPROM_writePage(address,&a_schedule[written],length))
+		{
+			return ERROR;
+		}
+		_delay_ms(EEPROM_WRITE_CYCLE_TIME);
+
+		address += length;
+		written += length;
+	}
+	return SUCCESS;
+}
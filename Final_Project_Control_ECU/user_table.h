@@ -0,0 +1,147 @@
+/******************************************************************************
+ *
+ * Module: User Table
+ *
+ * File Name: user_table.h
+ *
+ * Description: Header file for the multi-user credential table
+ * 				stored inside the external EEPROM
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef USER_TABLE_H_
+#define USER_TABLE_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Length of a user code (digits)*/
+#define USERS_CODE_LENGTH		5
+
+/*Table location inside EEPROM : 16 records * 16 bytes = 0x0100 .. 0x01FF
+ * Every record is exactly one EEPROM page so it is written in one cycle*/
+#define USERS_TABLE_ADDRESS		0x0100
+#define USERS_RECORD_SIZE		16
+#define USERS_MAX_USERS			16
+
+/*RAM index size , must be a power of two & at least twice
+ * the number of users to keep the probe sequences short*/
+#define USERS_INDEX_SIZE		32
+
+/*The user ID is the slot number inside the table*/
+#define USERS_ADMIN_ID			0
+#define USERS_NO_USER			0xFF
+
+/*Permission bits*/
+#define USERS_PERM_DOOR			0x01 /*Allowed to open the door*/
+#define USERS_PERM_ADMIN		0x02 /*Allowed to add / remove users*/
+
+/*Access limits , kept in the permissions byte (clear in the records written before)*/
+#define USERS_LIMIT_ONE_TIME	0x04 /*The code is removed once it opened the door*/
+#define USERS_LIMIT_SCHEDULE	0x08 /*Only valid in the hours set in its weekly schedule*/
+#define USERS_LIMITS			(USERS_LIMIT_ONE_TIME | USERS_LIMIT_SCHEDULE)
+
+/*Weekly schedules inside EEPROM : 16 * 24 bytes = 0x0240 .. 0x03BF
+ * Bit (h % 8) of byte (h / 8) is set if the user is allowed in hour h
+ * of the week (0 = Monday 00:00 .. 167 = Sunday 23:00)*/
+#define USERS_SCHEDULE_ADDRESS	0x0240
+#define USERS_SCHEDULE_SIZE		24
+#define USERS_SCHEDULE_BYTES	21
+
+/*Record status marker , any other value (erased EEPROM = 0xFF) is a free slot*/
+#define USERS_SLOT_USED			0xA5
+
+/*Passed as current time when no time source is available ,
+ * the users limited to a validity window or a schedule
+ * are refused in this case*/
+#define USERS_TIME_UNKNOWN		0
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef enum
+{
+	USERS_OK , USERS_NOT_FOUND , USERS_EXPIRED , USERS_INVALID_ID ,
+	USERS_DUPLICATE , USERS_STORAGE_ERROR , USERS_OUTSIDE_HOURS
+}USERS_Status;
+
+/*EEPROM record layout , 32-bit members first so the layout is
+ * the same with or without structure packing*/
+typedef struct
+{
+	uint32 codeHash;	/*FNV-1a hash of the code digits*/
+	uint32 validFrom;	/*Window start , 0 = no lower bound*/
+	uint32 validUntil;	/*Window end , 0 = no upper bound*/
+	uint8  id;
+	uint8  permissions;
+	uint8  status;
+	uint8  reserved;
+}USERS_RecordType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Scan the table inside EEPROM once and build the RAM index*/
+void USERS_init(void);
+
+/* Description :
+ * Return the number of users currently stored*/
+uint8 USERS_count(void);
+
+/* Description :
+ * Return TRUE if the given slot holds a user*/
+boolean USERS_exists(uint8 a_id);
+
+/* Description :
+ * Add a user OR replace the code/settings of an existing one
+ * Fails with USERS_DUPLICATE if another user already owns the same code*/
+USERS_Status USERS_add(uint8 a_id , const uint8 * a_code , uint8 a_permissions ,
+		uint32 a_validFrom , uint32 a_validUntil);
+
+/* Description :
+ * Change the code of an existing user keeping its settings*/
+USERS_Status USERS_changeCode(uint8 a_id , const uint8 * a_code);
+
+/* Description :
+ * Free the slot of the given user*/
+USERS_Status USERS_remove(uint8 a_id);
+
+/* Description :
+ * Set the access limits of an existing user (USERS_LIMIT_xx bits) ,
+ * its validity window & its weekly schedule (USERS_SCHEDULE_BYTES ,
+ * only used with USERS_LIMIT_SCHEDULE)*/
+USERS_Status USERS_setAccess(uint8 a_id , uint8 a_limits , uint32 a_validFrom ,
+		uint32 a_validUntil , const uint8 * a_schedule);
+
+/* Description :
+ * Remove the user if its code is a one-time code , called once the code
+ * has been used to open the door
+ * Returns TRUE if the user was removed*/
+boolean USERS_consume(uint8 a_id);
+
+/* Description :
+ * Look up the code through the RAM index (constant time , one EEPROM
+ * record read on a fingerprint hit) , check its validity window & the
+ * hour of a_now inside its weekly schedule (one EEPROM byte) and return
+ * the matching user ID through a_id (also returned when refused)*/
+USERS_Status USERS_verify(const uint8 * a_code , uint32 a_now , uint8 * a_id);
+
+/* Description :
+ * Return the permission bits of the given user (0 if not found)*/
+uint8 USERS_getPermissions(uint8 a_id);
+
+#endif /* USER_TABLE_H_ */
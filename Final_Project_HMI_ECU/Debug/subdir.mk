@@ -8,24 +8,45 @@ C_SRCS += \
 ../LCD.c \
 ../TIMER1.c \
 ../USART.c \
+../bench.c \
+../bench_drivers.c \
+../crc16.c \
+../diagnostics.c \
+../door_sequence.c \
 ../gpio.c \
-../keypad.c 
+../keypad.c \
+../stack_monitor.c \
+../watchdog.c 
 
 OBJS += \
 ./Final_Project_HMI_ECU.o \
 ./LCD.o \
 ./TIMER1.o \
 ./USART.o \
+./bench.o \
+./bench_drivers.o \
+./crc16.o \
+./diagnostics.o \
+./door_sequence.o \
 ./gpio.o \
-./keypad.o 
+./keypad.o \
+./stack_monitor.o \
+./watchdog.o 
 
 C_DEPS += \
 ./Final_Project_HMI_ECU.d \
 ./LCD.d \
 ./TIMER1.d \
 ./USART.d \
+./bench.d \
+./bench_drivers.d \
+./crc16.d \
+./diagnostics.d \
+./door_sequence.d \
 ./gpio.d \
-./keypad.d 
+./keypad.d \
+./stack_monitor.d \
+./watchdog.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -1,678 +1,1022 @@
-/******************************************************************************
- *
- * Project: Door Locker Security System (Standard Embedded Diploma Final Project )
- *
- * File Name: Final_Project_HMI_ECU.c
- *
- * Created on: Mar 11, 2024
- *
- * Author: Karim Amr
- *
- * Group = 84
- *
- * Description: System that controls Locking/Unlocking door motor using
- * 				password to be set by user
- *
- * 				This is the HMI interface that allows user to control the system
- *
- * 				This code was able to achieve a maximum on only 52% CPU load in Proteus !
- *
-******************************************************************************/
-
-
-/*******************************************************************************
- *                            Required Libraries                               *
- *******************************************************************************/
-
-#include "LCD.h"
-#include "keypad.h"
-#include "USART.h"
-#include "TIMER1.h"
-#include <util/delay.h> /*To use simple delay functions*/
-
-/********************************************************************************
- *                                 Definitions     	 	                        *
- ********************************************************************************/
-
-/*Length of the Password*/
-#define PASSWORD_LENGTH 5
-
-/*Motor operation time in Seconds*/
-#define MOTOR_START_TIME 			0
-#define MOTOR_UNLOCKING_TIME 		15
-#define MOTOR_STOP_TIME  			3
-#define MOTOR_STOPPING_TIME 		(MOTOR_UNLOCKING_TIME+MOTOR_STOP_TIME)
-#define MOTOR_LOCK_TIME   			15
-#define MOTOR_LOCKING_TIME			(MOTOR_UNLOCKING_TIME+MOTOR_STOP_TIME+MOTOR_LOCK_TIME)
-
-/*-----------------------------------------------------------------------------*/
-
-typedef enum
-{
-	MainMenu , UnmatchedPW , OpenDoor , ChangePW , EmptyLoop
-}Application_State;
-
-typedef enum
-{
-	EmptyPW , IncorrectPW , CorrectPW
-}Password_Results;
-
-typedef enum
-{
-	Loop , SetPW , EnterPW , OpenningDoor , LockedMode
-}UART_commands;
-
-/********************************************************************************
- *                              Global Variables	                            *
- ********************************************************************************/
-
-Application_State APP_nextState ;
-
-UART_commands UART_nextState = Loop ;
-
-Password_Results PW_Result = EmptyPW;
-
-/********************************************************************************
- *                              Function Prototypes	                            *
- ********************************************************************************/
-
-/*Description:
- * Get the password from user twice to set it inside the EEPROM */
-uint8 setPassword(void);
-
-/*Description:
- * Sends the password entries to Control ECU to check it it's matched
- * and get feedback of matching result*/
-uint8 isPasswordMatched(const uint8 * a_firstEntry , const uint8 * a_secondEntry);
-
-/*Description:
- * Receive password from user to compare it with set password in EEPROM
- * in order to proceed forward with the desired operation */
-uint8 passwordEntry(void);
-
-/*Description:
- * Gets the password received from user to send it to EEPROM
- * for comparison and get feedback from Control ECU
- * whether if the password in correct/incorrect */
-void passwordState(const Password_Results * a_Result);
-
-/*Description:
- * Displays the Main Menu options on LCD display
- * and gets input from user for the desired operation
- * whether to open the door or change the password*/
-void mainMenu(void);
-
-/*Description:
- * Displays the status of the door opening operation
- * on the LCD display and shows
- * whether it's unlocking , locking or stopped*/
-void displayDoorStatus(void);
-
-/*Description:
- * Activate Locked mode on the whole system and sends command to Control ECU
- * to also initiate locked mode */
-void lockedMode(void);
-
-/********************************************************************************
- *                              Application Code	                            *
- ********************************************************************************/
-
-
-
-int main()
-{
-   /************************ Configuration Structure *********************/
-
-   /***************** UART Settings ****************
-	*  Data Bit Mode 		= 8 Bits
-	*  Parity Check 		= Even Parity
-	*  Number of Stop Bits  = One
-	*  Baud Rate			= 9600
-	*************************************************/
-	UART_ConfigType s_UARTconfig = {EightBit,EvenParity,OneStopBit,9600};
-
-   /***************** Timer 1 Settings ****************
-	*  Initial Value 	= 0
-	*  Compare Value 	= 7813 ( every one second )
-	*  Pre-Scalar 		= F_CPU/1024
-	*  Timer1 Mode		= CTC (Compare Mode)
-	*************************************************/
-	Timer1_ConfigType s_Timer1Config = {0,7813,FCPU_1024,Compare};
-
-	/*********************************************************************/
-
-	/************************ Drivers Initializations *********************/
-
-	UART_init(&s_UARTconfig); /*UART Init. with req. configuration*/
-
-	_delay_ms(10); /*Allow time for transmission & initialization*/
-
-	LCD_init(); /*LCD Init.*/
-
-	_delay_ms(10); /*Allow time for transmission & initialization*/
-
-	/*********************************************************************/
-
-	LCD_displayStringRowColumn(0,2,"Welcome To ");
-	LCD_displayStringRowColumn(1,1,"Final Project !");
-
-	_delay_ms(1500); /*Display message for 1.5 seconds*/
-
-	LCD_cleanScreen();
-
-	LCD_moveCursor(0,0);
-
-	/* If password are matched and saved in EEPROM ,
-	 * nextStatus will be set to Main_menu
-	 * OR
-	 * will return UmatchedPW*/
-	APP_nextState = setPassword();
-
-
-	/***************************** Main Loop ****************************/
-
-	while(1)
-	{
-		/*Checks the required application function*/
-		switch(APP_nextState)
-		{
-		case MainMenu : /*Password set Success !*/
-
-			/*Display Main Menu*/
-			mainMenu();
-			break;
-
-		case UnmatchedPW : /*Failed password match  */
-
-			LCD_cleanScreen();
-
-			LCD_displayString("    Error !");
-
-			LCD_displayStringRowColumn(1,0,"Unmatched pass");
-
-			_delay_ms(1000); /*Display message for 1 second*/
-
-			LCD_cleanScreen();
-
-			APP_nextState = setPassword();
-
-			break;
-
-		case OpenDoor : /*Door unlocking is triggered , password entry is requested*/
-
-			PW_Result = passwordEntry();
-
-			if (CorrectPW == PW_Result) /*If password matches with EEPROM , proceed*/
-			{
-
-				passwordState(&PW_Result); /*To reset wrong password counter*/
-
-				UART_nextState = OpenningDoor;
-
-				/*Send command through UART to Control ECU to start door actions*/
-				UART_sendByte(UART_nextState);
-
-				_delay_ms(20); /*Allow time for transmission*/
-
-				/*Synchronization*/
-				/*If a feedback is received from Control ECU ,
-				 * initiate TIMER1 counter and start displaying status*/
-				if(OpenningDoor == UART_recieveByte())
-				{
-					LCD_cleanScreen();
-
-					/*Set the function to be called by TIMER 1 ISR*/
-					Timer1_setCallBack(&displayDoorStatus);
-
-					/*Initiate TIMER with the required configuration*/
-					Timer1_init(&s_Timer1Config);
-
-					/*Send the application to empty loop until the operation is complete*/
-					APP_nextState = EmptyLoop;
-
-					/*To prevent the One second delay until the first Interrupt occurs*/
-
-					/*Requires that the counter if conditions to be incremented by an extra ONE
-					 * for correct timing adjustment*/
-					/*displayDoorStatus();*/
-				}
-
-
-			}
-			/*If password doesn't match with EEPROM ,
-			 * allow user to try again if possible (check passwordState)*/
-			else if(IncorrectPW == PW_Result)
-			{
-				passwordState(&PW_Result);
-			}
-
-			break;
-
-		case ChangePW : /*Password changing is triggered , password entry is requested*/
-
-			PW_Result = passwordEntry();
-
-			if (CorrectPW == PW_Result) /*If password matches with EEPROM , proceed*/
-			{
-				passwordState(&PW_Result); /*To reset wrong password counter*/
-
-				LCD_cleanScreen();
-				LCD_displayStringRowColumn(0,2,"Choose New");
-				LCD_displayStringRowColumn(1,3,"Password");
-				_delay_ms(1000); /*Display message for 1 second*/
-				LCD_cleanScreen();
-
-				APP_nextState = setPassword(); /*Set the new password*/
-			}
-			/*If password doesn't match with EEPROM ,
-			 * allow user to try again if possible (check passwordState)*/
-			else if(IncorrectPW == PW_Result)
-			{
-				passwordState(&PW_Result);
-			}
-			break;
-
-		case EmptyLoop:
-			/*The target from the empty loop is to make the application
-			 * do the lowest possible tasks to reduce CPU load
-			 * until the Application status is updated
-			 * & to prevent confliction between tasks*/
-			break;
-		}
-	}
-	/*********************************************************************/
-}
-
-
-/********************************************************************************
- *                              Functions Definitions                           *
- ********************************************************************************/
-
-void mainMenu(void)
-{
-	uint8 menuSelect = 0; /*Local variable for menu selection*/
-
-
-	LCD_cleanScreen();
-
-	LCD_displayStringRowColumn(0,0,"+ : Open Door");
-	LCD_displayStringRowColumn(1,0,"- : Change Pass");
-
-	/*Polling on menu options INSIDE the function*/
-	while(menuSelect != '+' && menuSelect != '-' )
-	{
-		menuSelect = KEYPAD_getPressedKey(); /*Get input from user through Keypad*/
-
-		/*De-bounce delay */
-		_delay_ms(100);
-	}
-
-	if('+' == menuSelect) /*Case '+' is chosen , trigger door opening state*/
-	{
-		menuSelect = 0; /*Reset selection*/
-		APP_nextState = OpenDoor ;
-	}
-
-	else if ('-' == menuSelect) /*Case '-' is chosen , trigger password changing state*/
-	{
-		menuSelect = 0; /*Reset selection*/
-		APP_nextState = ChangePW ;
-	}
-
-}
-
-uint8 setPassword(void)
-{
-	/*2 Local array of password size to get the password digit in it*/
-	uint8 firstPasswordEntry[PASSWORD_LENGTH] = {0} ;
-	uint8 secondPasswordEntry[PASSWORD_LENGTH] = {0} ;
-
-	uint8 digitCheck ;
-
-	/*data type is signed to fit the condition check if decrement was applied ZERO*/
-	sint8 passwordDigitCounter ;
-
-	Application_State matchingResult ;
-
-	LCD_displayString("Enter password :");
-
-	LCD_moveCursor(1,0);
-
-	/*First Password Entry*/
-	/*Loop on the array to collect the required the password digits*/
-	for(passwordDigitCounter = 0 ; passwordDigitCounter < PASSWORD_LENGTH ; passwordDigitCounter++)
-	{
-		/*Place the received input into another variable first for two reasons :
-		 * 1 - To check if the received input is a numeric digit
-		 * 2 - To allow a de-bounce delay  */
-		digitCheck = KEYPAD_getPressedKey() ;
-
-		/*De-Bounce delay*/
-		_delay_ms(300);
-
-		/*check if input is numeric digit*/
-		if(digitCheck>=0 && digitCheck<=9)
-		{
-			/*Place the final value inside the relative array position*/
-			firstPasswordEntry[passwordDigitCounter] = digitCheck;
-
-			/*The following steps will print the the number entered and will
-			 * be replaced shortly on LCD display with '*' character*/
-			LCD_intgerToString(firstPasswordEntry[passwordDigitCounter]);
-
-			_delay_ms(200);
-
-			LCD_moveCursor(1,passwordDigitCounter);
-
-			LCD_displayCharacter('*');
-		}
-		else
-		{
-			/*If the variable wasn't numeric , repeat the iteration once again*/
-			passwordDigitCounter--;
-		}
-	}
-
-	/*Once the entry is completed , confirm by
-	 * pressing on '=' to proceed to next step*/
-	while(KEYPAD_getPressedKey() != '=');
-
-	LCD_cleanScreen();
-
-	LCD_displayString("Re-Enter the ");
-
-	LCD_displayStringRowColumn(1,0,"same pass: ");
-
-	LCD_moveCursor(1,11);
-
-	/*Second Password Entry*/
-	/*Loop on the array to collect the required the password digits*/
-	for(passwordDigitCounter = 0 ; passwordDigitCounter < PASSWORD_LENGTH ; passwordDigitCounter++)
-	{
-		/*Place the received input into another variable first for two reasons :
-		 * 1 - To check if the received input is a numeric digit
-		 * 2 - To allow a de-bounce delay  */
-		digitCheck = KEYPAD_getPressedKey() ;
-
-		/*De-Bounce delay*/
-		_delay_ms(300);
-
-		/*check if input is numeric digit*/
-		if(digitCheck>=0 && digitCheck<=9)
-		{
-			/*Place the final value inside the relative array position*/
-			secondPasswordEntry[passwordDigitCounter] = digitCheck;
-
-			/*The following steps will print the the number entered and will
-			 * be replaced shortly on LCD display with '*' character*/
-			LCD_intgerToString(secondPasswordEntry[passwordDigitCounter]);
-
-			_delay_ms(200);
-
-			LCD_moveCursor(1,11+passwordDigitCounter);
-
-			LCD_displayCharacter('*');
-		}
-		else
-		{
-			/*If the variable wasn't numeric , repeat the iteration once again*/
-			passwordDigitCounter--;
-		}
-	}
-
-	/*Once the entry is completed , confirm by
-	 * pressing on '=' to proceed to next step*/
-	while(KEYPAD_getPressedKey() != '=');
-
-	/*Send the two arrays through to EEPROM via Control ECU */
-	matchingResult = isPasswordMatched(firstPasswordEntry,secondPasswordEntry);
-
-	/*Return the matching result confirming whether
-	* the password was set or unmatched*/
-	return matchingResult ;
-
-}
-
-uint8 isPasswordMatched(const uint8 * a_firstEntry , const uint8 * a_secondEntry)
-{
-	/*next Control ECU state is to set the PW if matched or return unmatched*/
-	UART_nextState = SetPW;
-
-	/*Send command to Control ECU via UART to go to set password state*/
-	UART_sendByte(UART_nextState);
-
-	/*Send first password Entry*/
-	UART_sendData(a_firstEntry,PASSWORD_LENGTH);
-
-	_delay_ms(100); /*Allow time for transmission*/
-
-	/*Send second password Entry*/
-	UART_sendData(a_secondEntry,PASSWORD_LENGTH);
-
-	_delay_ms(100); /*Allow time for transmission*/
-
-	/*Receives either password is matched & set OR need to be entered again*/
-	return UART_recieveByte();
-
-}
-
-uint8 passwordEntry(void)
-{
-	/*Local array of password size to get the password digits in it*/
-	uint8 passwordEntryArray[PASSWORD_LENGTH] = {0} ;
-
-	/*data type is signed to fit the condition check if decrement was applied ZERO*/
-	sint8 passwordDigitCounter ;
-	uint8 digitCheck ;
-
-	/*next Control ECU state is to get a password to check if correct or incorrect*/
-	UART_nextState = EnterPW;
-
-	LCD_cleanScreen();
-
-	/*Send command to Control ECU via UART to go to enter password state*/
-	UART_sendByte(UART_nextState);
-
-	_delay_ms(10); /*Allow time for transmission*/
-
-	LCD_displayString("Enter password :");
-
-	LCD_moveCursor(1,0);
-
-	/*Loop on the array to collect the required the password digits*/
-	for(passwordDigitCounter = 0 ; passwordDigitCounter < PASSWORD_LENGTH ; passwordDigitCounter++)
-	{
-		/*Place the received input into another variable first for two reasons :
-		 * 1 - To check if the received input is a numeric digit
-		 * 2 - To allow a de-bounce delay  */
-		digitCheck = KEYPAD_getPressedKey() ;
-
-		/*De-Bounce delay*/
-		_delay_ms(300);
-
-		/*check if input is numeric digit*/
-		if(digitCheck>=0 && digitCheck<=9)
-		{
-			/*Place the final value inside the relative array position*/
-			passwordEntryArray[passwordDigitCounter] = digitCheck ;
-
-			/*The following steps will print the the number entered and will
-			 * be replaced shortly on LCD display with '*' character*/
-			LCD_intgerToString(passwordEntryArray[passwordDigitCounter]);
-
-			_delay_ms(200);
-
-			LCD_moveCursor(1,passwordDigitCounter);
-
-			LCD_displayCharacter('*');
-		}
-		else
-		{
-			/*If the variable wasn't numeric , repeat the iteration once again*/
-			passwordDigitCounter--;
-		}
-	}
-
-	/*Once the entry is completed , confirm by
-	 * pressing on '=' to proceed to next step*/
-	while(KEYPAD_getPressedKey() != '=');
-
-	/*Send the password Entry*/
-	UART_sendData(passwordEntryArray,PASSWORD_LENGTH);
-
-	_delay_ms(100); /*Allow time for transmission*/
-
-	/*Receive pw_match results to check whether correct / incorrect password*/
-	return UART_recieveByte();
-
-}
-
-void passwordState(const Password_Results * a_Result)
-{
-	/*Static variable to collect the number of times the
-	 * password entered was incorrect*/
-	static uint8 wrongPasswordCounter = 0;
-
-	/*If the maximum allowable entries of password are reached
-	 * it will redirect to Locked mode !*/
-	if(2 == wrongPasswordCounter && IncorrectPW == *a_Result )
-	{
-		wrongPasswordCounter=0;
-		lockedMode();
-	}
-
-	/*If the password was incorrect , increment wrong password
-	 * entries counter by one and display message on LCD */
-	else if(IncorrectPW == *a_Result)
-	{
-		wrongPasswordCounter++;
-		LCD_cleanScreen();
-
-		LCD_displayString("Incorrect PW !");
-
-		_delay_ms(500); /*display message for 0.5 second*/
-	}
-
-	/*If entered password was correct , reset wrong password entries counter*/
-	else if (CorrectPW == *a_Result)
-	{
-		wrongPasswordCounter=0;
-	}
-
-	/*Reset password status back to empty*/
-	PW_Result = EmptyPW;
-}
-
-void displayDoorStatus(void)
-{
-	/*Set the counter to static to increase lifetime through out
-	 * the run time & set to volatile to disable compiler
-	 * optimization on the variable*/
-	static volatile uint8 doorTimerCounter = MOTOR_START_TIME;
-
-	/*Display the main message that won't be altered at first iteration*/
-	if(MOTOR_START_TIME==doorTimerCounter)
-	LCD_displayStringRowColumn(0,0,"Door is ");
-
-	/*Timer counter value is within unlocking mode*/
-	if(doorTimerCounter < MOTOR_UNLOCKING_TIME)
-	{
-		if(MOTOR_START_TIME==doorTimerCounter)
-		LCD_displayStringRowColumn(1,0,"Unlocking");
-
-
-		/*A buffer animation on screen :D*/
-		/*A number divisible by 3 , display three dots*/
-		if(BIT_IS_SET(doorTimerCounter,0) && BIT_IS_SET(doorTimerCounter,1))
-		{
-			LCD_displayStringRowColumn(1,9,"...");
-		}
-		/*An even number , display two dots*/
-		else if(BIT_IS_SET(doorTimerCounter,1) )
-		{
-			LCD_displayStringRowColumn(1,9,".. ");
-		}
-		/*An odd number , display one dot*/
-		else if(BIT_IS_SET(doorTimerCounter,0))
-		{
-			LCD_displayStringRowColumn(1,9,".  ");
-		}
-
-		/*Increment timer by one , which means one second has passed */
-		doorTimerCounter++;
-
-	}
-
-	/*Timer counter value is within stop mode*/
-	else if (doorTimerCounter >=MOTOR_UNLOCKING_TIME && doorTimerCounter<MOTOR_STOPPING_TIME)
-	{
-		if(MOTOR_UNLOCKING_TIME==doorTimerCounter)
-		LCD_displayStringRowColumn(1,0,"Unlocked !  ");
-
-		/*Increment timer by one , which means one second has passed */
-		doorTimerCounter++;
-	}
-
-	/*Timer counter value is within locking mode*/
-	else if(doorTimerCounter >=MOTOR_STOPPING_TIME && doorTimerCounter  < (MOTOR_LOCKING_TIME))
-	{
-		if((MOTOR_STOPPING_TIME)==doorTimerCounter)
-		LCD_displayStringRowColumn(1,0,"Locking");
-
-		/*A buffer animation on screen :D*/
-		/*A number divisible by 3 , display three dots*/
-		if(BIT_IS_SET(doorTimerCounter,0) && BIT_IS_SET(doorTimerCounter,1))
-		{
-			LCD_displayStringRowColumn(1,7,"...");
-		}
-		/*An even number , display two dots*/
-		else if(BIT_IS_SET(doorTimerCounter,1) )
-		{
-			LCD_displayStringRowColumn(1,7,".. ");
-		}
-		/*An odd number , display one dot*/
-		else if(BIT_IS_SET(doorTimerCounter,0))
-		{
-			LCD_displayStringRowColumn(1,7,".  ");
-		}
-
-		/*Increment timer by one , which means one second has passed */
-		doorTimerCounter++;
-	}
-
-	/*IF Timer counter reached the last required time ,
-	 * Stop / DeInit. TIMER 1 , reset counter & return back to Main Menu*/
-	else if(doorTimerCounter == MOTOR_LOCKING_TIME	)
-	{
-		Timer1_deInit();
-		doorTimerCounter=0;
-		APP_nextState = MainMenu ;
-	}
-}
-
-void lockedMode(void)
-{
-
-	/*Set the next Control ECU state to be in locked mode*/
-	UART_nextState = LockedMode;
-
-	/*Send the UART command*/
-	UART_sendByte(UART_nextState);
-
-	_delay_ms(10); /*Allow time for transmission */
-
-	LCD_cleanScreen();
-
-	LCD_displayString("     Error !");
-
-	LCD_displayStringRowColumn(1,0," You're Locked !");
-
-	/*Loop on the previous screen till Control ECU sends a
-	 * command feeding back it has exited locked mode*/
-	while(Loop != UART_recieveByte());
-
-	/*Return back to Main Menu*/
-	APP_nextState = MainMenu ;
-}
-
-/**********************************************************************/
+/******************************************************************************
+ *
+ * Project: Door Locker Security System (Standard Embedded Diploma Final Project )
+ *
+ * File Name: Final_Project_HMI_ECU.c
+ *
+ * Created on: Mar 11, 2024
+ *
+ * Author: Karim Amr
+ *
+ * Group = 84
+ *
+ * Description: System that controls Locking/Unlocking door motor using
+ * 				password to be set by user
+ *
+ * 				This is the HMI interface that allows user to control the system
+ *
+ * 				This code was able to achieve a maximum on only 52% CPU load in Proteus !
+ *
+******************************************************************************/
+
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "LCD.h"
+#include "keypad.h"
+#include "USART.h"
+#include "TIMER1.h"
+#include "door_sequence.h"
+#include "diagnostics.h"
+#include "watchdog.h"
+#include "bench.h"
+#include <avr/interrupt.h>
+#include <avr/wdt.h>
+#include <avr/sleep.h> /*Idle sleep while waiting for the user or Control ECU*/
+#include <util/delay.h> /*To use simple delay functions*/
+
+/********************************************************************************
+ *                                 Definitions     	 	                        *
+ ********************************************************************************/
+
+/*Length of the Password*/
+#define PASSWORD_LENGTH 5
+
+/*Door event frame pushed by Control ECU every second of the door sequence :
+ * DoorPhase / DoorProgress / DoorDone / DoorFault | phase index | seconds inside the phase*/
+#define DOOR_EVENT_SIZE	3
+
+/*The door events are pushed every second , no complete frame within
+ * DOOR_EVENT_TIMEOUT (ms) means a lost byte or a Control ECU reset*/
+#define DOOR_EVENT_TIMEOUT		2000
+
+/*System tick of the CPU load measures : TIMER1 CTC at F_CPU/64 every 10 ms
+ * (8 us per count at 8 MHz) , it also wakes the idle sleep to scan the keypad*/
+#define TICK_PRESCALER			64
+#define TICKS_PER_SECOND		100
+#define TICK_COUNTS				((F_CPU/TICK_PRESCALER)/TICKS_PER_SECOND)
+#define TICK_COUNT_NS			((uint16)((TICK_PRESCALER * 1000000UL) / (F_CPU / 1000UL)))
+
+/*The main loop checks in at least every MAIN_LOOP_DEADLINE (ms) , the waits for
+ * the user & for the end of the lockout check in while they wait , the supervisor
+ * runs every WDG_SUPERVISE_PERIOD (ms) from the system tick*/
+#define MAIN_LOOP_DEADLINE			5000
+#define WDG_SUPERVISE_PERIOD		100
+
+/*Control ECU answers a command within CONTROL_REPLY_TIMEOUT (ms) ,
+ * otherwise it was reset in the middle of the command*/
+#define CONTROL_REPLY_TIMEOUT		1000
+
+/*-----------------------------------------------------------------------------*/
+
+typedef enum
+{
+	MainMenu , UnmatchedPW , OpenDoor , ChangePW , NewUser , DeleteUser , EmptyLoop
+}Application_State;
+
+typedef enum
+{
+	EmptyPW , IncorrectPW , CorrectPW , LockedPW
+}Password_Results;
+
+typedef enum
+{
+	Loop , SetPW , EnterPW , OpenningDoor , LockedMode , SetupStatus ,
+	AddUser , RemoveUser , ReadLog , ExportLog , DoorPhase , DoorProgress ,
+	DoorDone , DoorFault , Diagnostics , SetClock , SetUserAccess
+}UART_commands;
+
+/*Replies of the user management commands (same enum in Control ECU)*/
+typedef enum
+{
+	UserDone , UserUnmatched , UserDenied , UserInvalidID , UserDuplicate ,
+	UserNotFound , UserStorageError
+}User_Results;
+
+/********************************************************************************
+ *                              Global Variables	                            *
+ ********************************************************************************/
+
+Application_State APP_nextState ;
+
+UART_commands UART_nextState = Loop ;
+
+Password_Results PW_Result = EmptyPW;
+
+/*Main loop supervised by the watchdog*/
+WDG_TaskIdType g_mainTask = WDG_NO_TASK ;
+
+/********************************************************************************
+ *                              Function Prototypes	                            *
+ ********************************************************************************/
+
+/*Description:
+ * Get the password from user twice to set it inside the EEPROM */
+uint8 setPassword(void);
+
+/*Description:
+ * Collect the password digits from the keypad into a_entry , each digit
+ * is shown then masked by '*' on the second row starting from a_col ,
+ * the entry is confirmed by pressing '=' */
+void getPasswordDigits(uint8 * a_entry , uint8 a_col);
+
+/*Description:
+ * Sends the password entries to Control ECU to check it it's matched
+ * and get feedback of matching result*/
+uint8 isPasswordMatched(const uint8 * a_firstEntry , const uint8 * a_secondEntry);
+
+/*Description:
+ * Receive password from user to compare it with set password in EEPROM
+ * in order to proceed forward with the desired operation */
+uint8 passwordEntry(void);
+
+/*Description:
+ * Gets the password received from user to send it to EEPROM
+ * for comparison and get feedback from Control ECU
+ * whether if the password in correct/incorrect */
+void passwordState(const Password_Results * a_Result);
+
+/*Description:
+ * Displays the Main Menu options on LCD display
+ * and gets input from user for the desired operation
+ * whether to open the door or change the password*/
+void mainMenu(void);
+
+/*Description:
+ * Receives a door event pushed by Control ECU and displays the text
+ * of the reported phase from the shared phase table on the LCD display
+ * with a progress animation while the motor moves
+ * (HMI ECU keeps no timeline of its own so it can't drift) ,
+ * a missing or unknown event ends the sequence on a fault*/
+void displayDoorStatus(void);
+
+/*Description:
+ * Display the Locked mode started by Control ECU (it counts the wrong
+ * passwords & keeps the lockout across resets) until it feeds back its end */
+void lockedMode(void);
+
+/*Description:
+ * Get a user ID (1 or 2 digits) from the keypad , confirmed by '=' */
+uint8 getUserId(void);
+
+/*Description:
+ * Get a user ID & its code twice from the keypad and send them
+ * to Control ECU to be added to the user table */
+void addUser(void);
+
+/*Description:
+ * Get a user ID from the keypad and send it to Control ECU
+ * to be removed from the user table */
+void removeUser(void);
+
+/*Description:
+ * Display the reply of a user management command for 1 second */
+void displayUserResult(User_Results a_result);
+
+/*Description:
+ * Receive the a_size bytes reply of a command from Control ECU within a_timeout ms ,
+ * if it doesn't answer (reset in the middle of the command) the message is shown
+ * & the application goes back to Main Menu
+ * Returns FALSE on the timeout */
+boolean receiveReply(uint8 * a_reply , uint8 a_size , uint16 a_timeout);
+
+/*Description:
+ * Called from TIMER1 ISR every 10 ms , supervises the watchdog
+ * & samples the CPU load every second */
+void systemTick(void);
+
+/*Description:
+ * Sleep until the next interrupt (system tick , UART) , counted as idle time */
+void idleSleep(void);
+
+/*Description:
+ * Wait for a key press in idle sleep , the keypad is scanned at every wake up */
+uint8 waitForKey(void);
+
+/*Description:
+ * Wait in idle sleep until Control ECU sends a byte */
+void waitForControl(void);
+
+/*Description:
+ * Display the CPU load then the stack usage of HMI ECU
+ * for 2 seconds each (main menu '=' key) */
+void displayDiagnostics(void);
+
+/********************************************************************************
+ *                              Application Code	                            *
+ ********************************************************************************/
+
+
+
+int main()
+{
+   /************************ Configuration Structure *********************/
+
+   /***************** UART Settings ****************
+	*  Data Bit Mode 		= 8 Bits
+	*  Parity Check 		= Even Parity
+	*  Number of Stop Bits  = One
+	*  Baud Rate			= 9600
+	*************************************************/
+	UART_ConfigType s_UARTconfig = {EightBit,EvenParity,OneStopBit,9600};
+
+   /***************** TIMER1 Settings **************
+	*  Initial Value  = 0
+	*  Compare Value  = 10 ms of counts
+	*  Pre-Scalar     = F_CPU/64
+	*  Mode           = Compare (CTC)
+	*************************************************/
+	Timer1_ConfigType s_Timer1config = {0,(uint16)TICK_COUNTS-1,FCPU_64,Compare};
+
+   /***************** Diagnostics ****************
+	*  TIMER1 Period  = counts of one tick
+	*  Count Time     = 8000 ns
+	*  Sample Periods = one second of ticks
+	*************************************************/
+	DIAG_ConfigType s_diagConfig = {TICK_COUNTS,TICK_COUNT_NS,TICKS_PER_SECOND};
+
+   /***************** Watchdog Settings ************
+	*  Timeout          = 2 seconds
+	*  Supervise Period = WDG_SUPERVISE_PERIOD ms
+	*************************************************/
+	WDG_ConfigType s_wdgConfig = {WDTO_2S,WDG_SUPERVISE_PERIOD};
+
+	uint8 reply ; /*Reply of Control ECU to a command*/
+
+	/*********************************************************************/
+
+	/************************ Drivers Initializations *********************/
+
+	UART_init(&s_UARTconfig); /*UART Init. with req. configuration*/
+
+	_delay_ms(10); /*Allow time for transmission & initialization*/
+
+	LCD_init(); /*LCD Init.*/
+
+	_delay_ms(10); /*Allow time for transmission & initialization*/
+
+#if DRIVER_BENCH
+	/*Benchmark build : measure the drivers , report on the UART & stop there*/
+	BENCH_runDrivers();
+	while(1){}
+#endif
+
+	/*The waits for the user & Control ECU sleep between interrupts ,
+	 * IDLE mode keeps TIMER1 & the UART running*/
+	set_sleep_mode(SLEEP_MODE_IDLE);
+
+	DIAG_init(&s_diagConfig);
+	Timer1_setCallBack(&systemTick);
+	Timer1_init(&s_Timer1config);
+
+	/*A wait that never ends (lost reply , stuck driver) resets HMI ECU*/
+	WDG_init(&s_wdgConfig);
+	g_mainTask = WDG_register(MAIN_LOOP_DEADLINE);
+
+	/*********************************************************************/
+
+	LCD_displayStringRowColumn(0,2,"Welcome To ");
+	LCD_displayStringRowColumn(1,1,"Final Project !");
+
+	_delay_ms(1500); /*Display message for 1.5 seconds*/
+
+	LCD_cleanScreen();
+
+	LCD_moveCursor(0,0);
+
+	/*Ask Control ECU if the admin password is already saved in EEPROM ,
+	 * then the password doesn't have to be set again at every power up ,
+	 * asked again until Control ECU answers (still starting up)*/
+	UART_nextState = SetupStatus;
+	do
+	{
+		WDG_checkIn(g_mainTask);
+		UART_sendByte(UART_nextState);
+	}while(UART_RX_OK != UART_receiveExact(&reply,1,CONTROL_REPLY_TIMEOUT));
+
+	if(TRUE == reply)
+	{
+		APP_nextState = MainMenu;
+	}
+	else
+	{
+		/* If password are matched and saved in EEPROM ,
+		 * nextStatus will be set to Main_menu
+		 * OR
+		 * will return UmatchedPW*/
+		APP_nextState = setPassword();
+	}
+
+
+	/***************************** Main Loop ****************************/
+
+	while(1)
+	{
+		/*Every pass of the main loop tells the supervisor it isn't stuck*/
+		WDG_checkIn(g_mainTask);
+
+		/*Checks the required application function*/
+		switch(APP_nextState)
+		{
+		case MainMenu : /*Password set Success !*/
+
+			/*Display Main Menu*/
+			mainMenu();
+			break;
+
+		case UnmatchedPW : /*Failed password match  */
+
+			LCD_cleanScreen();
+
+			LCD_displayString("    Error !");
+
+			LCD_displayStringRowColumn(1,0,"Unmatched pass");
+
+			_delay_ms(1000); /*Display message for 1 second*/
+
+			LCD_cleanScreen();
+
+			APP_nextState = setPassword();
+
+			break;
+
+		case OpenDoor : /*Door unlocking is triggered , password entry is requested*/
+
+			PW_Result = passwordEntry();
+
+			if (CorrectPW == PW_Result) /*If password matches with EEPROM , proceed*/
+			{
+
+				passwordState(&PW_Result); /*To reset password status*/
+
+				UART_nextState = OpenningDoor;
+
+				/*Send command through UART to Control ECU to start door actions*/
+				UART_sendByte(UART_nextState);
+
+				_delay_ms(20); /*Allow time for transmission*/
+
+				/*If a feedback is received from Control ECU ,
+				 * start displaying the door events it pushes*/
+				if(receiveReply(&reply,1,CONTROL_REPLY_TIMEOUT) && OpenningDoor == reply)
+				{
+					LCD_cleanScreen();
+
+					/*Display the main message that won't be altered by the phases*/
+					LCD_displayStringRowColumn(0,0,"Door is ");
+
+					/*Send the application to empty loop until the operation is complete*/
+					APP_nextState = EmptyLoop;
+				}
+
+
+			}
+			/*If password doesn't match with EEPROM ,
+			 * allow user to try again if possible (check passwordState)*/
+			else if(IncorrectPW == PW_Result || LockedPW == PW_Result)
+			{
+				passwordState(&PW_Result);
+			}
+
+			break;
+
+		case ChangePW : /*Password changing is triggered , password entry is requested*/
+
+			PW_Result = passwordEntry();
+
+			if (CorrectPW == PW_Result) /*If password matches with EEPROM , proceed*/
+			{
+				passwordState(&PW_Result); /*To reset password status*/
+
+				LCD_cleanScreen();
+				LCD_displayStringRowColumn(0,2,"Choose New");
+				LCD_displayStringRowColumn(1,3,"Password");
+				_delay_ms(1000); /*Display message for 1 second*/
+				LCD_cleanScreen();
+
+				APP_nextState = setPassword(); /*Set the new password*/
+			}
+			/*If password doesn't match with EEPROM ,
+			 * allow user to try again if possible (check passwordState)*/
+			else if(IncorrectPW == PW_Result || LockedPW == PW_Result)
+			{
+				passwordState(&PW_Result);
+			}
+			break;
+
+		case NewUser : /*User adding is triggered , admin password entry is requested*/
+
+			PW_Result = passwordEntry();
+
+			if (CorrectPW == PW_Result) /*If password matches with EEPROM , proceed*/
+			{
+				passwordState(&PW_Result); /*To reset password status*/
+
+				addUser();
+
+				APP_nextState = MainMenu;
+			}
+			/*If password doesn't match with EEPROM ,
+			 * allow user to try again if possible (check passwordState)*/
+			else if(IncorrectPW == PW_Result || LockedPW == PW_Result)
+			{
+				passwordState(&PW_Result);
+			}
+			break;
+
+		case DeleteUser : /*User removing is triggered , admin password entry is requested*/
+
+			PW_Result = passwordEntry();
+
+			if (CorrectPW == PW_Result) /*If password matches with EEPROM , proceed*/
+			{
+				passwordState(&PW_Result); /*To reset password status*/
+
+				removeUser();
+
+				APP_nextState = MainMenu;
+			}
+			/*If password doesn't match with EEPROM ,
+			 * allow user to try again if possible (check passwordState)*/
+			else if(IncorrectPW == PW_Result || LockedPW == PW_Result)
+			{
+				passwordState(&PW_Result);
+			}
+			break;
+
+		case EmptyLoop:
+			/*The target from the empty loop is to make the application
+			 * do the lowest possible tasks to reduce CPU load
+			 * until the Application status is updated
+			 * & to prevent confliction between tasks*/
+
+			/*Wait for the next door event from Control ECU*/
+			displayDoorStatus();
+			break;
+		}
+	}
+	/*********************************************************************/
+}
+
+
+/********************************************************************************
+ *                              Functions Definitions                           *
+ ********************************************************************************/
+
+void mainMenu(void)
+{
+	uint8 menuSelect = 0; /*Local variable for menu selection*/
+
+
+	LCD_cleanScreen();
+
+	LCD_displayStringRowColumn(0,0,"+:Open -:Change");
+	LCD_displayStringRowColumn(1,0,"*:Add %:Del User");
+
+	/*Polling on menu options INSIDE the function*/
+	while(menuSelect != '+' && menuSelect != '-' && menuSelect != '*' && menuSelect != '%' &&
+		  menuSelect != '=')
+	{
+		menuSelect = waitForKey(); /*Get input from user through Keypad*/
+
+		/*De-bounce delay */
+		_delay_ms(100);
+	}
+
+	/*Drop the bytes Control ECU sent while no command waited for them
+	 * (reply after its timeout , door event sent after its reset)*/
+	while(UART_dataAvailable())
+	{
+		UART_recieveByte();
+	}
+
+	if('+' == menuSelect) /*Case '+' is chosen , trigger door opening state*/
+	{
+		menuSelect = 0; /*Reset selection*/
+		APP_nextState = OpenDoor ;
+	}
+
+	else if ('-' == menuSelect) /*Case '-' is chosen , trigger password changing state*/
+	{
+		menuSelect = 0; /*Reset selection*/
+		APP_nextState = ChangePW ;
+	}
+
+	else if ('*' == menuSelect) /*Case '*' is chosen , trigger user adding state*/
+	{
+		menuSelect = 0; /*Reset selection*/
+		APP_nextState = NewUser ;
+	}
+
+	else if ('%' == menuSelect) /*Case '%' is chosen , trigger user removing state*/
+	{
+		menuSelect = 0; /*Reset selection*/
+		APP_nextState = DeleteUser ;
+	}
+
+	else if ('=' == menuSelect) /*Case '=' is chosen , show the measures & back to Main Menu*/
+	{
+		menuSelect = 0; /*Reset selection*/
+		displayDiagnostics();
+	}
+
+}
+
+uint8 setPassword(void)
+{
+	/*2 Local array of password size to get the password digit in it*/
+	uint8 firstPasswordEntry[PASSWORD_LENGTH] = {0} ;
+	uint8 secondPasswordEntry[PASSWORD_LENGTH] = {0} ;
+
+	Application_State matchingResult ;
+
+	LCD_displayString("Enter password :");
+
+	LCD_moveCursor(1,0);
+
+	/*First Password Entry*/
+	getPasswordDigits(firstPasswordEntry,0);
+
+	LCD_cleanScreen();
+
+	LCD_displayString("Re-Enter the ");
+
+	LCD_displayStringRowColumn(1,0,"same pass: ");
+
+	LCD_moveCursor(1,11);
+
+	/*Second Password Entry*/
+	getPasswordDigits(secondPasswordEntry,11);
+
+	/*Send the two arrays through to EEPROM via Control ECU */
+	matchingResult = isPasswordMatched(firstPasswordEntry,secondPasswordEntry);
+
+	/*Return the matching result confirming whether
+	* the password was set or unmatched*/
+	return matchingResult ;
+
+}
+
+void getPasswordDigits(uint8 * a_entry , uint8 a_col)
+{
+	uint8 digitCheck ;
+
+	/*data type is signed to fit the condition check if decrement was applied ZERO*/
+	sint8 passwordDigitCounter ;
+
+	/*Loop on the array to collect the required the password digits*/
+	for(passwordDigitCounter = 0 ; passwordDigitCounter < PASSWORD_LENGTH ; passwordDigitCounter++)
+	{
+		/*Place the received input into another variable first for two reasons :
+		 * 1 - To check if the received input is a numeric digit
+		 * 2 - To allow a de-bounce delay  */
+		digitCheck = waitForKey() ;
+
+		/*De-Bounce delay*/
+		_delay_ms(300);
+
+		/*check if input is numeric digit*/
+		if(digitCheck<=9)
+		{
+			/*Place the final value inside the relative array position*/
+			a_entry[passwordDigitCounter] = digitCheck;
+
+			/*The following steps will print the the number entered and will
+			 * be replaced shortly on LCD display with '*' character*/
+			LCD_intgerToString(a_entry[passwordDigitCounter]);
+
+			_delay_ms(200);
+
+			LCD_moveCursor(1,a_col+passwordDigitCounter);
+
+			LCD_displayCharacter('*');
+		}
+		else
+		{
+			/*If the variable wasn't numeric , repeat the iteration once again*/
+			passwordDigitCounter--;
+		}
+	}
+
+	/*Once the entry is completed , confirm by
+	 * pressing on '=' to proceed to next step*/
+	while(waitForKey() != '=');
+}
+
+uint8 isPasswordMatched(const uint8 * a_firstEntry , const uint8 * a_secondEntry)
+{
+	uint8 matchingResult ;
+
+	/*next Control ECU state is to set the PW if matched or return unmatched*/
+	UART_nextState = SetPW;
+
+	/*Send command to Control ECU via UART to go to set password state*/
+	UART_sendByte(UART_nextState);
+
+	/*Send first password Entry*/
+	UART_sendData(a_firstEntry,PASSWORD_LENGTH);
+
+	_delay_ms(100); /*Allow time for transmission*/
+
+	/*Send second password Entry*/
+	UART_sendData(a_secondEntry,PASSWORD_LENGTH);
+
+	_delay_ms(100); /*Allow time for transmission*/
+
+	/*Receives either password is matched & set OR need to be entered again*/
+	if(FALSE == receiveReply(&matchingResult,1,CONTROL_REPLY_TIMEOUT))
+	{
+		return MainMenu;
+	}
+	return matchingResult;
+
+}
+
+uint8 passwordEntry(void)
+{
+	/*Local array of password size to get the password digits in it*/
+	uint8 passwordEntryArray[PASSWORD_LENGTH] = {0} ;
+
+	uint8 matchResult ;
+
+	LCD_cleanScreen();
+
+	LCD_displayString("Enter password :");
+
+	LCD_moveCursor(1,0);
+
+	getPasswordDigits(passwordEntryArray,0);
+
+	/*next Control ECU state is to get a password to check if correct or incorrect*/
+	UART_nextState = EnterPW;
+
+	/*Send command to Control ECU via UART to go to enter password state ,
+	 * the password follows it at once (Control ECU doesn't wait for the user)*/
+	UART_sendByte(UART_nextState);
+
+	/*Send the password Entry*/
+	UART_sendData(passwordEntryArray,PASSWORD_LENGTH);
+
+	_delay_ms(100); /*Allow time for transmission*/
+
+	/*Receive pw_match results to check whether correct / incorrect password*/
+	if(FALSE == receiveReply(&matchResult,1,CONTROL_REPLY_TIMEOUT))
+	{
+		return EmptyPW;
+	}
+	return matchResult;
+
+}
+
+void passwordState(const Password_Results * a_Result)
+{
+	/*The wrong passwords are counted by Control ECU , if the maximum
+	 * allowable entries are reached it will redirect to Locked mode !*/
+	if(LockedPW == *a_Result)
+	{
+		lockedMode();
+	}
+
+	/*If the password was incorrect , display message on LCD */
+	else if(IncorrectPW == *a_Result)
+	{
+		LCD_cleanScreen();
+
+		LCD_displayString("Incorrect PW !");
+
+		_delay_ms(500); /*display message for 0.5 second*/
+	}
+
+	/*Reset password status back to empty*/
+	PW_Result = EmptyPW;
+}
+
+void displayDoorStatus(void)
+{
+	/*A buffer animation on screen :D , one more dot every second*/
+	static const char * const progressDots[4] = {"   ",".  ",".. ","..."};
+
+	uint8 doorEvent[DOOR_EVENT_SIZE] ;
+
+	const DOOR_PhaseType * phase ;
+
+	/*No complete frame in time (lost byte , Control ECU reset) is
+	 * handled like an unknown event*/
+	if(UART_RX_OK != UART_receiveExact(doorEvent,DOOR_EVENT_SIZE,DOOR_EVENT_TIMEOUT))
+	{
+		doorEvent[0] = Loop;
+	}
+
+	/*Return back to Main Menu once the door is locked again*/
+	if(DoorDone == doorEvent[0])
+	{
+		APP_nextState = MainMenu ;
+		return;
+	}
+
+	/*Control ECU stopped the motor on a stall / obstruction*/
+	if(DoorFault == doorEvent[0])
+	{
+		LCD_displayStringRowColumn(1,0,"Jammed !        ");
+
+		_delay_ms(2000); /*Display message for 2 seconds*/
+
+		APP_nextState = MainMenu ;
+		return;
+	}
+
+	phase = DOOR_getPhase(DOOR_TYPE,doorEvent[1]);
+
+	/*Unknown event or phase , the next frames can't be trusted*/
+	if((DoorPhase != doorEvent[0] && DoorProgress != doorEvent[0]) || NULL_PTR == phase)
+	{
+		LCD_displayStringRowColumn(1,0,"Door fault !    ");
+
+		_delay_ms(2000); /*Display message for 2 seconds*/
+
+		APP_nextState = MainMenu ;
+		return;
+	}
+
+	/*Only write the phase text once at the first of each phase*/
+	if(DoorPhase == doorEvent[0])
+	{
+		LCD_displayStringRowColumn(1,0,phase->text);
+	}
+
+	if(0 != phase->animationColumn)
+	{
+		LCD_displayStringRowColumn(1,phase->animationColumn,progressDots[doorEvent[2] & 3]);
+	}
+}
+
+void lockedMode(void)
+{
+	LCD_cleanScreen();
+
+	LCD_displayString("     Error !");
+
+	LCD_displayStringRowColumn(1,0," You're Locked !");
+
+	/*Loop on the previous screen till Control ECU sends a
+	 * command feeding back it has exited locked mode ,
+	 * the lockout lasts longer than the main loop deadline*/
+	do
+	{
+		WDG_checkIn(g_mainTask);
+		waitForControl();
+	}while(Loop != UART_recieveByte());
+
+	/*Return back to Main Menu*/
+	APP_nextState = MainMenu ;
+}
+
+uint8 getUserId(void)
+{
+	uint8 userId = 0 ;
+	uint8 digitsCount = 0 ;
+	uint8 keyCheck ;
+
+	LCD_cleanScreen();
+
+	LCD_displayString("User ID (1-15):");
+
+	LCD_moveCursor(1,0);
+
+	/*Collect up to two digits until '=' is pressed*/
+	do
+	{
+		keyCheck = waitForKey();
+
+		/*De-Bounce delay*/
+		_delay_ms(300);
+
+		if(keyCheck <= 9 && digitsCount < 2)
+		{
+			userId = (userId * 10) + keyCheck;
+			digitsCount++;
+
+			LCD_intgerToString(keyCheck);
+		}
+	}while(keyCheck != '=' || 0 == digitsCount);
+
+	return userId;
+}
+
+void addUser(void)
+{
+	/*2 Local array of password size to get the code digits in it*/
+	uint8 firstCodeEntry[PASSWORD_LENGTH] = {0} ;
+	uint8 secondCodeEntry[PASSWORD_LENGTH] = {0} ;
+
+	uint8 userId ;
+	uint8 result ;
+
+	userId = getUserId();
+
+	LCD_cleanScreen();
+
+	LCD_displayString("New user code :");
+
+	LCD_moveCursor(1,0);
+
+	getPasswordDigits(firstCodeEntry,0);
+
+	LCD_cleanScreen();
+
+	LCD_displayString("Re-Enter the ");
+
+	LCD_displayStringRowColumn(1,0,"same code: ");
+
+	LCD_moveCursor(1,11);
+
+	getPasswordDigits(secondCodeEntry,11);
+
+	/*Send command to Control ECU via UART to go to add user state*/
+	UART_nextState = AddUser;
+
+	UART_sendByte(UART_nextState);
+
+	UART_sendByte(userId);
+
+	/*Send the two code entries*/
+	UART_sendData(firstCodeEntry,PASSWORD_LENGTH);
+
+	_delay_ms(100); /*Allow time for transmission*/
+
+	UART_sendData(secondCodeEntry,PASSWORD_LENGTH);
+
+	_delay_ms(100); /*Allow time for transmission*/
+
+	/*Receive & display the result*/
+	if(receiveReply(&result,1,CONTROL_REPLY_TIMEOUT))
+	{
+		displayUserResult(result);
+	}
+}
+
+void removeUser(void)
+{
+	uint8 userId ;
+	uint8 result ;
+
+	userId = getUserId();
+
+	/*Send command to Control ECU via UART to go to remove user state*/
+	UART_nextState = RemoveUser;
+
+	UART_sendByte(UART_nextState);
+
+	UART_sendByte(userId);
+
+	/*Receive & display the result*/
+	if(receiveReply(&result,1,CONTROL_REPLY_TIMEOUT))
+	{
+		displayUserResult(result);
+	}
+}
+
+void displayUserResult(User_Results a_result)
+{
+	LCD_cleanScreen();
+
+	switch(a_result)
+	{
+	case UserDone:
+		LCD_displayString("Done !");
+		break;
+	case UserUnmatched:
+		LCD_displayString("Unmatched code");
+		break;
+	case UserDenied:
+		LCD_displayString("Admin only !");
+		break;
+	case UserInvalidID:
+		LCD_displayString("Invalid user ID");
+		break;
+	case UserDuplicate:
+		LCD_displayString("Code in use");
+		break;
+	case UserNotFound:
+		LCD_displayString("No such user");
+		break;
+	default:
+		LCD_displayString("EEPROM error !");
+		break;
+	}
+
+	_delay_ms(1000); /*Display message for 1 second*/
+}
+
+boolean receiveReply(uint8 * a_reply , uint8 a_size , uint16 a_timeout)
+{
+	if(UART_RX_OK == UART_receiveExact(a_reply,a_size,a_timeout))
+	{
+		return TRUE;
+	}
+
+	LCD_cleanScreen();
+
+	LCD_displayString("Control ECU");
+
+	LCD_displayStringRowColumn(1,0,"no reply !");
+
+	_delay_ms(1000); /*Display message for 1 second*/
+
+	APP_nextState = MainMenu ;
+	return FALSE;
+}
+
+void systemTick(void)
+{
+	static uint8 ticks = 0;
+	static uint8 superviseTicks = 0;
+
+	if(++superviseTicks >= (WDG_SUPERVISE_PERIOD * TICKS_PER_SECOND) / 1000)
+	{
+		superviseTicks = 0;
+		WDG_supervise();
+	}
+
+	if(++ticks >= TICKS_PER_SECOND)
+	{
+		ticks = 0;
+		DIAG_sample();
+	}
+}
+
+void idleSleep(void)
+{
+	/*The system tick wakes the CPU at the latest 10 ms later*/
+	DIAG_idleEnter();
+	sleep_enable();
+	sei();
+	sleep_cpu();
+	sleep_disable();
+}
+
+uint8 waitForKey(void)
+{
+	uint8 key;
+
+	/*The user may not press a key for ever , HMI ECU isn't stuck*/
+	while(KEYPAD_NO_KEY == (key = KEYPAD_scan()))
+	{
+		WDG_checkIn(g_mainTask);
+		idleSleep();
+	}
+	DIAG_idleExit();
+
+	return key;
+}
+
+void waitForControl(void)
+{
+	while(FALSE == UART_dataAvailable())
+	{
+		idleSleep();
+	}
+	DIAG_idleExit();
+}
+
+void displayDiagnostics(void)
+{
+	DIAG_ReportType report ;
+
+	DIAG_getReport(&report);
+
+	LCD_cleanScreen();
+
+	LCD_displayString("CPU load :");
+	LCD_moveCursor(0,11);
+	LCD_intgerToString(report.load);
+	LCD_displayCharacter('%');
+
+	LCD_displayStringRowColumn(1,0,"max");
+	LCD_moveCursor(1,3);
+	LCD_intgerToString(report.maxLoad);
+	LCD_displayCharacter('%');
+	LCD_displayStringRowColumn(1,8,"avg");
+	LCD_moveCursor(1,11);
+	LCD_intgerToString(report.averageLoad);
+	LCD_displayCharacter('%');
+
+	_delay_ms(2000); /*Display measures for 2 seconds*/
+
+	/*RAM the stack never reached since reset (painted at startup) & free right now*/
+	LCD_cleanScreen();
+
+	LCD_displayString("Stack unused");
+	LCD_moveCursor(0,12);
+	LCD_intgerToString(report.stackHeadroom);
+
+	LCD_displayStringRowColumn(1,0,"Stack free");
+	LCD_moveCursor(1,12);
+	LCD_intgerToString(report.stackFree);
+
+	_delay_ms(2000); /*Display measures for 2 seconds*/
+}
+
+/**********************************************************************/
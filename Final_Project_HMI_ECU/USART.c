@@ -1,218 +1,420 @@
- /******************************************************************************
- *
- * Module : USART
- *
- * File Name: UART.h
- *
- * Description : Source file of UART driver
- *
- * Created on: Feb 28, 2024
- *
- * Author: Mohamed Tarek
- *
- * Modified by : Karim Amr
- *
-******************************************************************************/
-
-/*******************************************************************************
- *                            Required Libraries                               *
- *******************************************************************************/
-
-#include "USART.h"
-#include "avr/io.h" /* To use the UART Registers */
-#include "common_macros.h" /* To use the macros like SET_BIT */
-
-
-
-/********************************************************************************
- *                              Functions Definitions                           *
- ********************************************************************************/
-
-/* Description
- * Initialize UART by :
- * 1. Selecting clock mode ( Asynchronous / Synchronous) (Static to Asynchronous Operation for Final Project)
- * 2. Selecting parity mode ( Disabled  , Even , Odd )
- * 3. Selecting number of stop bits ( One_Bit , Two_Bits )
- * 4. Selecting Baud rate
- * 5. Setting data frame bits ( 5 , 6 ,  7 , 8 )
- */
-void UART_init(const UART_ConfigType * Config_Ptr)
-{
-	uint16 Baud_rate = 0 ; /*Variable that holds the result of the Baud calculations */
-
-	UCSRA = (1<<U2X); /*For double transmission speed*/
-
-   /*************************************************
-	***************** UCSRB Settings ****************
-	*  RXCIE = 0 Disable RX complete interrupt
-	*  TXCIE = 0 Disable TX complete interrupt
-	*  UDRIE = 0 Disable Data Register Empty interrupt
-	*  RXEN  = 1 Enable Receiver
-	*  TXEN  = 1 Enable Transmitter
-	*  *Following are settings for 9-bit mode between two AVR's
-	*  UCSZ2 = 0 Character size
-	*  RXB8  = 0 Receiver data bit 8
-	*  TXB8  = 0 Transmitter data bit 8
-	*************************************************/
-
-	UCSRB = (1<<TXEN) | (1<<RXEN);
-
-	/*************************************************
-	***************** UCSRC Settings ****************
-	*  URSEL 	= 1 		  Enable register select (Disable after configuring UCSRC)
-	*  UCPOL 	= 0 		  Rising XCK edge
-	*  UMSEL 	= 0 		  Asynchronous Operation
-	*  UCSZ2:0  = Config_Ptr  Select Number of data bits
-	*  UPM1:0   = Config_Ptr  Select Parity check
-	*  USBS  	= Config_Ptr  Select number of stop bits
-	*************************************************/
-	SET_BIT(UCSRC,URSEL);
-
-	UCSRC = (UCSRC & ~(0x06)) | (((Config_Ptr->bit_data)<<UCSZ0) & 0x06) ;
-
-	UCSRC = (UCSRC & ~(0x30)) | (((Config_Ptr->parity)<<UPM0)    & 0x30) ;
-
-	UCSRC = (UCSRC & ~(0x08)) | (((Config_Ptr->stop_bit)<<USBS)  & 0x08) ;
-
-	CLEAR_BIT(UCSRC,UMSEL);
-
-	/*************************************************
-	***************** UBRRL Settings ****************
-	*	UBRR formula = ( ( F_CPU / (8*BAUD_rate) ) -1 )
-	*************************************************/
-	Baud_rate = (uint16) (  (F_CPU / (Config_Ptr->baud_rate *8UL) )  - 1);
-
-	/* Sets the the Last 8-bits of the Baud_rate IF available
-	 * by shifting right with 8 into UBRRH , then sets the First
-	 * 8-bits into UBRRL */
-	UBRRH =  Baud_rate >> 8  ;
-	UBRRL =  Baud_rate ;
-}
-
-
-/* Description
- * return the value of the received byte through UART frame
- */
-uint8 UART_recieveByte(void)
-{
-	/*Pooling Technique
-	 * checks the USART receive bit flag
-	 * if it's ZERO , the receive buffer is still empty OR
-	 * has no unread data */
-	while(BIT_IS_CLEAR(UCSRA,RXC));
-
-	/*When flag is set to ONE , the receive buffer has data that is unread
-	 * & return the Data register */
-	return UDR;
-}
-
-
-/* Description
- * Send 8-bit data through UART frame
- * uses the UDRE flag check in order to send data without overwriting of prev. unsent data
- */
-void UART_sendByte(uint8 data) /*UDRE flag pooling method*/
-{
-	/*The loop checks on the empty data register flag (UDRE)
-	 * while the flag is ZERO , the data buffer is still contains data
-	 * that is to be sent and not ready to receive new one*/
-	while(BIT_IS_CLEAR(UCSRA,UDRE));
-
-	/*Once the flag is set to ONE , the loop exits and sends the data byte
-	 * to the buffer for transmitting */
-	UDR = data ;
-
-
-/*	The Transmit complete flag pooling method (TXC)
-	Disadvantage : Uses more clock cycles
-
-	sends the data to the USART data register
-	UDR = data ;
-
-	* Once the transmitting complete flag is complete , the loop exits
-	while(BIT_IS_CLEAR(UCSRA,TXC));
-
-	* set the bit of TXC in order to clear the flag
-	SET_BIT(UCSRA,TXC);*/
-
-
-}
-
-
-/* Description
- * return the value of the received string through UART frame
- * into an string ( pointer to global string )
- * & replace the '#' that indicates the end of the string
- * with '\0' to set the string Null
- */
-void UART_recieveString(uint8 *Str)
-{
-	/*Variable to loop on the string*/
-	uint8 bufferBit = 0 ;
-
-	/*Do-While loop , takes the first byte of the array and then
-	 * loop till the string receives the '#' character*/
-	do
-	{
-		Str[bufferBit] = UART_recieveByte;
-		bufferBit++;
-
-	}while(UART_recieveByte != '#');
-
-	/*Return back to the '#' character and replaces it with null '\0' */
-	bufferBit--;
-	Str[bufferBit] = '\0';
-
-}
-
-/* Description
- * Send array of string through UART frame
- * until the '#' character is detected
- */
-void UART_sendString(const char *Str)
-{
-	/*Variable to loop on the string*/
-	uint8 bufferBit = 0 ;
-
-	/*Loop on the string and send Byte by Byte*/
-	while(Str[bufferBit] != '\0')
-	{
-		UART_sendByte(Str[bufferBit]);
-		bufferBit++;
-	}
-
-}
-
-
-/* Description :
- * Sends array of data through UART frame
- * until size of array is reached
- */
-void UART_sendData(const uint8 * Data, uint8 dataSize)
-{
-	/*Variable to loop on the data array*/
-	uint8 bufferBit ;
-
-	/*Loop on the array and send Byte by Byte*/
-	for(bufferBit = 0 ; bufferBit < dataSize ; bufferBit++ )
-	{
-		UART_sendByte(Data[bufferBit]);
-	}
-}
-
-/* Description
- * return the value of the received array through UART frame
- * into an array ( pointer to global array )
- * until size of array is reached
- */
-void UART_recieveData(uint8 * Data , uint8 dataSize)
-{
-	/*Variable to loop on the data array*/
-	uint8 bufferBit ;
-
-	/*Loop on the array and send Byte by Byte*/
-	for(bufferBit = 0 ; bufferBit < dataSize ; bufferBit++ )
-	{
-		Data[bufferBit] = UART_recieveByte();
-	}
-}
+ /******************************************************************************
+ *
+ * Module : USART
+ *
+ * File Name: UART.h
+ *
+ * Description : Source file of UART driver
+ *
+ * Created on: Feb 28, 2024
+ *
+ * Author: Mohamed Tarek
+ *
+ * Modified by : Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "USART.h"
+#include "avr/io.h" /* To use the UART Registers */
+#include <avr/interrupt.h> /* To use the Data Register Empty ISR */
+#include "common_macros.h" /* To use the macros like SET_BIT */
+#include "diagnostics.h" /* To time the ISR */
+#include <util/delay.h> /* To count the receive timeouts */
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*The receive buffer is checked every UART_POLL_TIME_US while waiting
+ * with a timeout , a timeout lasts at least the requested time*/
+#define UART_POLL_TIME_US	10
+#define UART_POLLS_PER_MS	(1000 / UART_POLL_TIME_US)
+#define UART_POLLS_FOREVER	0xFFFFFFFFUL
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+/*Transmit ring buffer , written by UART_sendDataAsync & read by the ISR*/
+static volatile uint8 g_txBuffer[UART_TX_BUFFER_SIZE];
+static volatile uint8 g_txHead = 0; /*Next free position*/
+static volatile uint8 g_txTail = 0; /*Next byte to send*/
+
+/*Receive ring buffer , written by the ISR & read by the receive functions*/
+static volatile uint8 g_rxBuffer[UART_RX_BUFFER_SIZE];
+static volatile uint8 g_rxHead = 0; /*Next free position*/
+static volatile uint8 g_rxTail = 0; /*Next byte to read*/
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static boolean UART_waitByte(uint8 * a_data , uint32 * a_polls);
+
+
+/********************************************************************************
+ *                              Functions Definitions                           *
+ ********************************************************************************/
+
+/* Description
+ * Initialize UART by :
+ * 1. Selecting clock mode ( Asynchronous / Synchronous) (Static to Asynchronous Operation for Final Project)
+ * 2. Selecting parity mode ( Disabled  , Even , Odd )
+ * 3. Selecting number of stop bits ( One_Bit , Two_Bits )
+ * 4. Selecting Baud rate
+ * 5. Setting data frame bits ( 5 , 6 ,  7 , 8 )
+ */
+void UART_init(const UART_ConfigType * Config_Ptr)
+{
+	uint16 Baud_rate = 0 ; /*Variable that holds the result of the Baud calculations */
+
+	UCSRA = (1<<U2X); /*For double transmission speed*/
+
+   /*************************************************
+	***************** UCSRB Settings ****************
+	*  RXCIE = 1 Enable RX complete interrupt (fills the receive buffer)
+	*  TXCIE = 0 Disable TX complete interrupt
+	*  UDRIE = 0 Disable Data Register Empty interrupt
+	*  RXEN  = 1 Enable Receiver
+	*  TXEN  = 1 Enable Transmitter
+	*  *Following are settings for 9-bit mode between two AVR's
+	*  UCSZ2 = 0 Character size
+	*  RXB8  = 0 Receiver data bit 8
+	*  TXB8  = 0 Transmitter data bit 8
+	*************************************************/
+
+	g_rxHead = 0;
+	g_rxTail = 0;
+
+	UCSRB = (1<<TXEN) | (1<<RXEN) | (1<<RXCIE);
+
+	/*************************************************
+	***************** UCSRC Settings ****************
+	*  URSEL 	= 1 		  Enable register select (Disable after configuring UCSRC)
+	*  UCPOL 	= 0 		  Rising XCK edge
+	*  UMSEL 	= 0 		  Asynchronous Operation
+	*  UCSZ2:0  = Config_Ptr  Select Number of data bits
+	*  UPM1:0   = Config_Ptr  Select Parity check
+	*  USBS  	= Config_Ptr  Select number of stop bits
+	*************************************************/
+	SET_BIT(UCSRC,URSEL);
+
+	UCSRC = (UCSRC & ~(0x06)) | (((Config_Ptr->bit_data)<<UCSZ0) & 0x06) ;
+
+	UCSRC = (UCSRC & ~(0x30)) | (((Config_Ptr->parity)<<UPM0)    & 0x30) ;
+
+	UCSRC = (UCSRC & ~(0x08)) | (((Config_Ptr->stop_bit)<<USBS)  & 0x08) ;
+
+	CLEAR_BIT(UCSRC,UMSEL);
+
+	/*************************************************
+	***************** UBRRL Settings ****************
+	*	UBRR formula = ( ( F_CPU / (8*BAUD_rate) ) -1 )
+	*************************************************/
+	Baud_rate = (uint16) (  (F_CPU / (Config_Ptr->baud_rate *8UL) )  - 1);
+
+	/* Sets the the Last 8-bits of the Baud_rate IF available
+	 * by shifting right with 8 into UBRRH , then sets the First
+	 * 8-bits into UBRRL */
+	UBRRH =  Baud_rate >> 8  ;
+	UBRRL =  Baud_rate ;
+
+	SET_BIT(SREG,7); /*The receive buffer is filled by the ISR*/
+}
+
+
+/* Description
+ * return the value of the received byte through UART frame
+ */
+uint8 UART_recieveByte(void)
+{
+	uint32 polls = UART_POLLS_FOREVER;
+	uint8 data;
+
+	UART_waitByte(&data,&polls);
+	return data;
+}
+
+/* Description
+ * return TRUE if a received byte is waiting to be read
+ * so the caller can do other work instead of blocking on UART_recieveByte
+ */
+boolean UART_dataAvailable(void)
+{
+	return (g_rxHead != g_rxTail) ? TRUE : FALSE;
+}
+
+
+/* Description
+ * Send 8-bit data through UART frame
+ * uses the UDRE flag check in order to send data without overwriting of prev. unsent data
+ */
+void UART_sendByte(uint8 data) /*UDRE flag pooling method*/
+{
+	/*Bytes still waiting inside the transmit buffer go first*/
+	UART_flushTx();
+
+	/*The loop checks on the empty data register flag (UDRE)
+	 * while the flag is ZERO , the data buffer is still contains data
+	 * that is to be sent and not ready to receive new one*/
+	while(BIT_IS_CLEAR(UCSRA,UDRE));
+
+	/*Once the flag is set to ONE , the loop exits and sends the data byte
+	 * to the buffer for transmitting */
+	UDR = data ;
+
+
+/*	The Transmit complete flag pooling method (TXC)
+	Disadvantage : Uses more clock cycles
+
+	sends the data to the USART data register
+	UDR = data ;
+
+	* Once the transmitting complete flag is complete , the loop exits
+	while(BIT_IS_CLEAR(UCSRA,TXC));
+
+	* set the bit of TXC in order to clear the flag
+	SET_BIT(UCSRA,TXC);*/
+
+
+}
+
+
+/* Description
+ * return the value of the received string through UART frame
+ * into an string ( pointer to global string )
+ * & replace the '#' that indicates the end of the string
+ * with '\0' to set the string Null
+ */
+void UART_recieveString(uint8 *Str)
+{
+	/*Number of characters before the '#' character*/
+	uint8 length ;
+
+	UART_receiveUntil(Str,'#',UART_STRING_MAX_LENGTH,&length,UART_WAIT_FOREVER);
+
+	/*The '#' character isn't stored , set the string Null after the last one*/
+	Str[length] = '\0';
+}
+
+/* Description
+ * Send array of string through UART frame
+ * until the '#' character is detected
+ */
+void UART_sendString(const char *Str)
+{
+	/*Variable to loop on the string*/
+	uint8 bufferBit = 0 ;
+
+	/*Loop on the string and send Byte by Byte*/
+	while(Str[bufferBit] != '\0')
+	{
+		UART_sendByte(Str[bufferBit]);
+		bufferBit++;
+	}
+
+}
+
+
+/* Description :
+ * Sends array of data through UART frame
+ * until size of array is reached
+ */
+void UART_sendData(const uint8 * Data, uint8 dataSize)
+{
+	/*Variable to loop on the data array*/
+	uint8 bufferBit ;
+
+	/*Loop on the array and send Byte by Byte*/
+	for(bufferBit = 0 ; bufferBit < dataSize ; bufferBit++ )
+	{
+		UART_sendByte(Data[bufferBit]);
+	}
+}
+
+/* Description
+ * return the value of the received array through UART frame
+ * into an array ( pointer to global array )
+ * until size of array is reached
+ */
+void UART_recieveData(uint8 * Data , uint8 dataSize)
+{
+	/*Variable to loop on the data array*/
+	uint8 bufferBit ;
+
+	/*Loop on the array and send Byte by Byte*/
+	for(bufferBit = 0 ; bufferBit < dataSize ; bufferBit++ )
+	{
+		Data[bufferBit] = UART_recieveByte();
+	}
+}
+
+/* Description
+ * Receive bytes into Data until the delimiter is received (not stored)
+ * or maxSize bytes are stored or timeout milliseconds have passed
+ * ( UART_WAIT_FOREVER to wait without limit) , the number of bytes
+ * stored is returned in receivedSize
+ * Returns UART_RX_OK on the delimiter , UART_RX_FULL if Data got full first
+ */
+UART_RxStatus UART_receiveUntil(uint8 * Data , uint8 delimiter , uint8 maxSize ,
+		uint8 * receivedSize , uint16 timeout)
+{
+	/*One time budget for the whole string*/
+	uint32 polls = (UART_WAIT_FOREVER == timeout) ? UART_POLLS_FOREVER : (uint32)timeout * UART_POLLS_PER_MS;
+	UART_RxStatus status = UART_RX_FULL;
+	uint8 data ;
+
+	*receivedSize = 0;
+
+	while(*receivedSize < maxSize)
+	{
+		if(FALSE == UART_waitByte(&data,&polls))
+		{
+			status = UART_RX_TIMEOUT;
+			break;
+		}
+		if(delimiter == data)
+		{
+			status = UART_RX_OK;
+			break;
+		}
+		Data[*receivedSize] = data;
+		(*receivedSize)++;
+	}
+	return status;
+}
+
+/* Description
+ * Receive exactly dataSize bytes into Data within timeout milliseconds
+ * ( UART_WAIT_FOREVER to wait without limit)
+ * Returns UART_RX_TIMEOUT if the peer sent less , the bytes received so far
+ * are inside Data
+ */
+UART_RxStatus UART_receiveExact(uint8 * Data , uint8 dataSize , uint16 timeout)
+{
+	uint32 polls = (UART_WAIT_FOREVER == timeout) ? UART_POLLS_FOREVER : (uint32)timeout * UART_POLLS_PER_MS;
+	uint8 bufferBit ;
+
+	for(bufferBit = 0 ; bufferBit < dataSize ; bufferBit++ )
+	{
+		if(FALSE == UART_waitByte(&Data[bufferBit],&polls))
+		{
+			return UART_RX_TIMEOUT;
+		}
+	}
+	return UART_RX_OK;
+}
+
+/* Description
+ * Copy array of data into the transmit buffer and return as soon as it is
+ * copied (waits only if the buffer is full) , the bytes are sent back to back
+ * by the Data Register Empty interrupt while the caller prepares the next data
+ * Global interrupts must be enabled
+ */
+void UART_sendDataAsync(const uint8 *Data, uint8 dataSize)
+{
+	/*Variable to loop on the data array*/
+	uint8 bufferBit ;
+	uint8 nextHead ;
+
+	for(bufferBit = 0 ; bufferBit < dataSize ; bufferBit++ )
+	{
+		nextHead = (g_txHead + 1) & (UART_TX_BUFFER_SIZE - 1);
+
+		/*Buffer full , wait for the ISR to free one place*/
+		while(nextHead == g_txTail);
+
+		g_txBuffer[g_txHead] = Data[bufferBit];
+		g_txHead = nextHead;
+
+		/*(Re)Enable the Data Register Empty interrupt , it is disabled
+		 * by the ISR itself every time the buffer gets empty*/
+		SET_BIT(UCSRB,UDRIE);
+	}
+}
+
+/* Description
+ * Wait until all the bytes of the transmit buffer are handed to the UART
+ */
+void UART_flushTx(void)
+{
+	while(g_txHead != g_txTail);
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Take the next byte of the receive buffer , waiting for it at most
+ * *a_polls checks of UART_POLL_TIME_US (UART_POLLS_FOREVER for no limit)
+ * The polls left are kept in *a_polls for the next byte of the same call
+ * Returns FALSE if no byte arrived in time*/
+static boolean UART_waitByte(uint8 * a_data , uint32 * a_polls)
+{
+	while(g_rxHead == g_rxTail)
+	{
+		if(UART_POLLS_FOREVER != *a_polls)
+		{
+			if(0 == *a_polls)
+			{
+				return FALSE;
+			}
+			(*a_polls)--;
+			_delay_us(UART_POLL_TIME_US);
+		}
+	}
+
+	*a_data = g_rxBuffer[g_rxTail];
+
+	/*Free the place last , the ISR doesn't overwrite an unread byte*/
+	g_rxTail = (g_rxTail + 1) & (UART_RX_BUFFER_SIZE - 1);
+	return TRUE;
+}
+
+/*******************************************************************************
+ *                                ISR Definitions 	                           *
+ *******************************************************************************/
+
+ISR(USART_RXC_vect)
+{
+	uint8 data;
+	uint8 nextHead;
+
+	DIAG_isrEnter(DIAG_ISR_USART_RXC);
+
+	/*Reading UDR clears the flag , even if the byte has to be dropped*/
+	data = UDR;
+	nextHead = (g_rxHead + 1) & (UART_RX_BUFFER_SIZE - 1);
+
+	/*Buffer full , the byte is lost like a hardware overrun*/
+	if(nextHead != g_rxTail)
+	{
+		g_rxBuffer[g_rxHead] = data;
+		g_rxHead = nextHead;
+	}
+
+	DIAG_isrExit(DIAG_ISR_USART_RXC);
+}
+
+ISR(USART_UDRE_vect)
+{
+	DIAG_isrEnter(DIAG_ISR_USART_UDRE);
+
+	if(g_txHead == g_txTail)
+	{
+		/*Nothing left to send , stop the interrupt (UDRE stays set)*/
+		CLEAR_BIT(UCSRB,UDRIE);
+	}
+	else
+	{
+		UDR = g_txBuffer[g_txTail];
+		g_txTail = (g_txTail + 1) & (UART_TX_BUFFER_SIZE - 1);
+	}
+
+	DIAG_isrExit(DIAG_ISR_USART_UDRE);
+}
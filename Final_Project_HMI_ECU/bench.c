@@ -0,0 +1,199 @@
+/******************************************************************************
+ *
+ * Module: Driver Benchmark
+ *
+ * File Name: bench.c
+ *
+ * Description: Source file for the driver microbenchmarks
+ * 				(same file in both ECUs)
+ *
+ * 				Built only with DRIVER_BENCH , the application build
+ * 				doesn't carry any of it.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "bench.h"
+
+#if DRIVER_BENCH
+
+#include "TIMER1.h"
+#include "USART.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Calls of the empty case used to measure the overhead*/
+#define BENCH_CALIBRATION_CALLS		16
+
+/*Digits of the largest uint32*/
+#define BENCH_NUMBER_DIGITS			10
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+/*High word of the cycle counter , TIMER1 is the low word*/
+static volatile uint16 s_overflows = 0;
+
+/*Cycles of an empty call taken off every measure*/
+static uint32 s_overhead = 0;
+
+static const char * s_ecu = "";
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void BENCH_overflow(void);
+static uint32 BENCH_cycles(void);
+static void BENCH_empty(void);
+static void BENCH_sendField(const char * a_key , uint32 a_value);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+/* Description :
+ * Start TIMER1 as the cycle counter & measure the cost of an empty call
+ * (the UART must be initialized , a_ecu names the ECU in the report)*/
+void BENCH_init(const char * a_ecu)
+{
+	/*Free running from 0 at F_CPU , overflow interrupt every 65536 cycles*/
+	Timer1_ConfigType counterConfig = {0,0,FCPU_1,Normal};
+	uint32 start;
+	uint32 cycles;
+	uint8 call;
+
+	s_ecu = a_ecu;
+	s_overflows = 0;
+	Timer1_setCallBack(&BENCH_overflow);
+	Timer1_init(&counterConfig);
+
+	s_overhead = 0xFFFFFFFFUL;
+	for(call = 0 ; call < BENCH_CALIBRATION_CALLS ; call++)
+	{
+		start = BENCH_cycles();
+		BENCH_empty();
+		cycles = BENCH_cycles() - start;
+		if(cycles < s_overhead)
+		{
+			s_overhead = cycles;
+		}
+	}
+}
+
+/* Description :
+ * Call a_case a_calls times , measuring every call , and send its report line*/
+void BENCH_measure(const char * a_name , BENCH_CaseType a_case , uint16 a_calls)
+{
+	uint32 start;
+	uint32 cycles;
+	uint32 minimum = 0xFFFFFFFFUL;
+	uint32 maximum = 0;
+	uint32 total = 0;
+	uint16 call;
+
+	for(call = 0 ; call < a_calls ; call++)
+	{
+		start = BENCH_cycles();
+		a_case();
+		cycles = BENCH_cycles() - start;
+
+		cycles = (cycles > s_overhead) ? cycles - s_overhead : 0;
+		if(cycles < minimum)
+		{
+			minimum = cycles;
+		}
+		if(cycles > maximum)
+		{
+			maximum = cycles;
+		}
+		total += cycles;
+	}
+
+	UART_sendString("bench=");
+	UART_sendString(a_name);
+	UART_sendString(" ecu=");
+	UART_sendString(s_ecu);
+	BENCH_sendField("calls",a_calls);
+	BENCH_sendField("min",(0 != a_calls) ? minimum : 0);
+	BENCH_sendField("avg",(0 != a_calls) ? total / a_calls : 0);
+	BENCH_sendField("max",maximum);
+	UART_sendString("\r\n");
+}
+
+/* Description :
+ * Send the end line of the report & stop TIMER1*/
+void BENCH_end(void)
+{
+	UART_sendString("bench=end ecu=");
+	UART_sendString(s_ecu);
+	UART_sendString("\r\n");
+
+	Timer1_deInit();
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * TIMER1 overflow , 65536 cycles more*/
+static void BENCH_overflow(void)
+{
+	s_overflows++;
+}
+
+/* Description :
+ * Return the 32 bits cycle counter , read again if an overflow
+ * was counted between the two halves*/
+static uint32 BENCH_cycles(void)
+{
+	uint16 high;
+	uint16 low;
+
+	do
+	{
+		high = s_overflows;
+		low = Timer1_getCount();
+	}while(high != s_overflows);
+
+	return ((uint32)high << 16) | low;
+}
+
+/* Description :
+ * Measure of the overhead*/
+static void BENCH_empty(void)
+{
+}
+
+/* Description :
+ * Send " key=value" in decimal*/
+static void BENCH_sendField(const char * a_key , uint32 a_value)
+{
+	char digits[BENCH_NUMBER_DIGITS + 1];
+	uint8 position = BENCH_NUMBER_DIGITS;
+
+	digits[position] = '\0';
+	do
+	{
+		digits[--position] = '0' + (a_value % 10);
+		a_value /= 10;
+	}while(0 != a_value);
+
+	UART_sendByte(' ');
+	UART_sendString(a_key);
+	UART_sendByte('=');
+	UART_sendString(&digits[position]);
+}
+
+#endif /* DRIVER_BENCH */
@@ -0,0 +1,106 @@
+/******************************************************************************
+ *
+ * Module: Driver Benchmark
+ *
+ * File Name: bench_drivers.c
+ *
+ * Description: Benchmark cases of the HMI ECU :
+ * 				GPIO , keypad scan , LCD & UART
+ *
+ * 				The keypad scan is measured with no key pressed (all the
+ * 				rows are scanned) , the LCD cases write on the first row.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "bench.h"
+
+#if DRIVER_BENCH
+
+#include "gpio.h"
+#include "USART.h"
+#include "LCD.h"
+#include "keypad.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define BENCH_UART_BYTES		16
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static const uint8 s_uartData[BENCH_UART_BYTES] = "0123456789ABCDEF";
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void BENCH_gpioWritePin(void);
+static void BENCH_keypadScan(void);
+static void BENCH_lcdDisplayCharacter(void);
+static void BENCH_lcdDisplayString(void);
+static void BENCH_uartSendData(void);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+/* Description :
+ * Run all the cases of the ECU (bench_drivers.c) , from BENCH_init to BENCH_end*/
+void BENCH_runDrivers(void)
+{
+	BENCH_init("HMI");
+
+	BENCH_measure("GPIO_writePin",&BENCH_gpioWritePin,100);
+	BENCH_measure("KEYPAD_scan",&BENCH_keypadScan,16);
+
+	LCD_moveCursor(0,0);
+	BENCH_measure("LCD_displayCharacter",&BENCH_lcdDisplayCharacter,16);
+	BENCH_measure("LCD_displayString_16",&BENCH_lcdDisplayString,4);
+
+	BENCH_measure("UART_sendData_16",&BENCH_uartSendData,4);
+
+	BENCH_end();
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+static void BENCH_gpioWritePin(void)
+{
+	/*RS of the LCD , only latched on E*/
+	GPIO_writePin(LCD_RS_PORT_ID,LCD_RS_PIN_ID,LOGIC_LOW);
+}
+
+static void BENCH_keypadScan(void)
+{
+	KEYPAD_scan();
+}
+
+static void BENCH_lcdDisplayCharacter(void)
+{
+	LCD_displayCharacter('#');
+}
+
+static void BENCH_lcdDisplayString(void)
+{
+	LCD_displayString("Benchmark  16 ch");
+}
+
+static void BENCH_uartSendData(void)
+{
+	UART_sendData(s_uartData,BENCH_UART_BYTES);
+}
+
+#endif /* DRIVER_BENCH */
@@ -0,0 +1,36 @@
+/******************************************************************************
+ *
+ * Module: CRC16
+ *
+ * File Name: crc16.h
+ *
+ * Description: Header file for the CRC-16/CCITT calculation
+ * 				(polynomial 0x1021 , initial value 0xFFFF)
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef CRC16_H_
+#define CRC16_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define CRC16_INITIAL_VALUE 0xFFFF
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Continue the CRC a_crc over a_length bytes of a_data and return it
+ * Start with CRC16_INITIAL_VALUE*/
+uint16 CRC16_update(uint16 a_crc , const uint8 * a_data , uint8 a_length);
+
+#endif /* CRC16_H_ */
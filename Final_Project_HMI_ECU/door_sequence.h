@@ -0,0 +1,107 @@
+/******************************************************************************
+ *
+ * Module: Door Sequence
+ *
+ * File Name: door_sequence.h
+ *
+ * Description: Header file for the door actuation sequence
+ * 				(same file in both ECUs , the phase table is the only
+ * 				definition of the door timing)
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef DOOR_SEQUENCE_H_
+#define DOOR_SEQUENCE_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+/*Motor command of a phase (same order as DcMotor_State in Control ECU)*/
+typedef enum
+{
+	DOOR_MOTOR_STOP , DOOR_MOTOR_OPEN , DOOR_MOTOR_CLOSE
+}DOOR_MotorCommand;
+
+/*Door types , each one is a phase table inside door_sequence.c*/
+typedef enum
+{
+	DOOR_STANDARD , DOOR_LATCH_ONLY , DOOR_TYPES_COUNT
+}DOOR_TypeId;
+
+typedef struct
+{
+	uint8 duration;			/*Seconds , at least 1 (worst case when the end is sensed
+							 * by the position switches / encoder or the motor current)*/
+	uint8 motor;			/*DOOR_MotorCommand*/
+	uint8 minTravel;		/*Seconds before the end-stop can be reached , 0 = end not sensed*/
+	uint8 animationColumn;	/*LCD column of the progress dots , 0 = no animation*/
+	const char * text;		/*LCD second line , padded to overwrite the previous phase*/
+}DOOR_PhaseType;
+
+typedef struct
+{
+	const DOOR_PhaseType * phases;
+	uint8 count;
+}DOOR_SequenceType;
+
+/*State of a running sequence*/
+typedef struct
+{
+	const DOOR_PhaseType * phase;
+	const DOOR_PhaseType * end;
+	uint8 index;			/*Position of the current phase inside the table*/
+	uint8 elapsed;			/*Seconds spent inside the current phase*/
+}DOOR_RunnerType;
+
+typedef enum
+{
+	DOOR_PHASE_ENTERED , DOOR_PHASE_RUNNING , DOOR_SEQUENCE_DONE
+}DOOR_EventType;
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Door type fitted to this system (both ECUs must use the same one)*/
+#define DOOR_TYPE		DOOR_STANDARD
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Prepare a_runner to run the phase table of the given door type ,
+ * the first phase is entered by the first DOOR_step call*/
+void DOOR_start(DOOR_RunnerType * a_runner , DOOR_TypeId a_type);
+
+/* Description :
+ * Advance the sequence by one second (constant time) & return
+ * whether a phase has just been entered , is running or the sequence is done*/
+DOOR_EventType DOOR_step(DOOR_RunnerType * a_runner);
+
+/* Description :
+ * End the current phase early (its end was sensed) ,
+ * the next DOOR_step enters the next phase*/
+void DOOR_skipPhase(DOOR_RunnerType * a_runner);
+
+/* Description :
+ * Return the phase the sequence is in (only valid until it is done)*/
+const DOOR_PhaseType * DOOR_currentPhase(const DOOR_RunnerType * a_runner);
+
+/* Description :
+ * Return a phase of a door type by its position (NULL_PTR if out of range) ,
+ * used to render a phase reported by the other ECU*/
+const DOOR_PhaseType * DOOR_getPhase(DOOR_TypeId a_type , uint8 a_index);
+
+#endif /* DOOR_SEQUENCE_H_ */
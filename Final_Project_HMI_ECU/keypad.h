@@ -1,49 +1,59 @@
- /******************************************************************************
- *
- * Module: KEYPAD
- *
- * File Name: keypad.h
- *
- * Description: Header file for the Keypad driver
- *
- * Author: Mohamed Tarek
- *
- *******************************************************************************/
-
-#ifndef KEYPAD_H_
-#define KEYPAD_H_
-
-#include "std_types.h"
-
-/*******************************************************************************
- *                                Definitions                                  *
- *******************************************************************************/
-/* Use Standard keypad type */
-//#define STANDARD_KEYPAD
-
-/* Keypad configurations for number of rows and columns */
-#define KEYPAD_NUM_COLS                   4
-#define KEYPAD_NUM_ROWS                   4
-
-/* Keypad Port Configurations */
-#define KEYPAD_ROW_PORT_ID                PORTB_ID
-#define KEYPAD_FIRST_ROW_PIN_ID           PIN4_ID
-
-#define KEYPAD_COL_PORT_ID                PORTD_ID
-#define KEYPAD_FIRST_COL_PIN_ID           PIN2_ID
-
-/* Keypad button logic configurations */
-#define KEYPAD_BUTTON_PRESSED            LOGIC_LOW
-#define KEYPAD_BUTTON_RELEASED           LOGIC_HIGH
-
-/*******************************************************************************
- *                      Functions Prototypes                                   *
- *******************************************************************************/
-
-/*
- * Description :
- * Get the Keypad pressed button
- */
-uint8 KEYPAD_getPressedKey(void);
-
-#endif /* KEYPAD_H_ */
+ /******************************************************************************
+ *
+ * Module: KEYPAD
+ *
+ * File Name: keypad.h
+ *
+ * Description: Header file for the Keypad driver
+ *
+ * Author: Mohamed Tarek
+ *
+ *******************************************************************************/
+
+#ifndef KEYPAD_H_
+#define KEYPAD_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Use Standard keypad type */
+//#define STANDARD_KEYPAD
+
+/* Keypad configurations for number of rows and columns */
+#define KEYPAD_NUM_COLS                   4
+#define KEYPAD_NUM_ROWS                   4
+
+/* Keypad Port Configurations */
+#define KEYPAD_ROW_PORT_ID                PORTB_ID
+#define KEYPAD_FIRST_ROW_PIN_ID           PIN4_ID
+
+#define KEYPAD_COL_PORT_ID                PORTD_ID
+#define KEYPAD_FIRST_COL_PIN_ID           PIN2_ID
+
+/* Keypad button logic configurations */
+#define KEYPAD_BUTTON_PRESSED            LOGIC_LOW
+#define KEYPAD_BUTTON_RELEASED           LOGIC_HIGH
+
+/* Returned by KEYPAD_scan when no button is pressed */
+#define KEYPAD_NO_KEY                    0xFF
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Get the Keypad pressed button
+ */
+uint8 KEYPAD_getPressedKey(void);
+
+/*
+ * Description :
+ * Scan all the keypad rows once and return the pressed button
+ * or KEYPAD_NO_KEY without waiting
+ */
+uint8 KEYPAD_scan(void);
+
+#endif /* KEYPAD_H_ */
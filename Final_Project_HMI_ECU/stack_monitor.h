@@ -0,0 +1,51 @@
+/******************************************************************************
+ *
+ * Module: Stack Monitor
+ *
+ * File Name: stack_monitor.h
+ *
+ * Description: Header file for the stack usage measure
+ * 				(same file in both ECUs)
+ *
+ * 				Before main , the free RAM between the end of the static
+ * 				variables (_end) & the stack pointer is painted with a
+ * 				pattern. The stack grows down into it , the painted bytes
+ * 				left above _end are the headroom never used since reset.
+ * 				No heap is used in this project.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef STACK_MONITOR_H_
+#define STACK_MONITOR_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Painted over the free RAM at startup*/
+#define STACK_PAINT_PATTERN		0xC5
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Return the bytes of free RAM the stack never reached since reset
+ * (high-water mark , counted up from _end to the first overwritten byte)*/
+uint16 STACK_getHeadroom(void);
+
+/* Description :
+ * Return the bytes of free RAM between _end & the stack pointer right now*/
+uint16 STACK_getFree(void);
+
+#endif /* STACK_MONITOR_H_ */
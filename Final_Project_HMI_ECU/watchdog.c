@@ -0,0 +1,281 @@
+/******************************************************************************
+ *
+ * Module: Watchdog
+ *
+ * File Name: watchdog.c
+ *
+ * Description: Source file for the watchdog supervisor
+ * 				(same file in both ECUs)
+ *
+ * 				The task ages are single bytes , written to 0 by the check-in
+ * 				(main loop) & incremented by the supervisor (ISR) , a byte
+ * 				write is atomic so no locking is needed.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include <avr/wdt.h>
+#include "common_macros.h"
+#include "crc16.h"
+
+#include "watchdog.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Marks a .noinit area written by this module (not power on garbage)*/
+#define WDG_NOINIT_MAGIC		0x5744
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef struct
+{
+	uint8 deadline;		/*Supervise periods , 0 = place free*/
+	uint8 age;			/*Supervise periods since the last check-in*/
+}WDG_TaskType;
+
+/*Kept across the resets that don't remove the power*/
+typedef struct
+{
+	uint16 magic;
+	uint16 watchdogResets;
+	uint16 stateCrc;		/*Covers the state size & the state*/
+	uint8 lastTask;			/*Overdue task , WDG_NO_TASK while all are on time*/
+	uint8 stateSize;		/*0 = no state saved*/
+	uint8 state[WDG_STATE_MAX_SIZE];
+}WDG_NoinitType;
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static WDG_NoinitType s_noinit __attribute__((section(".noinit")));
+
+static volatile WDG_TaskType s_tasks[WDG_MAX_TASKS];
+
+static uint16 s_supervisePeriod = 1;
+
+/*Copies of the last reset taken at init*/
+static WDG_ResetCauseType s_resetCause = WDG_RESET_UNKNOWN;
+static WDG_TaskIdType s_lastTask = WDG_NO_TASK;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static uint16 WDG_stateCrc(void);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+/* Description :
+ * Find the cause of the last reset , keep the .noinit state if it
+ * survived & start the watchdog*/
+void WDG_init(const WDG_ConfigType * Config_Ptr)
+{
+	uint8 task;
+	uint8 flags = MCUCSR;
+
+	/*Clear the reset flags for the next reset (JTD & ISC2 are kept)*/
+	MCUCSR = flags & ~((1<<JTRF) | (1<<WDRF) | (1<<BORF) | (1<<EXTRF) | (1<<PORF));
+
+	/*Power on first , the other flags may be set with it*/
+	if(BIT_IS_SET(flags,PORF))
+	{
+		s_resetCause = WDG_RESET_POWER_ON;
+	}
+	else if(BIT_IS_SET(flags,WDRF))
+	{
+		s_resetCause = WDG_RESET_WATCHDOG;
+	}
+	else if(BIT_IS_SET(flags,BORF))
+	{
+		s_resetCause = WDG_RESET_BROWN_OUT;
+	}
+	else if(BIT_IS_SET(flags,EXTRF))
+	{
+		s_resetCause = WDG_RESET_EXTERNAL;
+	}
+	else
+	{
+		s_resetCause = WDG_RESET_UNKNOWN;
+	}
+
+	/*The RAM content is random after a power on*/
+	if(WDG_RESET_POWER_ON == s_resetCause || WDG_RESET_UNKNOWN == s_resetCause ||
+	   WDG_NOINIT_MAGIC != s_noinit.magic)
+	{
+		s_noinit.magic = WDG_NOINIT_MAGIC;
+		s_noinit.watchdogResets = 0;
+		s_noinit.lastTask = WDG_NO_TASK;
+		s_noinit.stateSize = 0;
+	}
+
+	if(WDG_RESET_WATCHDOG == s_resetCause)
+	{
+		s_noinit.watchdogResets++;
+		s_lastTask = s_noinit.lastTask;
+	}
+	s_noinit.lastTask = WDG_NO_TASK;
+
+	for(task = 0 ; task < WDG_MAX_TASKS ; task++)
+	{
+		s_tasks[task].deadline = 0;
+	}
+	s_supervisePeriod = (0 != Config_Ptr->supervisePeriod) ? Config_Ptr->supervisePeriod : 1;
+
+	wdt_enable(Config_Ptr->timeout);
+}
+
+/* Description :
+ * Supervise a task that must check in at least every a_deadline ms
+ * Returns WDG_NO_TASK if all places are in use*/
+WDG_TaskIdType WDG_register(uint16 a_deadline)
+{
+	WDG_TaskIdType task;
+	uint16 periods = (a_deadline + s_supervisePeriod - 1) / s_supervisePeriod;
+
+	for(task = 0 ; task < WDG_MAX_TASKS ; task++)
+	{
+		if(0 == s_tasks[task].deadline)
+		{
+			/*Set the deadline last , the supervisor skips the free places*/
+			s_tasks[task].age = 0;
+			s_tasks[task].deadline = (periods > 0xFF) ? 0xFF : ((0 == periods) ? 1 : (uint8)periods);
+			return task;
+		}
+	}
+	return WDG_NO_TASK;
+}
+
+/* Description :
+ * The task is alive , its deadline starts again*/
+void WDG_checkIn(WDG_TaskIdType a_task)
+{
+	if(a_task < WDG_MAX_TASKS)
+	{
+		s_tasks[a_task].age = 0;
+	}
+}
+
+/* Description :
+ * Age the tasks & kick the watchdog if none is overdue ,
+ * called every supervisePeriod ms (from the system tick)*/
+void WDG_supervise(void)
+{
+	WDG_TaskIdType task;
+	WDG_TaskIdType overdue = WDG_NO_TASK;
+
+	for(task = 0 ; task < WDG_MAX_TASKS ; task++)
+	{
+		if(0 == s_tasks[task].deadline)
+		{
+			continue;
+		}
+		if(s_tasks[task].age >= s_tasks[task].deadline)
+		{
+			if(WDG_NO_TASK == overdue)
+			{
+				overdue = task;
+			}
+		}
+		else
+		{
+			s_tasks[task].age++;
+		}
+	}
+
+	/*Written before the reset , read by the next WDG_init*/
+	s_noinit.lastTask = overdue;
+
+	if(WDG_NO_TASK == overdue)
+	{
+		wdt_reset();
+	}
+}
+
+/* Description :
+ * Return the cause of the last reset*/
+WDG_ResetCauseType WDG_getResetCause(void)
+{
+	return s_resetCause;
+}
+
+/* Description :
+ * Return the task that was overdue before the last watchdog reset
+ * (WDG_NO_TASK if none)*/
+WDG_TaskIdType WDG_getLastTask(void)
+{
+	return s_lastTask;
+}
+
+/* Description :
+ * Return the number of watchdog resets since power on*/
+uint16 WDG_getWatchdogResets(void)
+{
+	return s_noinit.watchdogResets;
+}
+
+/* Description :
+ * Keep a_size bytes (at most WDG_STATE_MAX_SIZE) of a_state for the warm restart*/
+void WDG_saveState(const uint8 * a_state , uint8 a_size)
+{
+	uint8 i;
+
+	if(a_size > WDG_STATE_MAX_SIZE)
+	{
+		return;
+	}
+
+	/*A reset in the middle of the copy leaves a wrong CRC , the state is dropped*/
+	for(i = 0 ; i < a_size ; i++)
+	{
+		s_noinit.state[i] = a_state[i];
+	}
+	s_noinit.stateSize = a_size;
+	s_noinit.stateCrc = WDG_stateCrc();
+}
+
+/* Description :
+ * Copy the state saved before the reset into a_state
+ * Returns FALSE on a power on or if no valid state of a_size bytes was saved*/
+boolean WDG_restoreState(uint8 * a_state , uint8 a_size)
+{
+	uint8 i;
+
+	if(0 == a_size || a_size > WDG_STATE_MAX_SIZE || a_size != s_noinit.stateSize ||
+	   s_noinit.stateCrc != WDG_stateCrc())
+	{
+		return FALSE;
+	}
+
+	for(i = 0 ; i < a_size ; i++)
+	{
+		a_state[i] = s_noinit.state[i];
+	}
+	return TRUE;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+static uint16 WDG_stateCrc(void)
+{
+	uint16 crc;
+
+	crc = CRC16_update(CRC16_INITIAL_VALUE,&s_noinit.stateSize,1);
+	return CRC16_update(crc,s_noinit.state,s_noinit.stateSize);
+}
@@ -0,0 +1,112 @@
+/******************************************************************************
+ *
+ * Module: Watchdog
+ *
+ * File Name: watchdog.h
+ *
+ * Description: Header file for the watchdog supervisor
+ * 				(task check-ins , reset cause & warm restart state ,
+ * 				same file in both ECUs)
+ *
+ * 				Every supervised task checks in within its deadline ,
+ * 				WDG_supervise (system tick) only kicks the watchdog while
+ * 				all of them are on time. A task stuck in an endless wait
+ * 				stops the kicks & the watchdog resets the ECU.
+ *
+ * 				The reset cause , the overdue task & a small state saved
+ * 				by the application live in .noinit RAM , the startup code
+ * 				doesn't clear them so they survive a watchdog or external
+ * 				reset (not a power on) & the next start can skip the slow
+ * 				rebuild of that state.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef WATCHDOG_H_
+#define WATCHDOG_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Number of tasks that can be supervised*/
+#define WDG_MAX_TASKS			4
+
+#define WDG_NO_TASK				0xFF
+
+/*Largest state kept for the warm restart (bytes)*/
+#define WDG_STATE_MAX_SIZE		16
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef uint8 WDG_TaskIdType;
+
+typedef enum
+{
+	WDG_RESET_POWER_ON , WDG_RESET_EXTERNAL , WDG_RESET_BROWN_OUT ,
+	WDG_RESET_WATCHDOG , WDG_RESET_UNKNOWN
+}WDG_ResetCauseType;
+
+typedef struct
+{
+	uint8 timeout;			/*WDTO_xx of <avr/wdt.h>*/
+	uint16 supervisePeriod;	/*ms between two WDG_supervise calls*/
+}WDG_ConfigType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Find the cause of the last reset , keep the .noinit state if it
+ * survived & start the watchdog*/
+void WDG_init(const WDG_ConfigType * Config_Ptr);
+
+/* Description :
+ * Supervise a task that must check in at least every a_deadline ms
+ * Returns WDG_NO_TASK if all places are in use*/
+WDG_TaskIdType WDG_register(uint16 a_deadline);
+
+/* Description :
+ * The task is alive , its deadline starts again*/
+void WDG_checkIn(WDG_TaskIdType a_task);
+
+/* Description :
+ * Age the tasks & kick the watchdog if none is overdue ,
+ * called every supervisePeriod ms (from the system tick)*/
+void WDG_supervise(void);
+
+/* Description :
+ * Return the cause of the last reset*/
+WDG_ResetCauseType WDG_getResetCause(void);
+
+/* Description :
+ * Return the task that was overdue before the last watchdog reset
+ * (WDG_NO_TASK if none)*/
+WDG_TaskIdType WDG_getLastTask(void);
+
+/* Description :
+ * Return the number of watchdog resets since power on*/
+uint16 WDG_getWatchdogResets(void);
+
+/* Description :
+ * Keep a_size bytes (at most WDG_STATE_MAX_SIZE) of a_state for the warm restart*/
+void WDG_saveState(const uint8 * a_state , uint8 a_size);
+
+/* Description :
+ * Copy the state saved before the reset into a_state
+ * Returns FALSE on a power on or if no valid state of a_size bytes was saved*/
+boolean WDG_restoreState(uint8 * a_state , uint8 a_size);
+
+#endif /* WATCHDOG_H_ */
@@ -0,0 +1,101 @@
+/******************************************************************************
+ *
+ * Module: PWM
+ *
+ * File Name: PWM.c
+ *
+ * Description: Host implementation of the PWM driver , the pre-scaler is
+ * 				selected like on the target & the duty is handed to the
+ * 				simulation core where the motor model reads it
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+ *******************************************************************************/
+
+#include "PWM.h"
+#include "std_types.h"
+#include "gpio.h"
+#include "sim.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+/*Pre-scalers of each timer*/
+static const uint16 s_timer0Prescalers[] = {1,8,64,256,1024};
+static const uint16 s_timer2Prescalers[] = {1,8,32,64,128,256,1024};
+
+static PWM_TimerId s_timer = PWM_TIMER0;
+static uint32 s_frequency = 0;
+
+/***************************************************************/
+/*					Functions Definitions					   */
+/***************************************************************/
+
+/*Configure the timer mode & the pre-scaler closest to the target frequency*/
+void PWM_init(const PWM_ConfigType * Config_Ptr)
+{
+	const uint16 * prescalers ;
+	uint8 prescalersCount ;
+	uint8 index ;
+	uint32 steps ;
+	uint32 frequency ;
+	uint32 error ;
+	uint32 bestError = 0xFFFFFFFFUL ;
+
+	if(PWM_TIMER2 == Config_Ptr->timer)
+	{
+		prescalers = s_timer2Prescalers;
+		prescalersCount = sizeof(s_timer2Prescalers) / sizeof(uint16);
+		GPIO_setupPinDirection(PWM_OC2_PORT,PWM_OC2_PIN,PIN_OUTPUT);
+	}
+	else
+	{
+		prescalers = s_timer0Prescalers;
+		prescalersCount = sizeof(s_timer0Prescalers) / sizeof(uint16);
+		GPIO_setupPinDirection(DC_MOTOR_EN_PORT,DC_MOTOR_EN_PIN,PIN_OUTPUT);
+	}
+
+	steps = (PWM_PHASE_CORRECT == Config_Ptr->mode) ? PWM_PHASE_CORRECT_STEPS : PWM_FAST_STEPS;
+
+	for(index = 0 ; index < prescalersCount ; index++)
+	{
+		frequency = F_CPU / (prescalers[index] * steps);
+		error = (frequency > Config_Ptr->frequency) ?
+				(frequency - Config_Ptr->frequency) : (Config_Ptr->frequency - frequency);
+		if(error < bestError)
+		{
+			bestError = error;
+			s_frequency = frequency;
+		}
+	}
+
+	s_timer = Config_Ptr->timer;
+	SIM_setPwm(s_timer,0,s_frequency);
+}
+
+/*Change the duty cycle (%)*/
+void PWM_setDuty(uint8 duty_cycle)
+{
+	if(duty_cycle > 100)
+	{
+		duty_cycle = 100;
+	}
+	/*Same compare value as the target , duty * 255 / 100*/
+	SIM_setPwm(s_timer,(uint8)(((uint16)duty_cycle * PWM_DUTY_SCALE) >> 8),s_frequency);
+}
+
+/*Return the actual PWM frequency in Hz*/
+uint32 PWM_getFrequency(void)
+{
+	return s_frequency;
+}
+
+/*Stop the timer clock & force the output low*/
+void PWM_deInit(void)
+{
+	s_frequency = 0;
+	SIM_setPwm(s_timer,0,0);
+}
@@ -0,0 +1,145 @@
+/******************************************************************************
+ *
+ * Module: TIMER1
+ *
+ * File Name: TIMER1.c
+ *
+ * Description: Host implementation of the TIMER1 driver , the compare match /
+ * 				overflow interrupt is a periodic event of the simulated clock
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include "common_macros.h"
+#include "sim.h"
+#include "diagnostics.h"
+
+#include "TIMER1.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static void (* volatile g_callBackPtr)(void) = NULL_PTR;
+
+static SIM_EventIdType s_event = SIM_INVALID_EVENT;
+
+/*Division factor of each Timer1_Prescaler value*/
+static const uint16 s_prescalers[] = {0,1,8,64,256,1024};
+
+/*Counter state at the last Timer1_init , TCNT1 is computed from the simulated clock*/
+static Timer1_ConfigType s_config = {0,0,Stop,Normal};
+static SIM_TimeType s_startTime = 0;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void Timer1_interrupt(void);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+/* Description :
+ * Initialize TIMER1 with required configuration from Config_Ptr*/
+void Timer1_init(const Timer1_ConfigType * Config_Ptr)
+{
+	uint32 counts;
+	SIM_TimeType period;
+
+	if(SIM_INVALID_EVENT == s_event)
+	{
+		s_event = SIM_addEvent(&Timer1_interrupt,SIM_INTERRUPT_EVENT);
+	}
+
+	s_config = *Config_Ptr;
+	s_startTime = SIM_now();
+
+	if(Stop == Config_Ptr->prescaler || Config_Ptr->prescaler > FCPU_1024)
+	{
+		s_config.prescaler = Stop;
+		SIM_stopEvent(s_event);
+	}
+	else
+	{
+		/*CTC counts from 0 to the compare value , normal mode from the initial
+		 * value to the overflow (the next periods start from 0 again)*/
+		counts = (Compare == Config_Ptr->mode) ?
+				(uint32)Config_Ptr->compare_value + 1 : 0x10000UL - Config_Ptr->initial_value;
+		period = (SIM_TimeType)counts * s_prescalers[Config_Ptr->prescaler] * 1000000000ULL / F_CPU;
+		SIM_startEvent(s_event,period,(Compare == Config_Ptr->mode) ?
+				period : (SIM_TimeType)0x10000UL * s_prescalers[Config_Ptr->prescaler] * 1000000000ULL / F_CPU);
+	}
+
+	SET_BIT(SREG,7);
+}
+
+/* Description :
+ * Uninitialize /TurnOff TIMER1 and reset its counter/settings registers */
+void Timer1_deInit(void)
+{
+	CLEAR_BIT(SREG,7);
+
+	SIM_stopEvent(s_event);
+	s_config.prescaler = Stop;
+	s_config.initial_value = 0;
+
+	/*Set the callback pointer back to NULL */
+	g_callBackPtr = NULL_PTR;
+}
+
+/* Description :
+ * Sent the address of the required function to be called at ISR toggle
+ * from higher/different abstraction level */
+void Timer1_setCallBack(void(*a_ptr)(void))
+{
+	g_callBackPtr = a_ptr;
+}
+
+/* Description :
+ * Return the current value of the counter (TCNT1)*/
+uint16 Timer1_getCount(void)
+{
+	uint64 ticks;
+	uint32 top;
+
+	if(Stop == s_config.prescaler)
+	{
+		return s_config.initial_value;
+	}
+
+	ticks = (SIM_now() - s_startTime) * (F_CPU / 1000000UL) / 1000UL / s_prescalers[s_config.prescaler];
+	if(Compare == s_config.mode)
+	{
+		top = (uint32)s_config.compare_value + 1;
+		return (uint16)((s_config.initial_value + ticks) % top);
+	}
+	return (uint16)(s_config.initial_value + ticks);
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Compare match / overflow interrupt*/
+static void Timer1_interrupt(void)
+{
+	DIAG_isrEnter(DIAG_ISR_TIMER1);
+
+	if(g_callBackPtr != NULL_PTR)
+	{
+		g_callBackPtr();
+	}
+
+	DIAG_isrExit(DIAG_ISR_TIMER1);
+}
@@ -0,0 +1,263 @@
+/******************************************************************************
+ *
+ * Module: UART
+ *
+ * File Name: USART.c
+ *
+ * Description: Host implementation of the UART driver over a virtual serial
+ * 				line (one end of a socket pair created by the launcher , its
+ * 				descriptor is passed in the SIM_UART_FD environment variable)
+ *
+ * 				Every byte keeps the line busy for one frame time at the
+ * 				configured baud rate like the real transmitter & reaches
+ * 				the other ECU at the end of its frame.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include "USART.h"
+#include "sim.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+/*Duration of one frame on the line*/
+static SIM_TimeType s_frameTime = 0;
+
+/*End of the frame being transmitted*/
+static SIM_TimeType s_txBusyUntil = 0;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void UART_transmit(uint8 a_data);
+static boolean UART_waitByte(uint8 * a_data , SIM_TimeType a_deadline);
+
+/********************************************************************************
+ *                              Functions Definitions                           *
+ ********************************************************************************/
+
+/* Description
+ * Initialize UART by :
+ * 1. Opening the virtual serial line
+ * 2. Computing the frame time from the data bits , parity , stop bits & baud rate
+ */
+void UART_init(const UART_ConfigType * Config_Ptr)
+{
+	const char * fd = getenv("SIM_UART_FD");
+	uint8 frameBits;
+
+	if(NULL_PTR == fd)
+	{
+		SIM_log("SIM_UART_FD is not set , run the ECUs through the launcher");
+		SIM_exit(EXIT_FAILURE);
+	}
+	/*Start bit + data bits + parity bit + stop bits*/
+	frameBits = 1 + (5 + Config_Ptr->bit_data) +
+			((DisabledParity == Config_Ptr->parity) ? 0 : 1) +
+			((TwoStopBits == Config_Ptr->stop_bit) ? 2 : 1);
+	s_frameTime = (SIM_TimeType)frameBits * 1000000000ULL / Config_Ptr->baud_rate;
+	SIM_linkOpen(atoi(fd),s_frameTime);
+}
+
+/* Description
+ * return the value of the received byte through UART frame
+ */
+uint8 UART_recieveByte(void)
+{
+	uint8 data;
+
+	UART_waitByte(&data,SIM_FOREVER);
+	return data;
+}
+
+/* Description
+ * return TRUE if a received byte is waiting to be read
+ * so the caller can do other work instead of blocking on UART_recieveByte
+ */
+boolean UART_dataAvailable(void)
+{
+	/*An idle main loop polls here , give the time slice away
+	 * instead of spinning the host CPU*/
+	return SIM_linkWait(SIM_now() + SIM_IDLE_QUANTUM);
+}
+
+/* Description
+ * Send 8-bit data through UART frame
+ * waits for the previous frame to leave the line first
+ */
+void UART_sendByte(uint8 data)
+{
+	UART_flushTx();
+	UART_transmit(data);
+}
+
+/* Description
+ * return the value of the received string through UART frame
+ * into an string ( pointer to global string )
+ * & replace the '#' that indicates the end of the string
+ * with '\0' to set the string Null
+ */
+void UART_recieveString(uint8 *Str)
+{
+	uint8 length ;
+
+	UART_receiveUntil(Str,'#',UART_STRING_MAX_LENGTH,&length,UART_WAIT_FOREVER);
+	Str[length] = '\0';
+}
+
+/* Description
+ * Send array of string through UART frame
+ * until the '#' character is detected
+ */
+void UART_sendString(const char *Str)
+{
+	uint8 bufferBit = 0 ;
+
+	while(Str[bufferBit] != '\0')
+	{
+		UART_sendByte(Str[bufferBit]);
+		bufferBit++;
+	}
+}
+
+/* Description :
+ * Sends array of data through UART frame
+ * until size of array is reached
+ */
+void UART_sendData(const uint8 * Data, uint8 dataSize)
+{
+	uint8 bufferBit ;
+
+	for(bufferBit = 0 ; bufferBit < dataSize ; bufferBit++ )
+	{
+		UART_sendByte(Data[bufferBit]);
+	}
+}
+
+/* Description
+ * return the value of the received array through UART frame
+ * into an array ( pointer to global array )
+ * until size of array is reached
+ */
+void UART_recieveData(uint8 * Data , uint8 dataSize)
+{
+	uint8 bufferBit ;
+
+	for(bufferBit = 0 ; bufferBit < dataSize ; bufferBit++ )
+	{
+		Data[bufferBit] = UART_recieveByte();
+	}
+}
+
+/* Description
+ * Receive bytes into Data until the delimiter is received (not stored)
+ * or maxSize bytes are stored or timeout milliseconds have passed
+ * (simulated time)
+ */
+UART_RxStatus UART_receiveUntil(uint8 * Data , uint8 delimiter , uint8 maxSize ,
+		uint8 * receivedSize , uint16 timeout)
+{
+	SIM_TimeType deadline = (UART_WAIT_FOREVER == timeout) ? SIM_FOREVER : SIM_now() + SIM_MS(timeout);
+	UART_RxStatus status = UART_RX_FULL;
+	uint8 data ;
+
+	*receivedSize = 0;
+
+	while(*receivedSize < maxSize)
+	{
+		if(FALSE == UART_waitByte(&data,deadline))
+		{
+			status = UART_RX_TIMEOUT;
+			break;
+		}
+		if(delimiter == data)
+		{
+			status = UART_RX_OK;
+			break;
+		}
+		Data[(*receivedSize)++] = data;
+	}
+	return status;
+}
+
+/* Description
+ * Receive exactly dataSize bytes into Data within timeout milliseconds
+ * (simulated time)
+ */
+UART_RxStatus UART_receiveExact(uint8 * Data , uint8 dataSize , uint16 timeout)
+{
+	SIM_TimeType deadline = (UART_WAIT_FOREVER == timeout) ? SIM_FOREVER : SIM_now() + SIM_MS(timeout);
+	uint8 bufferBit ;
+
+	for(bufferBit = 0 ; bufferBit < dataSize ; bufferBit++ )
+	{
+		if(FALSE == UART_waitByte(&Data[bufferBit],deadline))
+		{
+			return UART_RX_TIMEOUT;
+		}
+	}
+	return UART_RX_OK;
+}
+
+/* Description
+ * Queue array of data behind the frame being sent and return at once ,
+ * the line stays busy for the frames of all the queued bytes
+ */
+void UART_sendDataAsync(const uint8 *Data, uint8 dataSize)
+{
+	uint8 bufferBit ;
+
+	for(bufferBit = 0 ; bufferBit < dataSize ; bufferBit++ )
+	{
+		UART_transmit(Data[bufferBit]);
+	}
+}
+
+/* Description
+ * Wait until all the queued bytes left the line
+ */
+void UART_flushTx(void)
+{
+	if(SIM_now() < s_txBusyUntil)
+	{
+		SIM_delay(s_txBusyUntil - SIM_now());
+	}
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Put one byte on the line behind the queued ones*/
+static void UART_transmit(uint8 a_data)
+{
+	SIM_TimeType now = SIM_now();
+
+	s_txBusyUntil = ((s_txBusyUntil > now) ? s_txBusyUntil : now) + s_frameTime;
+	SIM_linkSend(a_data,s_txBusyUntil);
+	SIM_poll();
+}
+
+/* Description :
+ * Take the next byte that has arrived , waiting for it until a_deadline
+ * (SIM_FOREVER for no limit) , returns FALSE if none arrived in time*/
+static boolean UART_waitByte(uint8 * a_data , SIM_TimeType a_deadline)
+{
+	while(FALSE == SIM_linkReceive(a_data))
+	{
+		if(SIM_FOREVER != a_deadline && SIM_now() >= a_deadline)
+		{
+			return FALSE;
+		}
+		SIM_linkWait(a_deadline);
+	}
+	return TRUE;
+}
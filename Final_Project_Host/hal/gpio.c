@@ -0,0 +1,142 @@
+/******************************************************************************
+ *
+ * Module: GPIO
+ *
+ * File Name: gpio.c
+ *
+ * Description: Host implementation of the GPIO driver over the virtual ports
+ * 				of the simulation core (the board models watch the writes &
+ * 				drive the inputs)
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+ *******************************************************************************/
+
+#include "gpio.h"
+#include "common_macros.h" /* To use the macros like SET_BIT */
+#include "sim.h"
+
+/*
+ * Description :
+ * Setup the direction of the required pin input/output.
+ * If the input port number or pin number are not correct, The function will not handle the request.
+ */
+void GPIO_setupPinDirection(uint8 port_num, uint8 pin_num, GPIO_PinDirectionType direction)
+{
+	uint8 ddr;
+
+	if((pin_num >= NUM_OF_PINS_PER_PORT) || (port_num >= NUM_OF_PORTS))
+	{
+		/* Do Nothing */
+	}
+	else
+	{
+		ddr = SIM_getPortDirection(port_num);
+		if(direction == PIN_OUTPUT)
+		{
+			SET_BIT(ddr,pin_num);
+		}
+		else
+		{
+			CLEAR_BIT(ddr,pin_num);
+		}
+		SIM_writePortDirection(port_num,ddr);
+	}
+}
+
+/*
+ * Description :
+ * Write the value Logic High or Logic Low on the required pin.
+ * If the input port number or pin number are not correct, The function will not handle the request.
+ * If the pin is input, this function will enable/disable the internal pull-up resistor.
+ */
+void GPIO_writePin(uint8 port_num, uint8 pin_num, uint8 value)
+{
+	uint8 port;
+
+	if((pin_num >= NUM_OF_PINS_PER_PORT) || (port_num >= NUM_OF_PORTS))
+	{
+		/* Do Nothing */
+	}
+	else
+	{
+		port = SIM_getPortOutput(port_num);
+		if(value == LOGIC_HIGH)
+		{
+			SET_BIT(port,pin_num);
+		}
+		else
+		{
+			CLEAR_BIT(port,pin_num);
+		}
+		SIM_writePortOutput(port_num,port);
+	}
+}
+
+/*
+ * Description :
+ * Read and return the value for the required pin, it should be Logic High or Logic Low.
+ * If the input port number or pin number are not correct, The function will return Logic Low.
+ */
+uint8 GPIO_readPin(uint8 port_num, uint8 pin_num)
+{
+	if((pin_num >= NUM_OF_PINS_PER_PORT) || (port_num >= NUM_OF_PORTS))
+	{
+		return LOGIC_LOW;
+	}
+	return BIT_IS_SET(SIM_readPort(port_num),pin_num) ? LOGIC_HIGH : LOGIC_LOW;
+}
+
+/*
+ * Description :
+ * Setup the direction of the required port all pins input/output.
+ * If the direction value is PORT_INPUT all pins in this port should be input pins.
+ * If the direction value is PORT_OUTPUT all pins in this port should be output pins.
+ * If the input port number is not correct, The function will not handle the request.
+ */
+void GPIO_setupPortDirection(uint8 port_num, GPIO_PortDirectionType direction)
+{
+	if(port_num >= NUM_OF_PORTS)
+	{
+		/* Do Nothing */
+	}
+	else
+	{
+		SIM_writePortDirection(port_num,direction);
+	}
+}
+
+/*
+ * Description :
+ * Write the value on the required port.
+ * If any pin in the port is output pin the value will be written.
+ * If any pin in the port is input pin this will activate/deactivate the internal pull-up resistor.
+ * If the input port number is not correct, The function will not handle the request.
+ */
+void GPIO_writePort(uint8 port_num, uint8 value)
+{
+	if(port_num >= NUM_OF_PORTS)
+	{
+		/* Do Nothing */
+	}
+	else
+	{
+		SIM_writePortOutput(port_num,value);
+	}
+}
+
+/*
+ * Description :
+ * Read and return the value of the required port.
+ * If the input port number is not correct, The function will return ZERO value.
+ */
+uint8 GPIO_readPort(uint8 port_num)
+{
+	if(port_num >= NUM_OF_PORTS)
+	{
+		return LOGIC_LOW;
+	}
+	return SIM_readPort(port_num);
+}
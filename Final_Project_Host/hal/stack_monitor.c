@@ -0,0 +1,32 @@
+/******************************************************************************
+ *
+ * Module: Stack Monitor
+ *
+ * File Name: stack_monitor.c
+ *
+ * Description: Host implementation of the stack monitor , the ECUs run on
+ * 				the host stack (no 2 KB limit) so nothing is painted & the
+ * 				queries return the largest value. The target stack is
+ * 				measured on simavr or on the board.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+ *******************************************************************************/
+
+#include "stack_monitor.h"
+
+/***************************************************************/
+/*					Functions Definitions					   */
+/***************************************************************/
+
+uint16 STACK_getHeadroom(void)
+{
+	return 0xFFFF;
+}
+
+uint16 STACK_getFree(void)
+{
+	return 0xFFFF;
+}
@@ -0,0 +1,199 @@
+/******************************************************************************
+ *
+ * Module: TWI(I2C)
+ *
+ * File Name: twi.c
+ *
+ * Description: Host implementation of the TWI master driver over the virtual
+ * 				bus of the simulation core , the status codes follow the
+ * 				TWSR values of the real hardware & every bus action takes
+ * 				its time at the configured bit rate
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+ *******************************************************************************/
+
+#include "twi.h"
+#include "sim.h"
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef enum
+{
+	TWI_IDLE , TWI_ADDRESS , TWI_TRANSMIT , TWI_RECEIVE
+}TWI_StateType;
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static TWI_StateType s_state = TWI_IDLE;
+static uint8 s_status = TWI_NO_INFO;
+static const SIM_TwiDeviceType * s_device = NULL_PTR;
+
+/*Duration of one bit on the bus*/
+static SIM_TimeType s_bitTime = 0;
+
+/*Last requested rate & the rate the target registers would give*/
+static uint32 s_requestedRate = 0;
+static uint32 s_actualRate = 0;
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void TWI_init(const TWI_ConfigType * Config_Ptr)
+{
+	s_requestedRate = 0;
+	TWI_setBitRate(Config_Ptr->bit_rate);
+	s_state = TWI_IDLE;
+	s_status = TWI_NO_INFO;
+}
+
+void TWI_start(void)
+{
+	SIM_delay(s_bitTime);
+	s_status = (TWI_IDLE == s_state) ? TWI_START : TWI_REP_START;
+	s_state = TWI_ADDRESS;
+}
+
+void TWI_stop(void)
+{
+	SIM_delay(s_bitTime);
+	if(NULL_PTR != s_device)
+	{
+		s_device->stop();
+		s_device = NULL_PTR;
+	}
+	s_state = TWI_IDLE;
+	s_status = TWI_NO_INFO;
+}
+
+void TWI_writeByte(uint8 data)
+{
+	boolean read = data & 0x01;
+
+	/*8 data bits + ACK*/
+	SIM_delay(9 * s_bitTime);
+
+	switch(s_state)
+	{
+	case TWI_ADDRESS:
+		/*A repeated start addresses again , the old device is released*/
+		if(NULL_PTR != s_device)
+		{
+			s_device->stop();
+		}
+		s_device = SIM_twiSelect(data >> 1,read);
+		if(NULL_PTR == s_device)
+		{
+			s_status = read ? TWI_MR_SLA_R_NACK : TWI_MT_SLA_W_NACK;
+		}
+		else
+		{
+			s_status = read ? TWI_MT_SLA_R_ACK : TWI_MT_SLA_W_ACK;
+			s_state = read ? TWI_RECEIVE : TWI_TRANSMIT;
+		}
+		break;
+
+	case TWI_TRANSMIT:
+		s_status = s_device->write(data) ? TWI_MT_DATA_ACK : TWI_MT_DATA_NACK;
+		break;
+
+	default:
+		/*Nobody listens*/
+		s_status = TWI_MT_DATA_NACK;
+		break;
+	}
+}
+
+uint8 TWI_readByteWithACK(void)
+{
+	SIM_delay(9 * s_bitTime);
+	if(TWI_RECEIVE != s_state)
+	{
+		s_status = TWI_NO_INFO;
+		return 0xFF;
+	}
+	s_status = TWI_MR_DATA_ACK;
+	return s_device->read(TRUE);
+}
+
+uint8 TWI_readByteWithNACK(void)
+{
+	SIM_delay(9 * s_bitTime);
+	if(TWI_RECEIVE != s_state)
+	{
+		s_status = TWI_NO_INFO;
+		return 0xFF;
+	}
+	s_status = TWI_MR_DATA_NACK;
+	return s_device->read(FALSE);
+}
+
+uint8 TWI_getStatus(void)
+{
+	return s_status;
+}
+
+void TWI_abort(void)
+{
+	/*The virtual bus never hangs , a STOP releases the device*/
+	TWI_stop();
+}
+
+void TWI_recoverBus(void)
+{
+	/*9 clocks & a STOP*/
+	SIM_delay(10 * s_bitTime);
+	if(NULL_PTR != s_device)
+	{
+		s_device->stop();
+		s_device = NULL_PTR;
+	}
+	s_state = TWI_IDLE;
+	s_status = TWI_NO_INFO;
+}
+
+uint32 TWI_setBitRate(uint32 a_rate)
+{
+	uint8 twps;
+	uint32 twbr;
+	uint32 divider;
+	uint32 rate;
+
+	if(a_rate == s_requestedRate)
+	{
+		return s_actualRate;
+	}
+	s_requestedRate = a_rate;
+
+	/*Same search as the target driver : highest rate not above the request*/
+	s_actualRate = F_CPU / (16UL + 128UL * 0xFFUL);
+	for(twps = 0 ; twps < 4 ; twps++)
+	{
+		divider = 2UL << (2 * twps);
+		twbr = ((F_CPU / a_rate) > 16UL) ? ((F_CPU / a_rate) - 16UL + divider - 1) / divider : 0;
+		if(twbr < TWI_MIN_TWBR)
+		{
+			twbr = TWI_MIN_TWBR;
+		}
+		rate = F_CPU / (16UL + divider * twbr);
+		if(twbr <= 0xFF && rate > s_actualRate)
+		{
+			s_actualRate = rate;
+		}
+	}
+
+	s_bitTime = 1000000000ULL / s_actualRate;
+	return s_actualRate;
+}
+
+uint32 TWI_getBitRate(void)
+{
+	return s_actualRate;
+}
@@ -0,0 +1,28 @@
+/******************************************************************************
+ *
+ * Module: Simulation Core
+ *
+ * File Name: interrupt.h
+ *
+ * Description: Host stand-in of <avr/interrupt.h>
+ *
+ * 				An ISR is a plain function named after its vector , the
+ * 				simulation core calls it with the I flag of SREG cleared.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef SIM_AVR_INTERRUPT_H_
+#define SIM_AVR_INTERRUPT_H_
+
+#include <avr/io.h>
+
+#define ISR(vector , ...)	void vector(void); void vector(void)
+
+#define sei()				(SREG |= (1<<7))
+#define cli()				(SREG &= ~(1<<7))
+
+#endif /* SIM_AVR_INTERRUPT_H_ */
@@ -0,0 +1,299 @@
+/******************************************************************************
+ *
+ * Module: Simulation Core
+ *
+ * File Name: io.h
+ *
+ * Description: Host stand-in of <avr/io.h> for the ATmega32
+ *
+ * 				The I/O registers are bytes of a plain array at their data
+ * 				sheet addresses so the drivers that are built unchanged for
+ * 				the host (ADC , door position , ...) still compile , the
+ * 				board models read & write the same array.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef SIM_AVR_IO_H_
+#define SIM_AVR_IO_H_
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define SIM_IO_SIZE		0x40
+
+extern volatile unsigned char SIM_io[SIM_IO_SIZE];
+
+#define SIM_IO8(address)	(SIM_io[(address)])
+#define SIM_IO16(address)	(*(volatile unsigned short *)&SIM_io[(address)])
+
+/*I/O space addresses (data sheet register summary)*/
+#define TWBR	SIM_IO8(0x00)
+#define TWSR	SIM_IO8(0x01)
+#define TWAR	SIM_IO8(0x02)
+#define TWDR	SIM_IO8(0x03)
+#define ADC		SIM_IO16(0x04)
+#define ADCW	SIM_IO16(0x04)
+#define ADCL	SIM_IO8(0x04)
+#define ADCH	SIM_IO8(0x05)
+#define ADCSRA	SIM_IO8(0x06)
+#define ADMUX	SIM_IO8(0x07)
+#define ACSR	SIM_IO8(0x08)
+#define UBRRL	SIM_IO8(0x09)
+#define UCSRB	SIM_IO8(0x0A)
+#define UCSRA	SIM_IO8(0x0B)
+#define UDR		SIM_IO8(0x0C)
+#define SPCR	SIM_IO8(0x0D)
+#define SPSR	SIM_IO8(0x0E)
+#define SPDR	SIM_IO8(0x0F)
+#define PIND	SIM_IO8(0x10)
+#define DDRD	SIM_IO8(0x11)
+#define PORTD	SIM_IO8(0x12)
+#define PINC	SIM_IO8(0x13)
+#define DDRC	SIM_IO8(0x14)
+#define PORTC	SIM_IO8(0x15)
+#define PINB	SIM_IO8(0x16)
+#define DDRB	SIM_IO8(0x17)
+#define PORTB	SIM_IO8(0x18)
+#define PINA	SIM_IO8(0x19)
+#define DDRA	SIM_IO8(0x1A)
+#define PORTA	SIM_IO8(0x1B)
+#define EECR	SIM_IO8(0x1C)
+#define EEDR	SIM_IO8(0x1D)
+#define EEAR	SIM_IO16(0x1E)
+#define EEARL	SIM_IO8(0x1E)
+#define EEARH	SIM_IO8(0x1F)
+#define UBRRH	SIM_IO8(0x20)
+#define UCSRC	SIM_IO8(0x20)
+#define WDTCR	SIM_IO8(0x21)
+#define ASSR	SIM_IO8(0x22)
+#define OCR2	SIM_IO8(0x23)
+#define TCNT2	SIM_IO8(0x24)
+#define TCCR2	SIM_IO8(0x25)
+#define ICR1	SIM_IO16(0x26)
+#define ICR1L	SIM_IO8(0x26)
+#define ICR1H	SIM_IO8(0x27)
+#define OCR1B	SIM_IO16(0x28)
+#define OCR1BL	SIM_IO8(0x28)
+#define OCR1BH	SIM_IO8(0x29)
+#define OCR1A	SIM_IO16(0x2A)
+#define OCR1AL	SIM_IO8(0x2A)
+#define OCR1AH	SIM_IO8(0x2B)
+#define TCNT1	SIM_IO16(0x2C)
+#define TCNT1L	SIM_IO8(0x2C)
+#define TCNT1H	SIM_IO8(0x2D)
+#define TCCR1B	SIM_IO8(0x2E)
+#define TCCR1A	SIM_IO8(0x2F)
+#define SFIOR	SIM_IO8(0x30)
+#define OSCCAL	SIM_IO8(0x31)
+#define TCNT0	SIM_IO8(0x32)
+#define TCCR0	SIM_IO8(0x33)
+#define MCUCSR	SIM_IO8(0x34)
+#define MCUCR	SIM_IO8(0x35)
+#define TWCR	SIM_IO8(0x36)
+#define SPMCR	SIM_IO8(0x37)
+#define TIFR	SIM_IO8(0x38)
+#define TIMSK	SIM_IO8(0x39)
+#define GIFR	SIM_IO8(0x3A)
+#define GICR	SIM_IO8(0x3B)
+#define OCR0	SIM_IO8(0x3C)
+#define SPL		SIM_IO8(0x3D)
+#define SPH		SIM_IO8(0x3E)
+#define SREG	SIM_IO8(0x3F)
+
+/*TWCR*/
+#define TWINT	7
+#define TWEA	6
+#define TWSTA	5
+#define TWSTO	4
+#define TWWC	3
+#define TWEN	2
+#define TWIE	0
+/*TWSR*/
+#define TWPS1	1
+#define TWPS0	0
+/*TWAR*/
+#define TWGCE	0
+
+/*ADMUX*/
+#define REFS1	7
+#define REFS0	6
+#define ADLAR	5
+#define MUX4	4
+#define MUX3	3
+#define MUX2	2
+#define MUX1	1
+#define MUX0	0
+/*ADCSRA*/
+#define ADEN	7
+#define ADSC	6
+#define ADATE	5
+#define ADIF	4
+#define ADIE	3
+#define ADPS2	2
+#define ADPS1	1
+#define ADPS0	0
+
+/*UCSRA*/
+#define RXC		7
+#define TXC		6
+#define UDRE	5
+#define FE		4
+#define DOR		3
+#define PE		2
+#define U2X		1
+#define MPCM	0
+/*UCSRB*/
+#define RXCIE	7
+#define TXCIE	6
+#define UDRIE	5
+#define RXEN	4
+#define TXEN	3
+#define UCSZ2	2
+#define RXB8	1
+#define TXB8	0
+/*UCSRC*/
+#define URSEL	7
+#define UMSEL	6
+#define UPM1	5
+#define UPM0	4
+#define USBS	3
+#define UCSZ1	2
+#define UCSZ0	1
+#define UCPOL	0
+
+/*TCCR0*/
+#define FOC0	7
+#define WGM00	6
+#define COM01	5
+#define COM00	4
+#define WGM01	3
+#define CS02	2
+#define CS01	1
+#define CS00	0
+/*TCCR2*/
+#define FOC2	7
+#define WGM20	6
+#define COM21	5
+#define COM20	4
+#define WGM21	3
+#define CS22	2
+#define CS21	1
+#define CS20	0
+/*TCCR1A*/
+#define COM1A1	7
+#define COM1A0	6
+#define COM1B1	5
+#define COM1B0	4
+#define FOC1A	3
+#define FOC1B	2
+#define WGM11	1
+#define WGM10	0
+/*TCCR1B*/
+#define ICNC1	7
+#define ICES1	6
+#define WGM13	4
+#define WGM12	3
+#define CS12	2
+#define CS11	1
+#define CS10	0
+/*TIMSK*/
+#define OCIE2	7
+#define TOIE2	6
+#define TICIE1	5
+#define OCIE1A	4
+#define OCIE1B	3
+#define TOIE1	2
+#define OCIE0	1
+#define TOIE0	0
+/*TIFR*/
+#define OCF2	7
+#define TOV2	6
+#define ICF1	5
+#define OCF1A	4
+#define OCF1B	3
+#define TOV1	2
+#define OCF0	1
+#define TOV0	0
+
+/*MCUCR*/
+#define SE		7
+#define SM2		6
+#define SM1		5
+#define SM0		4
+#define ISC11	3
+#define ISC10	2
+#define ISC01	1
+#define ISC00	0
+/*MCUCSR*/
+#define JTD		7
+#define ISC2	6
+#define JTRF	4
+#define WDRF	3
+#define BORF	2
+#define EXTRF	1
+#define PORF	0
+/*GICR*/
+#define INT1	7
+#define INT0	6
+#define INT2	5
+#define IVSEL	1
+#define IVCE	0
+/*GIFR*/
+#define INTF1	7
+#define INTF0	6
+#define INTF2	5
+/*WDTCR*/
+#define WDTOE	4
+#define WDE		3
+#define WDP2	2
+#define WDP1	1
+#define WDP0	0
+/*SFIOR*/
+#define ADTS2	7
+#define ADTS1	6
+#define ADTS0	5
+#define ACME	3
+#define PUD		2
+#define PSR2	1
+#define PSR10	0
+
+/*Port pins*/
+#define PA0 0
+#define PA1 1
+#define PA2 2
+#define PA3 3
+#define PA4 4
+#define PA5 5
+#define PA6 6
+#define PA7 7
+#define PB0 0
+#define PB1 1
+#define PB2 2
+#define PB3 3
+#define PB4 4
+#define PB5 5
+#define PB6 6
+#define PB7 7
+#define PC0 0
+#define PC1 1
+#define PC2 2
+#define PC3 3
+#define PC4 4
+#define PC5 5
+#define PC6 6
+#define PC7 7
+#define PD0 0
+#define PD1 1
+#define PD2 2
+#define PD3 3
+#define PD4 4
+#define PD5 5
+#define PD6 6
+#define PD7 7
+
+#endif /* SIM_AVR_IO_H_ */
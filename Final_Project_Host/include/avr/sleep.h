@@ -0,0 +1,38 @@
+/******************************************************************************
+ *
+ * Module: Simulation Core
+ *
+ * File Name: sleep.h
+ *
+ * Description: Host stand-in of <avr/sleep.h>
+ *
+ * 				sleep_cpu() hands the CPU to the simulation core until the
+ * 				next interrupt , the simulated clock jumps to it.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef SIM_AVR_SLEEP_H_
+#define SIM_AVR_SLEEP_H_
+
+#include <avr/io.h>
+
+#define SLEEP_MODE_IDLE			0
+#define SLEEP_MODE_ADC			(1<<SM0)
+#define SLEEP_MODE_PWR_DOWN		(1<<SM1)
+#define SLEEP_MODE_PWR_SAVE		((1<<SM0) | (1<<SM1))
+#define SLEEP_MODE_STANDBY		((1<<SM1) | (1<<SM2))
+
+void SIM_sleepCpu(void);
+
+#define set_sleep_mode(mode)	(MCUCR = (MCUCR & ~((1<<SM0) | (1<<SM1) | (1<<SM2))) | (mode))
+#define sleep_enable()			(MCUCR |= (1<<SE))
+#define sleep_disable()			(MCUCR &= ~(1<<SE))
+#define sleep_cpu()				SIM_sleepCpu()
+
+#define sleep_mode()			do{ sleep_enable(); sleep_cpu(); sleep_disable(); }while(0)
+
+#endif /* SIM_AVR_SLEEP_H_ */
@@ -0,0 +1,37 @@
+/******************************************************************************
+ *
+ * Module: Simulation Core
+ *
+ * File Name: wdt.h
+ *
+ * Description: Host stand-in of <avr/wdt.h>
+ *
+ * 				The watchdog isn't simulated , the timeout is written to
+ * 				WDTCR & the kicks do nothing. A hang of the host build
+ * 				is found by the scenario time limit instead.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef SIM_AVR_WDT_H_
+#define SIM_AVR_WDT_H_
+
+#include <avr/io.h>
+
+#define WDTO_15MS	0
+#define WDTO_30MS	1
+#define WDTO_60MS	2
+#define WDTO_120MS	3
+#define WDTO_250MS	4
+#define WDTO_500MS	5
+#define WDTO_1S		6
+#define WDTO_2S		7
+
+#define wdt_enable(timeout)		(WDTCR = (1<<WDE) | ((timeout) & 0x07))
+#define wdt_disable()			(WDTCR = 0)
+#define wdt_reset()				do{ }while(0)
+
+#endif /* SIM_AVR_WDT_H_ */
@@ -0,0 +1,22 @@
+/******************************************************************************
+ *
+ * Module: Simulation Core
+ *
+ * File Name: stdlib.h
+ *
+ * Description: Host <stdlib.h> with the avr-libc extensions the firmware uses
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef SIM_STDLIB_H_
+#define SIM_STDLIB_H_
+
+#include_next <stdlib.h>
+
+char * itoa(int a_value , char * a_string , int a_radix);
+
+#endif /* SIM_STDLIB_H_ */
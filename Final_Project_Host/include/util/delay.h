@@ -0,0 +1,26 @@
+/******************************************************************************
+ *
+ * Module: Simulation Core
+ *
+ * File Name: delay.h
+ *
+ * Description: Host stand-in of <util/delay.h>
+ *
+ * 				The busy waits go through the simulated clock so the
+ * 				interrupts keep running while the firmware waits.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef SIM_UTIL_DELAY_H_
+#define SIM_UTIL_DELAY_H_
+
+void SIM_delay(unsigned long long a_time);
+
+#define _delay_ms(ms)	SIM_delay((unsigned long long)((ms) * 1000000.0))
+#define _delay_us(us)	SIM_delay((unsigned long long)((us) * 1000.0))
+
+#endif /* SIM_UTIL_DELAY_H_ */
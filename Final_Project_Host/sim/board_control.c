@@ -0,0 +1,58 @@
+/******************************************************************************
+ *
+ * Module: Simulation Board
+ *
+ * File Name: board_control.c
+ *
+ * Description: Hardware around the Control ECU in the host simulation :
+ * 				24C16 EEPROM & DS1307 RTC on the TWI bus & the door plant
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <time.h>
+#include "sim.h"
+#include "eeprom_24cxx.h"
+#include "rtc_ds1307.h"
+#include "door_plant.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*24C16 : 2 KB in 16 byte pages*/
+#define SIM_BOARD_EEPROM_SIZE		2048
+#define SIM_BOARD_EEPROM_PAGE		16
+#define SIM_BOARD_EEPROM_FILE		"control_eeprom.bin"
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Power the board up before main runs*/
+__attribute__((constructor)) static void SIM_BOARD_init(void)
+{
+	const char * file = getenv("SIM_EEPROM_FILE");
+	const char * rtcTime = getenv("SIM_RTC_TIME");
+	time_t now = time(NULL);
+	struct tm local;
+
+	SIM_init("Control");
+	SIM_EEPROM_init(SIM_BOARD_EEPROM_SIZE,SIM_BOARD_EEPROM_PAGE,
+			(NULL_PTR != file) ? file : SIM_BOARD_EEPROM_FILE);
+	SIM_DOOR_init();
+
+	/*The RTC keeps the local time , SIM_RTC_TIME=<s> starts it at a fixed date*/
+	localtime_r(&now,&local);
+	SIM_RTC_init((NULL_PTR != rtcTime) ? strtoull(rtcTime,NULL_PTR,10) :
+			(uint64)now + (uint64)local.tm_gmtoff);
+}
@@ -0,0 +1,35 @@
+/******************************************************************************
+ *
+ * Module: Simulation Board
+ *
+ * File Name: board_hmi.c
+ *
+ * Description: Hardware around the HMI ECU in the host simulation :
+ * 				2x16 LCD & 4x4 keypad
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "sim.h"
+#include "lcd_hd44780.h"
+#include "keypad_matrix.h"
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Power the board up before main runs*/
+__attribute__((constructor)) static void SIM_BOARD_init(void)
+{
+	SIM_init("HMI");
+	SIM_LCD_init();
+	SIM_KEYPAD_init();
+}
@@ -0,0 +1,213 @@
+/******************************************************************************
+ *
+ * Module: Door Plant Model
+ *
+ * File Name: door_plant.c
+ *
+ * Description: Source file for the model of the hardware around the Control ECU
+ *
+ * 				The door moves at a speed proportional to the PWM duty in the
+ * 				direction of the H-bridge inputs , every encoder pulse raises
+ * 				INT0 , the limit switches close at both ends & the current
+ * 				rises to the stall level while the motor pushes an end stop.
+ * 				The free running ADC is converted at its real rate.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <avr/io.h>
+#include "common_macros.h"
+#include "gpio.h"
+#include "PWM.h"
+#include "DCMotor.h"
+#include "BUZZER.h"
+#include "door_position.h"
+#include "current_sense.h"
+#include "sim.h"
+#include "door_plant.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static double s_position = 0.0;		/*pulses , 0 = closed*/
+static double s_current = 0.0;		/*ADC counts*/
+static sint8 s_direction = 0;
+static uint8 s_buzzer = LOGIC_LOW;
+
+static SIM_EventIdType s_updateEvent;
+static SIM_EventIdType s_adcEvent;
+static uint8 s_adcRunning = FALSE;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+/*Vectors of the drivers built unchanged from the target sources*/
+void INT0_vect(void);
+void ADC_vect(void);
+
+static void SIM_DOOR_update(void);
+static void SIM_DOOR_convert(void);
+static void SIM_DOOR_portWritten(uint8 a_port);
+static void SIM_DOOR_updateSwitches(void);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void SIM_DOOR_init(void)
+{
+	s_position = 0.0;
+	SIM_DOOR_updateSwitches();
+
+	SIM_addPortHooks(DC_MOTOR_PORT1,NULL_PTR,&SIM_DOOR_portWritten);
+
+	s_updateEvent = SIM_addEvent(&SIM_DOOR_update,SIM_MODEL_EVENT);
+	s_adcEvent = SIM_addEvent(&SIM_DOOR_convert,SIM_INTERRUPT_EVENT);
+	SIM_startEvent(s_updateEvent,SIM_DOOR_UPDATE_PERIOD,SIM_DOOR_UPDATE_PERIOD);
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Move the door one step , raise the encoder interrupts & follow the ADC mode*/
+static void SIM_DOOR_update(void)
+{
+	const double step = SIM_SECONDS(SIM_DOOR_UPDATE_PERIOD);
+	double duty = SIM_getPwmDuty(PWM_TIMER0) / 255.0;
+	double target;
+	sint32 pulsesBefore = (sint32)s_position;
+	sint32 pulse;
+	boolean stalled = FALSE;
+	SIM_TimeType conversion;
+
+	s_position += s_direction * duty * SIM_DOOR_MAX_SPEED * step;
+	if(s_position <= 0.0)
+	{
+		s_position = 0.0;
+		stalled = (s_direction < 0) ? TRUE : FALSE;
+	}
+	else if(s_position >= SIM_DOOR_TRAVEL_PULSES)
+	{
+		s_position = SIM_DOOR_TRAVEL_PULSES;
+		stalled = (s_direction > 0) ? TRUE : FALSE;
+	}
+
+	/*One rising edge per pulse crossed (edges are lost while INT0 is off)*/
+	for(pulse = pulsesBefore ; pulse != (sint32)s_position ; pulse += (pulse < (sint32)s_position) ? 1 : -1)
+	{
+		if(BIT_IS_SET(GICR,INT0))
+		{
+			SIM_raiseInterrupt(&INT0_vect);
+		}
+	}
+	SIM_DOOR_updateSwitches();
+
+	/*First order current response*/
+	if(0 == s_direction || 0.0 == duty)
+	{
+		target = 0.0;
+	}
+	else if(stalled)
+	{
+		target = SIM_DOOR_STALL_CURRENT * duty;
+	}
+	else
+	{
+		target = SIM_DOOR_RUN_CURRENT + SIM_DOOR_LOAD_CURRENT * duty;
+	}
+	s_current += (target - s_current) * step / (SIM_DOOR_CURRENT_RISE + step);
+
+	/*Free running conversions : ADC clock = F_CPU / 2^ADPS , 13 clocks each*/
+	if(BIT_IS_SET(ADCSRA,ADEN) && BIT_IS_SET(ADCSRA,ADATE) && BIT_IS_SET(ADCSRA,ADIE))
+	{
+		if(FALSE == s_adcRunning)
+		{
+			conversion = 13ULL * (1ULL << ((0 == (ADCSRA & 0x07)) ? 1 : (ADCSRA & 0x07))) *
+					1000000000ULL / F_CPU;
+			SIM_startEvent(s_adcEvent,conversion,conversion);
+			s_adcRunning = TRUE;
+		}
+	}
+	else if(s_adcRunning)
+	{
+		SIM_stopEvent(s_adcEvent);
+		s_adcRunning = FALSE;
+	}
+}
+
+/* Description :
+ * End of one conversion*/
+static void SIM_DOOR_convert(void)
+{
+	uint16 sample = 0;
+
+	if(CURRENT_ADC_CHANNEL == (ADMUX & 0x07))
+	{
+		sample = (s_current > 1023.0) ? 1023 : (uint16)s_current;
+	}
+	ADC = sample;
+	ADC_vect();
+}
+
+/* Description :
+ * Follow the H-bridge inputs & the buzzer*/
+static void SIM_DOOR_portWritten(uint8 a_port)
+{
+	uint8 output = SIM_getPortOutput(a_port);
+	sint8 direction = 0;
+
+	if(BIT_IS_SET(output,DC_MOTOR_PIN1) && BIT_IS_CLEAR(output,DC_MOTOR_PIN2))
+	{
+		direction = 1;
+	}
+	else if(BIT_IS_CLEAR(output,DC_MOTOR_PIN1) && BIT_IS_SET(output,DC_MOTOR_PIN2))
+	{
+		direction = -1;
+	}
+	if(direction != s_direction)
+	{
+		s_direction = direction;
+		SIM_log("motor %s at %d pulses",(direction > 0) ? "opening" :
+				((direction < 0) ? "closing" : "stopped"),(int)s_position);
+	}
+
+	if(BUZZER_PORT == a_port && (BIT_IS_SET(output,BUZZER_PIN) ? LOGIC_HIGH : LOGIC_LOW) != s_buzzer)
+	{
+		s_buzzer = BIT_IS_SET(output,BUZZER_PIN) ? LOGIC_HIGH : LOGIC_LOW;
+		SIM_log("buzzer %s",(LOGIC_HIGH == s_buzzer) ? "on" : "off");
+	}
+}
+
+/* Description :
+ * Active low limit switches at both ends*/
+static void SIM_DOOR_updateSwitches(void)
+{
+	if(s_position >= SIM_DOOR_TRAVEL_PULSES)
+	{
+		SIM_drivePin(POSITION_OPEN_LIMIT_PORT,POSITION_OPEN_LIMIT_PIN,LOGIC_LOW);
+	}
+	else
+	{
+		SIM_releasePin(POSITION_OPEN_LIMIT_PORT,POSITION_OPEN_LIMIT_PIN);
+	}
+
+	if(s_position <= 0.0)
+	{
+		SIM_drivePin(POSITION_CLOSED_LIMIT_PORT,POSITION_CLOSED_LIMIT_PIN,LOGIC_LOW);
+	}
+	else
+	{
+		SIM_releasePin(POSITION_CLOSED_LIMIT_PORT,POSITION_CLOSED_LIMIT_PIN);
+	}
+}
@@ -0,0 +1,51 @@
+/******************************************************************************
+ *
+ * Module: Door Plant Model
+ *
+ * File Name: door_plant.h
+ *
+ * Description: Header file for the model of the hardware around the Control
+ * 				ECU : door motor (H-bridge & PWM) , encoder , limit switches ,
+ * 				motor current seen by the ADC & buzzer
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef DOOR_PLANT_H_
+#define DOOR_PLANT_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Mechanics : encoder pulses from closed to open & speed at full duty*/
+#define SIM_DOOR_TRAVEL_PULSES		600
+#define SIM_DOOR_MAX_SPEED			110.0	/*pulses/s*/
+
+/*Motor current in ADC counts : free running & stalled at full duty ,
+ * the stalled current builds up with SIM_DOOR_CURRENT_RISE*/
+#define SIM_DOOR_RUN_CURRENT		40.0
+#define SIM_DOOR_LOAD_CURRENT		150.0
+#define SIM_DOOR_STALL_CURRENT		600.0
+#define SIM_DOOR_CURRENT_RISE		0.02	/*s*/
+
+#define SIM_DOOR_UPDATE_PERIOD		SIM_MS(1)
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Wire the model to the virtual ports & start it (door closed)*/
+void SIM_DOOR_init(void);
+
+#endif /* DOOR_PLANT_H_ */
@@ -0,0 +1,190 @@
+/******************************************************************************
+ *
+ * Module: Simulated EEPROM
+ *
+ * File Name: eeprom_24cxx.c
+ *
+ * Description: Source file for the 24Cxx serial EEPROM model
+ *
+ * 				Bytes written after the word address go to the page latch
+ * 				(rolling over inside the page) & are programmed at the STOP ,
+ * 				the part then ignores its address for the write cycle time
+ * 				so a driver that polls too early sees the NACK.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "sim.h"
+#include "eeprom_24cxx.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static uint8 s_memory[SIM_EEPROM_MAX_SIZE];
+static uint32 s_size = 0;
+static uint8 s_pageSize = 16;
+static uint8 s_addressBytes = 1;
+static int s_fd = -1;
+
+/*Internal address counter*/
+static uint32 s_pointer = 0;
+
+/*Word address bytes still expected after the device address*/
+static uint8 s_addressPending = 0;
+
+/*Page latch , s_latched[i] is TRUE when s_latch[i] was written*/
+static uint8 s_latch[SIM_EEPROM_MAX_PAGE];
+static uint8 s_latched[SIM_EEPROM_MAX_PAGE];
+static uint32 s_latchPage = 0;
+static boolean s_latchUsed = FALSE;
+
+static SIM_TimeType s_busyUntil = 0;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static boolean SIM_EEPROM_select(uint8 a_address , boolean a_read);
+static boolean SIM_EEPROM_write(uint8 a_data);
+static uint8 SIM_EEPROM_read(boolean a_ack);
+static void SIM_EEPROM_stop(void);
+
+static const SIM_TwiDeviceType s_device =
+{
+	&SIM_EEPROM_select , &SIM_EEPROM_write , &SIM_EEPROM_read , &SIM_EEPROM_stop
+};
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void SIM_EEPROM_init(uint32 a_size , uint8 a_pageSize , const char * a_file)
+{
+	s_size = (a_size > SIM_EEPROM_MAX_SIZE) ? SIM_EEPROM_MAX_SIZE : a_size;
+	s_pageSize = (a_pageSize > SIM_EEPROM_MAX_PAGE) ? SIM_EEPROM_MAX_PAGE : a_pageSize;
+	s_addressBytes = (s_size > SIM_EEPROM_ONE_BYTE_LIMIT) ? 2 : 1;
+
+	/*Erased part , then whatever the file holds*/
+	memset(s_memory,0xFF,s_size);
+	s_fd = open(a_file,O_RDWR | O_CREAT,0644);
+	if(s_fd < 0)
+	{
+		SIM_log("cannot open %s , the EEPROM is not persistent",a_file);
+	}
+	else if(read(s_fd,s_memory,s_size) < (ssize_t)s_size)
+	{
+		memset(s_memory,0xFF,s_size);
+		if(pwrite(s_fd,s_memory,s_size,0) != (ssize_t)s_size)
+		{
+			SIM_log("cannot initialize %s",a_file);
+		}
+	}
+
+	SIM_twiAttach(&s_device);
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+static boolean SIM_EEPROM_select(uint8 a_address , boolean a_read)
+{
+	uint8 blocks = (1 == s_addressBytes) ? (uint8)((s_size + 255) / 256) : 1;
+
+	if(a_address < SIM_EEPROM_ADDRESS || a_address >= SIM_EEPROM_ADDRESS + blocks ||
+			SIM_now() < s_busyUntil)
+	{
+		return FALSE;
+	}
+
+	if(FALSE == a_read)
+	{
+		/*The block bits of the device address are the high word address bits*/
+		s_pointer = (1 == s_addressBytes) ? (uint32)(a_address - SIM_EEPROM_ADDRESS) << 8 : 0;
+		s_addressPending = s_addressBytes;
+		s_latchUsed = FALSE;
+	}
+	return TRUE;
+}
+
+static boolean SIM_EEPROM_write(uint8 a_data)
+{
+	uint8 offset;
+
+	if(s_addressPending > 0)
+	{
+		s_addressPending--;
+		if(1 == s_addressBytes)
+		{
+			s_pointer = (s_pointer & 0x700) | a_data;
+		}
+		else if(1 == s_addressPending)
+		{
+			s_pointer = (uint32)a_data << 8;
+		}
+		else
+		{
+			s_pointer = (s_pointer | a_data) % s_size;
+		}
+		return TRUE;
+	}
+
+	if(FALSE == s_latchUsed)
+	{
+		s_latchPage = s_pointer - (s_pointer % s_pageSize);
+		memset(s_latched,FALSE,sizeof(s_latched));
+		s_latchUsed = TRUE;
+	}
+	offset = s_pointer % s_pageSize;
+	s_latch[offset] = a_data;
+	s_latched[offset] = TRUE;
+	/*The counter rolls over inside the page*/
+	s_pointer = s_latchPage + (offset + 1) % s_pageSize;
+	return TRUE;
+}
+
+static uint8 SIM_EEPROM_read(boolean a_ack)
+{
+	uint8 data = s_memory[s_pointer];
+
+	(void)a_ack;
+	/*Sequential reads roll over the whole memory*/
+	s_pointer = (s_pointer + 1) % s_size;
+	return data;
+}
+
+static void SIM_EEPROM_stop(void)
+{
+	uint8 offset;
+
+	if(FALSE == s_latchUsed)
+	{
+		return;
+	}
+	s_latchUsed = FALSE;
+
+	for(offset = 0 ; offset < s_pageSize ; offset++)
+	{
+		if(s_latched[offset])
+		{
+			s_memory[s_latchPage + offset] = s_latch[offset];
+		}
+	}
+	if(s_fd >= 0 && pwrite(s_fd,&s_memory[s_latchPage],s_pageSize,s_latchPage) != s_pageSize)
+	{
+		SIM_log("EEPROM file write failed");
+	}
+	s_busyUntil = SIM_now() + SIM_EEPROM_WRITE_CYCLE;
+}
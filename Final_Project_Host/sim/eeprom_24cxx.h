@@ -0,0 +1,52 @@
+/******************************************************************************
+ *
+ * Module: Simulated EEPROM
+ *
+ * File Name: eeprom_24cxx.h
+ *
+ * Description: Header file for the 24Cxx serial EEPROM model on the virtual
+ * 				TWI bus , the contents are kept in a file so they survive
+ * 				a restart of the simulation like the real part
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef EEPROM_24CXX_H_
+#define EEPROM_24CXX_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Device type identifier (1010) , A2:A0 are the block bits up to the 24C16*/
+#define SIM_EEPROM_ADDRESS			0x50
+
+/*Internal write cycle (t_WR) , the part does not answer meanwhile*/
+#define SIM_EEPROM_WRITE_CYCLE		SIM_MS(5)
+
+/*The largest part with a single word address byte (24C16)*/
+#define SIM_EEPROM_ONE_BYTE_LIMIT	2048
+
+#define SIM_EEPROM_MAX_SIZE			65536UL
+#define SIM_EEPROM_MAX_PAGE			128
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Attach a part of a_size bytes with a_pageSize pages to the TWI bus ,
+ * its contents are loaded from a_file (erased 0xFF if missing)
+ * 24C01 .. 24C16 take one word address byte , bigger parts two*/
+void SIM_EEPROM_init(uint32 a_size , uint8 a_pageSize , const char * a_file);
+
+#endif /* EEPROM_24CXX_H_ */
@@ -0,0 +1,251 @@
+/******************************************************************************
+ *
+ * Module: Keypad Model
+ *
+ * File Name: keypad_matrix.c
+ *
+ * Description: Source file for the 4x4 keypad matrix model
+ *
+ * 				A pressed key connects its row to its column , the column
+ * 				reads LOW while the keypad driver drives that row LOW (the
+ * 				other columns are pulled up). The key is released when the
+ * 				driver stops driving the row after having seen it , so one
+ * 				script key is exactly one KEYPAD_getPressedKey result.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include "common_macros.h"
+#include "gpio.h"
+#include "keypad.h"
+#include "sim.h"
+#include "keypad_matrix.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define SIM_KEYPAD_NO_KEY		0xFF
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef struct
+{
+	uint8 button;		/*0 .. 15 , SIM_KEYPAD_NO_KEY for a wait*/
+	uint32 wait;		/*ms*/
+}SIM_KEYPAD_ActionType;
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+/*Key of each button (row * 4 + column) , the keypad driver maps them back*/
+static const char s_keys[16] =
+{
+	'7' , '8' , '9' , '%' ,
+	'4' , '5' , '6' , '*' ,
+	'1' , '2' , '3' , '-' ,
+	'E' , '0' , '=' , '+'
+};
+
+static SIM_KEYPAD_ActionType s_queue[SIM_KEYPAD_QUEUE_SIZE];
+static uint16 s_head = 0;
+static uint16 s_tail = 0;
+
+static char s_line[SIM_KEYPAD_LINE_SIZE];
+static uint16 s_lineLength = 0;
+static boolean s_endOfScript = FALSE;
+
+static uint8 s_pressed = SIM_KEYPAD_NO_KEY;
+static boolean s_seen = FALSE;
+static SIM_TimeType s_nextKeyAt = 0;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void SIM_KEYPAD_columnsRead(uint8 a_port);
+static void SIM_KEYPAD_rowsWritten(uint8 a_port);
+static boolean SIM_KEYPAD_rowActive(void);
+static void SIM_KEYPAD_readScript(void);
+static void SIM_KEYPAD_parseLine(char * a_line);
+static void SIM_KEYPAD_push(uint8 a_button , uint32 a_wait);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void SIM_KEYPAD_init(void)
+{
+	uint8 column;
+
+	/*External pull-ups on the columns*/
+	for(column = 0 ; column < KEYPAD_NUM_COLS ; column++)
+	{
+		SIM_drivePin(KEYPAD_COL_PORT_ID,KEYPAD_FIRST_COL_PIN_ID + column,LOGIC_HIGH);
+	}
+	SIM_addPortHooks(KEYPAD_COL_PORT_ID,&SIM_KEYPAD_columnsRead,NULL_PTR);
+	SIM_addPortHooks(KEYPAD_ROW_PORT_ID,NULL_PTR,&SIM_KEYPAD_rowsWritten);
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Press the next key of the script when its time comes & connect the columns*/
+static void SIM_KEYPAD_columnsRead(uint8 a_port)
+{
+	uint8 column;
+
+	SIM_KEYPAD_readScript();
+
+	while(SIM_KEYPAD_NO_KEY == s_pressed && s_head != s_tail && SIM_now() >= s_nextKeyAt)
+	{
+		if(SIM_KEYPAD_NO_KEY == s_queue[s_tail].button)
+		{
+			s_nextKeyAt = SIM_now() + SIM_MS(s_queue[s_tail].wait);
+		}
+		else
+		{
+			s_pressed = s_queue[s_tail].button;
+			s_seen = FALSE;
+			SIM_log("key %c",s_keys[s_pressed]);
+		}
+		s_tail = (s_tail + 1) % SIM_KEYPAD_QUEUE_SIZE;
+	}
+
+	if(SIM_KEYPAD_NO_KEY == s_pressed && s_head == s_tail && s_endOfScript &&
+			SIM_now() >= s_nextKeyAt)
+	{
+		SIM_log("end of the keypad script");
+		SIM_exit(EXIT_SUCCESS);
+	}
+
+	for(column = 0 ; column < KEYPAD_NUM_COLS ; column++)
+	{
+		SIM_drivePin(a_port,KEYPAD_FIRST_COL_PIN_ID + column,LOGIC_HIGH);
+	}
+	if(SIM_KEYPAD_NO_KEY != s_pressed && SIM_KEYPAD_rowActive())
+	{
+		column = s_pressed % KEYPAD_NUM_COLS;
+		SIM_drivePin(a_port,KEYPAD_FIRST_COL_PIN_ID + column,LOGIC_LOW);
+		s_seen = TRUE;
+	}
+}
+
+/* Description :
+ * Release the key once the driver stopped driving the row it was seen on*/
+static void SIM_KEYPAD_rowsWritten(uint8 a_port)
+{
+	(void)a_port;
+	if(SIM_KEYPAD_NO_KEY != s_pressed && s_seen && FALSE == SIM_KEYPAD_rowActive())
+	{
+		s_pressed = SIM_KEYPAD_NO_KEY;
+	}
+}
+
+/* Description :
+ * Return TRUE if the row of the pressed key is an output driven LOW*/
+static boolean SIM_KEYPAD_rowActive(void)
+{
+	uint8 pin = KEYPAD_FIRST_ROW_PIN_ID + s_pressed / KEYPAD_NUM_COLS;
+
+	return (BIT_IS_SET(SIM_getPortDirection(KEYPAD_ROW_PORT_ID),pin) &&
+			BIT_IS_CLEAR(SIM_getPortOutput(KEYPAD_ROW_PORT_ID),pin)) ? TRUE : FALSE;
+}
+
+/* Description :
+ * Take the complete lines waiting on the standard input*/
+static void SIM_KEYPAD_readScript(void)
+{
+	struct pollfd input = {STDIN_FILENO,POLLIN,0};
+	char character;
+
+	/*Half the queue is left for the longest line*/
+	while(FALSE == s_endOfScript &&
+			(s_head - s_tail + SIM_KEYPAD_QUEUE_SIZE) % SIM_KEYPAD_QUEUE_SIZE < SIM_KEYPAD_QUEUE_SIZE / 2 &&
+			poll(&input,1,0) > 0)
+	{
+		if(read(STDIN_FILENO,&character,1) != 1)
+		{
+			s_endOfScript = TRUE;
+			character = '\n';
+		}
+		if('\n' == character || s_lineLength == SIM_KEYPAD_LINE_SIZE - 1)
+		{
+			s_line[s_lineLength] = '\0';
+			SIM_KEYPAD_parseLine(s_line);
+			s_lineLength = 0;
+		}
+		else
+		{
+			s_line[s_lineLength++] = character;
+		}
+	}
+}
+
+/* Description :
+ * Queue the keys & waits of one script line*/
+static void SIM_KEYPAD_parseLine(char * a_line)
+{
+	char * token;
+	char * key;
+	char * comment = strchr(a_line,'#');
+	uint8 button;
+
+	if(NULL_PTR != comment)
+	{
+		*comment = '\0';
+	}
+
+	for(token = strtok(a_line," \t\r") ; NULL_PTR != token ; token = strtok(NULL_PTR," \t\r"))
+	{
+		if(0 == strcmp(token,"wait"))
+		{
+			token = strtok(NULL_PTR," \t\r");
+			SIM_KEYPAD_push(SIM_KEYPAD_NO_KEY,(NULL_PTR == token) ? 0 : (uint32)atol(token));
+			continue;
+		}
+		for(key = token ; '\0' != *key ; key++)
+		{
+			for(button = 0 ; button < 16 && s_keys[button] != *key ; button++);
+			if(button < 16)
+			{
+				SIM_KEYPAD_push(button,0);
+			}
+			else
+			{
+				SIM_log("unknown key '%c' in the script",*key);
+			}
+		}
+	}
+}
+
+static void SIM_KEYPAD_push(uint8 a_button , uint32 a_wait)
+{
+	uint16 next = (s_head + 1) % SIM_KEYPAD_QUEUE_SIZE;
+
+	if(next == s_tail)
+	{
+		SIM_log("keypad script queue full , action dropped");
+		return;
+	}
+	s_queue[s_head].button = a_button;
+	s_queue[s_head].wait = a_wait;
+	s_head = next;
+}
@@ -0,0 +1,47 @@
+/******************************************************************************
+ *
+ * Module: Keypad Model
+ *
+ * File Name: keypad_matrix.h
+ *
+ * Description: Header file for the 4x4 keypad matrix model of the HMI ECU ,
+ * 				the key presses come from a script read on the standard input
+ *
+ * 				Script syntax (one or more items per line , '#' comments) :
+ * 					0-9 % * - + =	keys , several keys may follow each other
+ * 					E				the Enter key
+ * 					wait <ms>		no key for <ms> of simulated time
+ * 				The simulation of the HMI ends when the script is over
+ * 				& the firmware waits for a key.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef KEYPAD_MATRIX_H_
+#define KEYPAD_MATRIX_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define SIM_KEYPAD_QUEUE_SIZE		512
+#define SIM_KEYPAD_LINE_SIZE		256
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Wire the model to the keypad rows & columns of the HMI ECU*/
+void SIM_KEYPAD_init(void);
+
+#endif /* KEYPAD_MATRIX_H_ */
@@ -0,0 +1,131 @@
+/******************************************************************************
+ *
+ * Module: Simulation Launcher
+ *
+ * File Name: launcher.c
+ *
+ * Description: Runs the Control & HMI ECUs of the host simulation as two
+ * 				processes joined by a virtual serial line (socket pair)
+ *
+ * 				door_sim [control executable] [hmi executable] < script
+ *
+ * 				The standard input is the keypad script of the HMI , the
+ * 				simulation ends with the script & the exit status is the
+ * 				one of the HMI.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define LAUNCHER_DEFAULT_CONTROL	"./control_sim"
+#define LAUNCHER_DEFAULT_HMI		"./hmi_sim"
+
+/*Time the Control ECU gets to notice the end of the HMI before it is stopped*/
+#define LAUNCHER_GRACE_TIME_MS		2000
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static pid_t LAUNCHER_start(const char * a_executable , int a_uartFd , int a_otherFd , int a_input);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+int main(int argc , char * argv[])
+{
+	const char * control = (argc > 1) ? argv[1] : LAUNCHER_DEFAULT_CONTROL;
+	const char * hmi = (argc > 2) ? argv[2] : LAUNCHER_DEFAULT_HMI;
+	struct timespec pause = {0,10000000L};
+	int line[2];
+	int nothing;
+	int status = EXIT_FAILURE;
+	pid_t controlPid;
+	pid_t hmiPid;
+	int waited;
+
+	if(socketpair(AF_UNIX,SOCK_SEQPACKET,0,line) < 0)
+	{
+		perror("socketpair");
+		return EXIT_FAILURE;
+	}
+
+	/*Only the HMI reads the keypad script*/
+	nothing = open("/dev/null",O_RDONLY);
+	controlPid = LAUNCHER_start(control,line[0],line[1],nothing);
+	hmiPid = LAUNCHER_start(hmi,line[1],line[0],STDIN_FILENO);
+	close(line[0]);
+	close(line[1]);
+	close(nothing);
+
+	if(controlPid < 0 || hmiPid < 0)
+	{
+		return EXIT_FAILURE;
+	}
+
+	waitpid(hmiPid,&status,0);
+
+	/*The Control ECU ends by itself at its next access to the closed line*/
+	for(waited = 0 ; waited < LAUNCHER_GRACE_TIME_MS && 0 == waitpid(controlPid,NULL,WNOHANG) ; waited += 10)
+	{
+		nanosleep(&pause,NULL);
+	}
+	if(waited >= LAUNCHER_GRACE_TIME_MS)
+	{
+		kill(controlPid,SIGTERM);
+		waitpid(controlPid,NULL,0);
+	}
+
+	return WIFEXITED(status) ? WEXITSTATUS(status) : EXIT_FAILURE;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Run one ECU with its end of the serial line in SIM_UART_FD*/
+static pid_t LAUNCHER_start(const char * a_executable , int a_uartFd , int a_otherFd , int a_input)
+{
+	char descriptor[16];
+	pid_t pid = fork();
+
+	if(0 == pid)
+	{
+		close(a_otherFd);
+		if(a_input != STDIN_FILENO)
+		{
+			dup2(a_input,STDIN_FILENO);
+		}
+		snprintf(descriptor,sizeof(descriptor),"%d",a_uartFd);
+		setenv("SIM_UART_FD",descriptor,1);
+		execl(a_executable,a_executable,(char *)NULL);
+		perror(a_executable);
+		_exit(EXIT_FAILURE);
+	}
+	else if(pid < 0)
+	{
+		perror("fork");
+	}
+	return pid;
+}
@@ -0,0 +1,159 @@
+/******************************************************************************
+ *
+ * Module: LCD Model
+ *
+ * File Name: lcd_hd44780.c
+ *
+ * Description: Source file for the 2x16 HD44780 LCD model
+ *
+ * 				A nibble is latched from D7:D4 on every falling edge of E ,
+ * 				two nibbles (high first) make a command (RS = 0) or a
+ * 				character (RS = 1). The LCD driver always sends both
+ * 				nibbles , the initialization included.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <string.h>
+#include "common_macros.h"
+#include "gpio.h"
+#include "LCD.h"
+#include "sim.h"
+#include "lcd_hd44780.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static char s_screen[SIM_LCD_ROWS][SIM_LCD_COLUMNS];
+static char s_printed[SIM_LCD_ROWS][SIM_LCD_COLUMNS];
+static uint8 s_address = 0;
+
+static uint8 s_enable = LOGIC_LOW;
+static uint8 s_highNibble = 0;
+static boolean s_secondNibble = FALSE;
+
+static SIM_EventIdType s_settleEvent;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void SIM_LCD_portWritten(uint8 a_port);
+static void SIM_LCD_execute(uint8 a_rs , uint8 a_byte);
+static void SIM_LCD_print(void);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void SIM_LCD_init(void)
+{
+	memset(s_screen,' ',sizeof(s_screen));
+	memset(s_printed,' ',sizeof(s_printed));
+
+	SIM_addPortHooks(LCD_E_PORT_ID,NULL_PTR,&SIM_LCD_portWritten);
+	s_settleEvent = SIM_addEvent(&SIM_LCD_print,SIM_MODEL_EVENT);
+	SIM_atExit(&SIM_LCD_print);
+}
+
+void SIM_LCD_getRow(uint8 a_row , char * a_text)
+{
+	memcpy(a_text,s_screen[a_row % SIM_LCD_ROWS],SIM_LCD_COLUMNS);
+	a_text[SIM_LCD_COLUMNS] = '\0';
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Latch a nibble on the falling edge of E*/
+static void SIM_LCD_portWritten(uint8 a_port)
+{
+	uint8 output = SIM_getPortOutput(a_port);
+	uint8 enable = BIT_IS_SET(output,LCD_E_PIN_ID) ? LOGIC_HIGH : LOGIC_LOW;
+	uint8 nibble;
+
+	if(LOGIC_HIGH == s_enable && LOGIC_LOW == enable &&
+			BIT_IS_SET(SIM_getPortDirection(a_port),LCD_E_PIN_ID))
+	{
+		nibble = (BIT_IS_SET(output,LCD_DB4_PIN_ID) ? 0x01 : 0) |
+				(BIT_IS_SET(output,LCD_DB5_PIN_ID) ? 0x02 : 0) |
+				(BIT_IS_SET(output,LCD_DB6_PIN_ID) ? 0x04 : 0) |
+				(BIT_IS_SET(output,LCD_DB7_PIN_ID) ? 0x08 : 0);
+		if(s_secondNibble)
+		{
+			SIM_LCD_execute(BIT_IS_SET(output,LCD_RS_PIN_ID) ? LOGIC_HIGH : LOGIC_LOW,
+					(s_highNibble << 4) | nibble);
+		}
+		else
+		{
+			s_highNibble = nibble;
+		}
+		s_secondNibble = !s_secondNibble;
+	}
+	s_enable = enable;
+}
+
+/* Description :
+ * Run one command or write one character at the address counter*/
+static void SIM_LCD_execute(uint8 a_rs , uint8 a_byte)
+{
+	uint8 row;
+	uint8 column;
+
+	if(LOGIC_HIGH == a_rs)
+	{
+		row = (s_address >= SIM_LCD_ROW1_ADDRESS) ? 1 : 0;
+		column = s_address - row * SIM_LCD_ROW1_ADDRESS;
+		if(column < SIM_LCD_COLUMNS)
+		{
+			s_screen[row][column] = (a_byte >= ' ' && a_byte < 0x7F) ? a_byte : '?';
+		}
+		s_address++;
+	}
+	else if(a_byte & LCD_SET_CURSOR_LOCATION)
+	{
+		s_address = a_byte & 0x7F;
+	}
+	else if(LCD_CLEAR_COMMAND == a_byte)
+	{
+		memset(s_screen,' ',sizeof(s_screen));
+		s_address = 0;
+	}
+	else if(LCD_GO_TO_HOME == (a_byte & 0xFE))
+	{
+		s_address = 0;
+	}
+	else
+	{
+		/*Function set , display control & entry mode don't change the text*/
+	}
+
+	SIM_startEvent(s_settleEvent,SIM_LCD_SETTLE_TIME,0);
+}
+
+/* Description :
+ * Print the screen if it changed since the last print*/
+static void SIM_LCD_print(void)
+{
+	char row0[SIM_LCD_COLUMNS + 1];
+	char row1[SIM_LCD_COLUMNS + 1];
+
+	if(0 == memcmp(s_screen,s_printed,sizeof(s_screen)))
+	{
+		return;
+	}
+	memcpy(s_printed,s_screen,sizeof(s_screen));
+	SIM_LCD_getRow(0,row0);
+	SIM_LCD_getRow(1,row1);
+	SIM_log("LCD |%s|%s|",row0,row1);
+}
@@ -0,0 +1,50 @@
+/******************************************************************************
+ *
+ * Module: LCD Model
+ *
+ * File Name: lcd_hd44780.h
+ *
+ * Description: Header file for the 2x16 HD44780 LCD model , it decodes the
+ * 				4-bit bus of the HMI ECU & prints the screen once it settles
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef LCD_HD44780_H_
+#define LCD_HD44780_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define SIM_LCD_ROWS			2
+#define SIM_LCD_COLUMNS			16
+
+/*DDRAM address of the second row*/
+#define SIM_LCD_ROW1_ADDRESS	0x40
+
+/*The screen is printed when no write came for this time*/
+#define SIM_LCD_SETTLE_TIME		SIM_MS(200)
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Wire the model to the LCD pins of the HMI ECU*/
+void SIM_LCD_init(void);
+
+/* Description :
+ * Copy the text of a row (SIM_LCD_COLUMNS characters + '\0')*/
+void SIM_LCD_getRow(uint8 a_row , char * a_text);
+
+#endif /* LCD_HD44780_H_ */
@@ -0,0 +1,173 @@
+/******************************************************************************
+ *
+ * Module: Simulated RTC
+ *
+ * File Name: rtc_ds1307.c
+ *
+ * Description: Source file for the DS1307 real time clock model
+ *
+ * 				The date registers are filled from the running clock when the
+ * 				chip is addressed (the real part copies them to its read
+ * 				buffer at the START) , writing the seconds register (re)starts
+ * 				the clock from the written date.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <time.h>
+#include "sim.h"
+#include "rtc_ds1307.h"
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static uint8 s_registers[SIM_RTC_REGISTERS];
+
+/*Clock at the simulated time 0 , meaningless while halted*/
+static uint64 s_start = 0;
+static boolean s_halted = TRUE;
+
+static uint8 s_pointer = 0;
+static boolean s_addressPending = FALSE;
+static boolean s_timeWritten = FALSE;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static boolean SIM_RTC_select(uint8 a_address , boolean a_read);
+static boolean SIM_RTC_write(uint8 a_data);
+static uint8 SIM_RTC_read(boolean a_ack);
+static void SIM_RTC_stop(void);
+static void SIM_RTC_latch(void);
+static uint8 SIM_RTC_toBcd(int a_value);
+static int SIM_RTC_fromBcd(uint8 a_bcd);
+
+static const SIM_TwiDeviceType s_device =
+{
+	&SIM_RTC_select , &SIM_RTC_write , &SIM_RTC_read , &SIM_RTC_stop
+};
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void SIM_RTC_init(uint64 a_time)
+{
+	s_halted = (0 == a_time);
+	s_start = a_time;
+	s_registers[0] = 0x80;	/*CH : a new chip is stopped*/
+	SIM_RTC_latch();
+
+	SIM_twiAttach(&s_device);
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+static boolean SIM_RTC_select(uint8 a_address , boolean a_read)
+{
+	if(SIM_RTC_ADDRESS != a_address)
+	{
+		return FALSE;
+	}
+
+	SIM_RTC_latch();
+	s_addressPending = !a_read;
+	s_timeWritten = FALSE;
+	return TRUE;
+}
+
+static boolean SIM_RTC_write(uint8 a_data)
+{
+	if(s_addressPending)
+	{
+		s_pointer = a_data % SIM_RTC_REGISTERS;
+		s_addressPending = FALSE;
+		return TRUE;
+	}
+
+	s_registers[s_pointer] = a_data;
+	if(s_pointer < SIM_RTC_TIME_SIZE)
+	{
+		s_timeWritten = TRUE;
+	}
+	s_pointer = (s_pointer + 1) % SIM_RTC_REGISTERS;
+	return TRUE;
+}
+
+static uint8 SIM_RTC_read(boolean a_ack)
+{
+	uint8 data = s_registers[s_pointer];
+
+	(void)a_ack;
+	s_pointer = (s_pointer + 1) % SIM_RTC_REGISTERS;
+	return data;
+}
+
+static void SIM_RTC_stop(void)
+{
+	struct tm date = {0};
+
+	if(FALSE == s_timeWritten)
+	{
+		return;
+	}
+	s_timeWritten = FALSE;
+
+	/*The clock runs from the written date , the day of week register is kept as written*/
+	s_halted = (s_registers[0] & 0x80) ? TRUE : FALSE;
+	date.tm_sec = SIM_RTC_fromBcd(s_registers[0] & 0x7F);
+	date.tm_min = SIM_RTC_fromBcd(s_registers[1]);
+	date.tm_hour = SIM_RTC_fromBcd(s_registers[2] & 0x3F);
+	date.tm_mday = SIM_RTC_fromBcd(s_registers[4]);
+	date.tm_mon = SIM_RTC_fromBcd(s_registers[5]) - 1;
+	date.tm_year = SIM_RTC_fromBcd(s_registers[6]) + 100;
+	s_start = (uint64)timegm(&date) - (uint64)SIM_SECONDS(SIM_now());
+
+	SIM_log("RTC set to 20%02X-%02X-%02X %02X:%02X:%02X",s_registers[6],s_registers[5],
+			s_registers[4],s_registers[2],s_registers[1],s_registers[0]);
+}
+
+/* Description :
+ * Copy the running clock into the date registers (24 hour mode)*/
+static void SIM_RTC_latch(void)
+{
+	time_t now;
+	struct tm date;
+
+	if(s_halted)
+	{
+		return;
+	}
+
+	now = (time_t)(s_start + (uint64)SIM_SECONDS(SIM_now()));
+	gmtime_r(&now,&date);
+
+	s_registers[0] = SIM_RTC_toBcd(date.tm_sec);
+	s_registers[1] = SIM_RTC_toBcd(date.tm_min);
+	s_registers[2] = SIM_RTC_toBcd(date.tm_hour);
+	s_registers[3] = (uint8)((date.tm_wday + 6) % 7 + 1);	/*Monday = 1*/
+	s_registers[4] = SIM_RTC_toBcd(date.tm_mday);
+	s_registers[5] = SIM_RTC_toBcd(date.tm_mon + 1);
+	s_registers[6] = SIM_RTC_toBcd(date.tm_year % 100);
+}
+
+static uint8 SIM_RTC_toBcd(int a_value)
+{
+	return (uint8)(((a_value / 10) << 4) | (a_value % 10));
+}
+
+static int SIM_RTC_fromBcd(uint8 a_bcd)
+{
+	return (a_bcd >> 4) * 10 + (a_bcd & 0x0F);
+}
@@ -0,0 +1,46 @@
+/******************************************************************************
+ *
+ * Module: Simulated RTC
+ *
+ * File Name: rtc_ds1307.h
+ *
+ * Description: Header file for the DS1307 real time clock model on the
+ * 				virtual TWI bus , the clock starts at the host local time
+ * 				(or SIM_RTC_TIME seconds since 1970 , 0 = stopped chip)
+ * 				& runs with the simulated time
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef RTC_DS1307_H_
+#define RTC_DS1307_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define SIM_RTC_ADDRESS			0x68
+
+/*Date registers 0x00 .. 0x06 , control 0x07 & 56 bytes of RAM*/
+#define SIM_RTC_REGISTERS		64
+#define SIM_RTC_TIME_SIZE		7
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Attach the chip to the TWI bus , a_time is the clock at the start
+ * of the simulation (seconds since 1970) , 0 leaves it stopped (CH set)*/
+void SIM_RTC_init(uint64 a_time);
+
+#endif /* RTC_DS1307_H_ */
@@ -0,0 +1,948 @@
+/******************************************************************************
+ *
+ * Module: Simulation Core
+ *
+ * File Name: sim.c
+ *
+ * Description: Source file for the host simulation core
+ *
+ * 				Simulated time is the wall clock scaled by SIM_SPEED , the
+ * 				events (timer compare , ADC conversions , model updates) run
+ * 				whenever the firmware calls a host driver or waits , which is
+ * 				where a real CPU would have taken the pending interrupts.
+ * 				A wall clock signal runs them too while the firmware spins
+ * 				on RAM flags only.
+ *
+ * 				In virtual time (SIM_SPEED=max) the clock only moves when the
+ * 				firmware waits (delays , UART , sleep) & jumps straight to the
+ * 				next event. The two ECUs keep their own clocks , every byte
+ * 				carries its arrival time & an ECU only looks for input up to
+ * 				the time its peer has reached (plus one frame , the earliest
+ * 				a byte sent later can arrive). An ECU that needs more sends a
+ * 				request , the peer answers with its time when it waits itself.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#define _GNU_SOURCE /*For ppoll*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <time.h>
+#include <poll.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <avr/io.h>
+#include "common_macros.h"
+#include "gpio.h"
+#include "sim.h"
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef struct
+{
+	void (*handler)(void);
+	SIM_TimeType due;
+	SIM_TimeType period;	/*0 = one shot*/
+	uint8 kind;				/*SIM_EventKind*/
+	uint8 armed;
+}SIM_EventType;
+
+/*Message of the serial line , one per datagram*/
+typedef struct
+{
+	uint8 kind;				/*SIM_LinkMessageKind*/
+	uint8 data;
+	uint8 idle;				/*Time : waits for a byte with no deadline*/
+	uint32 count;			/*Time : data messages received by the sender*/
+	SIM_TimeType time;		/*Data : arrival , Time : bound , Request : wanted*/
+}SIM_LinkMessageType;
+
+typedef enum
+{
+	SIM_LINK_DATA , SIM_LINK_TIME , SIM_LINK_REQUEST
+}SIM_LinkMessageKind;
+
+typedef struct
+{
+	SIM_TimeType arrival;
+	uint8 data;
+}SIM_LinkByteType;
+
+typedef struct
+{
+	void (*onRead)(uint8);
+	void (*onWrite)(uint8);
+	uint8 port;
+}SIM_PortHookType;
+
+/*******************************************************************************
+ *                          Global Variable declaration                        *
+ *******************************************************************************/
+
+volatile unsigned char SIM_io[SIM_IO_SIZE];
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static const char * s_name = "ECU";
+static double s_speed = 1.0;
+static struct timespec s_start;
+
+/*Virtual time*/
+static boolean s_virtual = FALSE;
+static SIM_TimeType s_clock = 0;
+static SIM_TimeType s_timeLimit = SIM_FOREVER;
+static uint32 s_polls = 0;
+
+static SIM_EventType s_events[SIM_MAX_EVENTS];
+static uint8 s_eventsCount = 0;
+static uint8 s_dispatching = FALSE;
+/*Nesting of the core functions , the interrupt tick only runs outside them*/
+static volatile sig_atomic_t s_inCore = 0;
+static uint32 s_interrupts = 0;
+
+static SIM_PortHookType s_portHooks[SIM_MAX_PORT_HOOKS];
+static uint8 s_portHooksCount = 0;
+/*Pins driven from outside & their levels*/
+static uint8 s_driveMask[NUM_OF_PORTS];
+static uint8 s_driveLevel[NUM_OF_PORTS];
+
+static const SIM_TwiDeviceType * s_twiDevices[SIM_MAX_TWI_DEVICES];
+static uint8 s_twiDevicesCount = 0;
+
+static uint8 s_pwmDuty[2];
+static uint32 s_pwmFrequency[2];
+
+/*Serial line*/
+static int s_linkFd = -1;
+static SIM_TimeType s_frameTime = 0;
+static SIM_LinkByteType s_rxQueue[SIM_LINK_QUEUE_SIZE];
+static uint16 s_rxHead = 0;
+static uint16 s_rxTail = 0;
+static boolean s_linkClosed = FALSE;
+static uint32 s_rxCount = 0;
+static uint32 s_txCount = 0;
+static uint32 s_syncMessages = 0;
+/*No byte of the peer arrives before s_peerBound , none at all while it is idle*/
+static SIM_TimeType s_peerBound = 0;
+static boolean s_peerIdle = FALSE;
+/*Time the peer waits for this ECU to reach*/
+static SIM_TimeType s_peerWants = 0;
+/*What this ECU told its peer*/
+static SIM_TimeType s_sentBound = 0;
+static boolean s_sentIdle = FALSE;
+/*Waiting for a byte with no deadline*/
+static boolean s_idle = FALSE;
+
+static void (*s_exitHandlers[4])(void);
+static uint8 s_exitHandlersCount = 0;
+
+/*PINx , DDRx & PORTx addresses of each port (3 bytes per port going down from PORTA)*/
+#define SIM_PIN_ADDRESS(port)	(0x19 - 3 * (port))
+#define SIM_DDR_ADDRESS(port)	(0x1A - 3 * (port))
+#define SIM_PORT_ADDRESS(port)	(0x1B - 3 * (port))
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static uint64 SIM_wallClock(void);
+static boolean SIM_advance(boolean a_input , SIM_TimeType a_deadline);
+static void SIM_sleep(boolean a_input , SIM_TimeType a_until);
+static void SIM_jump(boolean a_input , SIM_TimeType a_until);
+static void SIM_setClock(SIM_TimeType a_time);
+static SIM_TimeType SIM_nextDue(void);
+static void SIM_linkPump(void);
+static boolean SIM_linkReady(void);
+static boolean SIM_linkMayHaveInput(void);
+static void SIM_linkSync(SIM_TimeType a_wanted);
+static void SIM_linkWrite(uint8 a_kind , uint8 a_data , SIM_TimeType a_time);
+static void SIM_interruptTick(int a_signal);
+static void SIM_report(void);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void SIM_init(const char * a_name)
+{
+	const char * speed = getenv("SIM_SPEED");
+	const char * limit = getenv("SIM_TIME_LIMIT");
+	struct itimerval tick = {{0,SIM_INTERRUPT_TICK_US},{0,SIM_INTERRUPT_TICK_US}};
+	struct sigaction action;
+
+	s_name = a_name;
+	if(NULL_PTR != speed && 0 == strcmp(speed,"max"))
+	{
+		s_virtual = TRUE;
+	}
+	else if(NULL_PTR != speed && atof(speed) > 0.0)
+	{
+		s_speed = atof(speed);
+	}
+	if(NULL_PTR != limit && atof(limit) > 0.0)
+	{
+		s_timeLimit = (SIM_TimeType)(atof(limit) * 1e9);
+	}
+	/*One line per print even through a pipe , the two ECUs share the terminal*/
+	setvbuf(stdout,NULL_PTR,_IOLBF,0);
+	clock_gettime(CLOCK_MONOTONIC,&s_start);
+	atexit(&SIM_report);
+
+	action.sa_handler = &SIM_interruptTick;
+	action.sa_flags = SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	sigaction(SIGALRM,&action,NULL_PTR);
+	setitimer(ITIMER_REAL,&tick,NULL_PTR);
+}
+
+SIM_TimeType SIM_now(void)
+{
+	return s_virtual ? s_clock : (SIM_TimeType)((double)SIM_wallClock() * s_speed);
+}
+
+void SIM_delay(SIM_TimeType a_time)
+{
+	SIM_advance(FALSE,SIM_now() + a_time);
+}
+
+void SIM_sleepCpu(void)
+{
+	uint32 interrupts = s_interrupts;
+	SIM_TimeType due;
+
+	if(BIT_IS_CLEAR(MCUCR,SE))
+	{
+		return;
+	}
+	s_inCore++;
+	while(interrupts == s_interrupts)
+	{
+		due = SIM_nextDue();
+		if(SIM_FOREVER == due)
+		{
+			SIM_log("sleeping with no interrupt source left");
+			SIM_exit(EXIT_FAILURE);
+		}
+		SIM_advance(FALSE,due);
+	}
+	s_inCore--;
+}
+
+void SIM_poll(void)
+{
+	SIM_TimeType now = SIM_now();
+	SIM_EventType * next;
+	uint8 event;
+	uint8 sreg;
+
+	/*A handler calling a host driver must not start a nested dispatch*/
+	if(s_dispatching)
+	{
+		return;
+	}
+	s_dispatching = TRUE;
+	s_inCore++;
+	s_polls++;
+
+	/*Run the due events in time order , a late process catches up
+	 * every missed period one by one like a stalled CPU would*/
+	for(;;)
+	{
+		next = NULL_PTR;
+		for(event = 0 ; event < s_eventsCount ; event++)
+		{
+			if(s_events[event].armed && s_events[event].due <= now &&
+					(SIM_MODEL_EVENT == s_events[event].kind || BIT_IS_SET(SREG,7)) &&
+					(NULL_PTR == next || s_events[event].due < next->due))
+			{
+				next = &s_events[event];
+			}
+		}
+		if(NULL_PTR == next)
+		{
+			break;
+		}
+
+		if(0 == next->period)
+		{
+			next->armed = FALSE;
+		}
+		else
+		{
+			next->due += next->period;
+		}
+
+		if(SIM_INTERRUPT_EVENT == next->kind)
+		{
+			sreg = SREG;
+			CLEAR_BIT(SREG,7);
+			s_interrupts++;
+			next->handler();
+			SREG = sreg;
+		}
+		else
+		{
+			next->handler();
+		}
+	}
+	s_inCore--;
+	s_dispatching = FALSE;
+}
+
+SIM_EventIdType SIM_addEvent(void (*a_handler)(void) , SIM_EventKind a_kind)
+{
+	if(s_eventsCount >= SIM_MAX_EVENTS)
+	{
+		SIM_log("out of simulation events");
+		SIM_exit(EXIT_FAILURE);
+	}
+	s_events[s_eventsCount].handler = a_handler;
+	s_events[s_eventsCount].kind = a_kind;
+	s_events[s_eventsCount].armed = FALSE;
+	return s_eventsCount++;
+}
+
+void SIM_startEvent(SIM_EventIdType a_id , SIM_TimeType a_delay , SIM_TimeType a_period)
+{
+	if(a_id < s_eventsCount)
+	{
+		s_inCore++;
+		s_events[a_id].due = SIM_now() + a_delay;
+		s_events[a_id].period = a_period;
+		s_events[a_id].armed = TRUE;
+		s_inCore--;
+	}
+}
+
+void SIM_stopEvent(SIM_EventIdType a_id)
+{
+	if(a_id < s_eventsCount)
+	{
+		s_events[a_id].armed = FALSE;
+	}
+}
+
+boolean SIM_raiseInterrupt(void (*a_vector)(void))
+{
+	uint8 sreg = SREG;
+
+	if(BIT_IS_CLEAR(sreg,7))
+	{
+		return FALSE;
+	}
+	CLEAR_BIT(SREG,7);
+	s_interrupts++;
+	a_vector();
+	SREG = sreg;
+	return TRUE;
+}
+
+void SIM_addPortHooks(uint8 a_port , void (*a_onRead)(uint8) , void (*a_onWrite)(uint8))
+{
+	if(s_portHooksCount < SIM_MAX_PORT_HOOKS)
+	{
+		s_portHooks[s_portHooksCount].port = a_port;
+		s_portHooks[s_portHooksCount].onRead = a_onRead;
+		s_portHooks[s_portHooksCount].onWrite = a_onWrite;
+		s_portHooksCount++;
+	}
+}
+
+void SIM_drivePin(uint8 a_port , uint8 a_pin , uint8 a_level)
+{
+	SET_BIT(s_driveMask[a_port],a_pin);
+	if(LOGIC_HIGH == a_level)
+	{
+		SET_BIT(s_driveLevel[a_port],a_pin);
+	}
+	else
+	{
+		CLEAR_BIT(s_driveLevel[a_port],a_pin);
+	}
+}
+
+void SIM_releasePin(uint8 a_port , uint8 a_pin)
+{
+	CLEAR_BIT(s_driveMask[a_port],a_pin);
+}
+
+uint8 SIM_readPort(uint8 a_port)
+{
+	uint8 hook;
+	uint8 ddr;
+	uint8 port;
+
+	s_inCore++;
+	SIM_poll();
+	for(hook = 0 ; hook < s_portHooksCount ; hook++)
+	{
+		if(s_portHooks[hook].port == a_port && NULL_PTR != s_portHooks[hook].onRead)
+		{
+			s_portHooks[hook].onRead(a_port);
+		}
+	}
+
+	/*Outputs read their latch , driven inputs the outside level &
+	 * floating inputs their pull-up (PORTx bit) */
+	ddr = SIM_io[SIM_DDR_ADDRESS(a_port)];
+	port = SIM_io[SIM_PORT_ADDRESS(a_port)];
+	SIM_io[SIM_PIN_ADDRESS(a_port)] = (ddr & port) |
+			(~ddr & s_driveMask[a_port] & s_driveLevel[a_port]) |
+			(~ddr & ~s_driveMask[a_port] & port);
+	s_inCore--;
+	return SIM_io[SIM_PIN_ADDRESS(a_port)];
+}
+
+uint8 SIM_getPortOutput(uint8 a_port)
+{
+	return SIM_io[SIM_PORT_ADDRESS(a_port)];
+}
+
+uint8 SIM_getPortDirection(uint8 a_port)
+{
+	return SIM_io[SIM_DDR_ADDRESS(a_port)];
+}
+
+void SIM_writePortOutput(uint8 a_port , uint8 a_value)
+{
+	uint8 hook;
+
+	s_inCore++;
+	SIM_io[SIM_PORT_ADDRESS(a_port)] = a_value;
+	for(hook = 0 ; hook < s_portHooksCount ; hook++)
+	{
+		if(s_portHooks[hook].port == a_port && NULL_PTR != s_portHooks[hook].onWrite)
+		{
+			s_portHooks[hook].onWrite(a_port);
+		}
+	}
+	s_inCore--;
+	SIM_poll();
+}
+
+void SIM_writePortDirection(uint8 a_port , uint8 a_value)
+{
+	uint8 hook;
+
+	s_inCore++;
+	SIM_io[SIM_DDR_ADDRESS(a_port)] = a_value;
+	for(hook = 0 ; hook < s_portHooksCount ; hook++)
+	{
+		if(s_portHooks[hook].port == a_port && NULL_PTR != s_portHooks[hook].onWrite)
+		{
+			s_portHooks[hook].onWrite(a_port);
+		}
+	}
+	s_inCore--;
+	SIM_poll();
+}
+
+void SIM_twiAttach(const SIM_TwiDeviceType * a_device)
+{
+	if(s_twiDevicesCount < SIM_MAX_TWI_DEVICES)
+	{
+		s_twiDevices[s_twiDevicesCount++] = a_device;
+	}
+}
+
+const SIM_TwiDeviceType * SIM_twiSelect(uint8 a_address , boolean a_read)
+{
+	uint8 device;
+
+	for(device = 0 ; device < s_twiDevicesCount ; device++)
+	{
+		if(s_twiDevices[device]->select(a_address,a_read))
+		{
+			return s_twiDevices[device];
+		}
+	}
+	return NULL_PTR;
+}
+
+void SIM_setPwm(uint8 a_channel , uint8 a_duty , uint32 a_frequency)
+{
+	if(a_channel < 2)
+	{
+		s_pwmDuty[a_channel] = a_duty;
+		s_pwmFrequency[a_channel] = a_frequency;
+	}
+}
+
+uint8 SIM_getPwmDuty(uint8 a_channel)
+{
+	/*No output without a running timer*/
+	return (a_channel < 2 && 0 != s_pwmFrequency[a_channel]) ? s_pwmDuty[a_channel] : 0;
+}
+
+void SIM_linkOpen(int a_fd , SIM_TimeType a_frameTime)
+{
+	s_linkFd = a_fd;
+	s_frameTime = a_frameTime;
+}
+
+void SIM_linkSend(uint8 a_data , SIM_TimeType a_arrival)
+{
+	s_inCore++;
+	SIM_linkWrite(SIM_LINK_DATA,a_data,a_arrival);
+	s_txCount++;
+
+	/*The next byte of this ECU arrives after this one*/
+	if(a_arrival > s_sentBound)
+	{
+		s_sentBound = a_arrival;
+	}
+	/*The peer may answer one frame after reading it*/
+	s_peerIdle = FALSE;
+	if(a_arrival + s_frameTime > s_peerBound)
+	{
+		s_peerBound = a_arrival + s_frameTime;
+	}
+	s_inCore--;
+}
+
+boolean SIM_linkReceive(uint8 * a_data)
+{
+	boolean received = FALSE;
+
+	s_inCore++;
+	if(s_rxHead == s_rxTail && SIM_linkMayHaveInput())
+	{
+		SIM_linkPump();
+	}
+	if(s_rxHead != s_rxTail && (FALSE == s_virtual || s_rxQueue[s_rxTail].arrival <= s_clock))
+	{
+		*a_data = s_rxQueue[s_rxTail].data;
+		s_rxTail = (s_rxTail + 1) % SIM_LINK_QUEUE_SIZE;
+		received = TRUE;
+	}
+	else if(s_linkClosed && s_rxHead == s_rxTail)
+	{
+		SIM_exit(EXIT_SUCCESS);
+	}
+	s_inCore--;
+	return received;
+}
+
+boolean SIM_linkWait(SIM_TimeType a_deadline)
+{
+	boolean ready;
+
+	s_idle = (SIM_FOREVER == a_deadline) ? TRUE : FALSE;
+	ready = SIM_advance(TRUE,a_deadline);
+	s_idle = FALSE;
+	return ready;
+}
+
+void SIM_atExit(void (*a_handler)(void))
+{
+	if(s_exitHandlersCount < sizeof(s_exitHandlers) / sizeof(s_exitHandlers[0]))
+	{
+		s_exitHandlers[s_exitHandlersCount++] = a_handler;
+	}
+}
+
+void SIM_exit(int a_status)
+{
+	exit(a_status);
+}
+
+void SIM_log(const char * a_format , ...)
+{
+	va_list arguments;
+
+	/*stdio isn't reentrant , no interrupt tick in the middle of a line*/
+	s_inCore++;
+	printf("[%10.3f] %-7s ",SIM_SECONDS(SIM_now()),s_name);
+	va_start(arguments,a_format);
+	vprintf(a_format,arguments);
+	va_end(arguments);
+	putchar('\n');
+	s_inCore--;
+}
+
+/*avr-libc extension used by the LCD driver*/
+char * itoa(int a_value , char * a_string , int a_radix)
+{
+	char digits[sizeof(int) * 8 + 1];
+	unsigned int magnitude = (a_value < 0 && 10 == a_radix) ? -(unsigned int)a_value : (unsigned int)a_value;
+	uint8 count = 0;
+	uint8 index = 0;
+
+	do
+	{
+		digits[count++] = "0123456789abcdefghijklmnopqrstuvwxyz"[magnitude % a_radix];
+		magnitude /= a_radix;
+	}while(magnitude > 0);
+
+	if(a_value < 0 && 10 == a_radix)
+	{
+		a_string[index++] = '-';
+	}
+	while(count > 0)
+	{
+		a_string[index++] = digits[--count];
+	}
+	a_string[index] = '\0';
+	return a_string;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Nanoseconds of wall clock since SIM_init*/
+static uint64 SIM_wallClock(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC,&now);
+	return (uint64)(now.tv_sec - s_start.tv_sec) * 1000000000ULL + now.tv_nsec - s_start.tv_nsec;
+}
+
+/* Description :
+ * Move the clock to a_deadline running the due events on the way , with
+ * a_input it stops as soon as a byte of the other ECU has arrived
+ * Returns TRUE if a byte (or the end of the line) is waiting*/
+static boolean SIM_advance(boolean a_input , SIM_TimeType a_deadline)
+{
+	SIM_TimeType due;
+	boolean ready;
+
+	s_inCore++;
+	for(;;)
+	{
+		if(a_input && SIM_linkMayHaveInput())
+		{
+			SIM_linkPump();
+		}
+		SIM_poll();
+		if(a_input && SIM_linkReady())
+		{
+			ready = TRUE;
+			break;
+		}
+		if(SIM_now() >= a_deadline)
+		{
+			ready = FALSE;
+			break;
+		}
+		due = SIM_nextDue();
+		if(due > a_deadline)
+		{
+			due = a_deadline;
+		}
+		if(s_virtual)
+		{
+			SIM_jump(a_input,due);
+		}
+		else
+		{
+			SIM_sleep(a_input,due);
+		}
+	}
+	s_inCore--;
+	return ready;
+}
+
+/* Description :
+ * Give the CPU away until a_until (simulated) or until the line is readable*/
+static void SIM_sleep(boolean a_input , SIM_TimeType a_until)
+{
+	struct pollfd descriptor = {s_linkFd,POLLIN,0};
+	SIM_TimeType now = SIM_now();
+	struct timespec timeout;
+	uint64 wall;
+
+	if(a_until <= now)
+	{
+		return;
+	}
+	wall = (uint64)((double)(a_until - now) / s_speed);
+	if(wall > SIM_MAX_SLEEP_NS)
+	{
+		wall = SIM_MAX_SLEEP_NS;
+	}
+	timeout.tv_sec = wall / 1000000000ULL;
+	timeout.tv_nsec = wall % 1000000000ULL;
+	ppoll(&descriptor,a_input ? 1 : 0,&timeout,NULL_PTR);
+}
+
+/* Description :
+ * One step of virtual time towards a_until , waiting for input the clock
+ * can't pass the time the peer has reached , block for its messages then*/
+static void SIM_jump(boolean a_input , SIM_TimeType a_until)
+{
+	struct pollfd descriptor = {s_linkFd,POLLIN,0};
+	SIM_TimeType bound = s_peerIdle ? SIM_FOREVER : s_peerBound;
+
+	if(a_input)
+	{
+		if(s_rxHead != s_rxTail && s_rxQueue[s_rxTail].arrival < a_until)
+		{
+			a_until = s_rxQueue[s_rxTail].arrival;
+		}
+		if(a_until > bound)
+		{
+			if(bound > s_clock)
+			{
+				SIM_setClock(bound);
+				return;
+			}
+			SIM_linkSync(a_until);
+			while(poll(&descriptor,1,-1) < 0 && EINTR == errno);
+			return;
+		}
+	}
+	if(SIM_FOREVER == a_until)
+	{
+		SIM_log("both ECUs wait for each other");
+		SIM_exit(EXIT_FAILURE);
+	}
+	SIM_setClock(a_until);
+}
+
+/* Description :
+ * Move the virtual clock forward , the run ends past SIM_TIME_LIMIT*/
+static void SIM_setClock(SIM_TimeType a_time)
+{
+	if(a_time > s_timeLimit)
+	{
+		s_clock = s_timeLimit;
+		SIM_log("simulated time limit reached");
+		SIM_exit(EXIT_FAILURE);
+	}
+	if(a_time > s_clock)
+	{
+		s_clock = a_time;
+	}
+}
+
+/* Description :
+ * Return the due time of the next event that can run*/
+static SIM_TimeType SIM_nextDue(void)
+{
+	SIM_TimeType due = (SIM_TimeType)-1;
+	uint8 event;
+
+	for(event = 0 ; event < s_eventsCount ; event++)
+	{
+		if(s_events[event].armed && s_events[event].due < due &&
+				(SIM_MODEL_EVENT == s_events[event].kind || BIT_IS_SET(SREG,7)))
+		{
+			due = s_events[event].due;
+		}
+	}
+	return due;
+}
+
+/* Description :
+ * Take the messages waiting on the line & answer the time requests*/
+static void SIM_linkPump(void)
+{
+	SIM_LinkMessageType message;
+	ssize_t size;
+	uint16 next;
+
+	while(FALSE == s_linkClosed)
+	{
+		next = (s_rxHead + 1) % SIM_LINK_QUEUE_SIZE;
+		if(next == s_rxTail)
+		{
+			break;
+		}
+		size = recv(s_linkFd,&message,sizeof(message),MSG_DONTWAIT);
+		if(0 == size)
+		{
+			s_linkClosed = TRUE;
+			break;
+		}
+		else if(size < 0)
+		{
+			if(EINTR == errno)
+			{
+				continue;
+			}
+			break;
+		}
+
+		switch(message.kind)
+		{
+		case SIM_LINK_DATA:
+			s_rxQueue[s_rxHead].data = message.data;
+			s_rxQueue[s_rxHead].arrival = message.time;
+			s_rxHead = next;
+			s_rxCount++;
+			/*The promise of an idle ECU ends with the byte it waited for*/
+			s_sentIdle = FALSE;
+			if(message.time > s_peerBound)
+			{
+				s_peerBound = message.time;
+			}
+			break;
+		case SIM_LINK_TIME:
+			/*An idle promise made before reading all the bytes sent to it is stale*/
+			if(message.idle)
+			{
+				s_peerIdle = (message.count == s_txCount) ? TRUE : s_peerIdle;
+			}
+			else
+			{
+				s_peerIdle = FALSE;
+			}
+			if(message.time > s_peerBound)
+			{
+				s_peerBound = message.time;
+			}
+			break;
+		case SIM_LINK_REQUEST:
+			if(message.time > s_peerWants)
+			{
+				s_peerWants = message.time;
+			}
+			break;
+		}
+	}
+
+	/*Answer a waiting peer as soon as this ECU is in the time it wants*/
+	if(s_virtual && FALSE == s_sentIdle && s_peerWants > s_sentBound &&
+			((s_idle && s_rxHead == s_rxTail) || s_clock + s_frameTime >= s_peerWants))
+	{
+		SIM_linkSync(0);
+	}
+}
+
+/* Description :
+ * Return TRUE if a byte has arrived by now or the other ECU has gone*/
+static boolean SIM_linkReady(void)
+{
+	if(s_rxHead != s_rxTail)
+	{
+		return (FALSE == s_virtual || s_rxQueue[s_rxTail].arrival <= s_clock) ? TRUE : FALSE;
+	}
+	return s_linkClosed;
+}
+
+/* Description :
+ * Return FALSE when the line can't hold anything for now : in virtual time
+ * nothing arrives before the bound of the peer & an idle peer sends nothing
+ * (saves one system call per wait of the idle main loop)*/
+static boolean SIM_linkMayHaveInput(void)
+{
+	return (FALSE == s_virtual || (FALSE == s_peerIdle && s_clock >= s_peerBound)) ? TRUE : FALSE;
+}
+
+/* Description :
+ * Tell the peer how far this ECU got & ask it for a_wanted (0 = no request)*/
+static void SIM_linkSync(SIM_TimeType a_wanted)
+{
+	SIM_TimeType bound = s_clock + s_frameTime;
+	/*Bytes still queued will be answered , no idle promise before they are read*/
+	boolean idle = (s_idle && s_rxHead == s_rxTail) ? TRUE : FALSE;
+
+	if(idle ? (FALSE == s_sentIdle) : (bound > s_sentBound))
+	{
+		SIM_linkWrite(SIM_LINK_TIME,idle,bound);
+		s_sentIdle = idle;
+		if(bound > s_sentBound)
+		{
+			s_sentBound = bound;
+		}
+	}
+	if(0 != a_wanted)
+	{
+		SIM_linkWrite(SIM_LINK_REQUEST,0,a_wanted);
+	}
+}
+
+static void SIM_linkWrite(uint8 a_kind , uint8 a_data , SIM_TimeType a_time)
+{
+	SIM_LinkMessageType message;
+
+	memset(&message,0,sizeof(message));
+	message.kind = a_kind;
+	message.time = a_time;
+	if(SIM_LINK_DATA == a_kind)
+	{
+		message.data = a_data;
+	}
+	else
+	{
+		message.idle = a_data;
+		message.count = s_rxCount;
+		s_syncMessages++;
+	}
+	while(send(s_linkFd,&message,sizeof(message),MSG_NOSIGNAL) < 0)
+	{
+		if(EINTR != errno)
+		{
+			/*The other ECU has gone*/
+			SIM_exit(EXIT_SUCCESS);
+		}
+	}
+}
+
+/* Description :
+ * Wall clock signal , runs the due events when it interrupts the firmware
+ * itself (an AVR takes its interrupts between any two instructions)
+ * In virtual time firmware spinning with no host driver call in the
+ * last tick gets the clock moved to the next event*/
+static void SIM_interruptTick(int a_signal)
+{
+	static uint32 lastPolls = 0;
+	SIM_TimeType due;
+
+	(void)a_signal;
+	if(0 == s_inCore)
+	{
+		if(s_virtual && lastPolls == s_polls)
+		{
+			due = SIM_nextDue();
+			if(SIM_FOREVER != due)
+			{
+				SIM_setClock(due);
+			}
+		}
+		SIM_poll();
+	}
+	lastPolls = s_polls;
+}
+
+/* Description :
+ * Run the exit call backs & print how fast the simulation ran*/
+static void SIM_report(void)
+{
+	SIM_TimeType simulated = SIM_now();
+	uint64 wall = SIM_wallClock();
+	struct itimerval stop = {{0,0},{0,0}};
+
+	setitimer(ITIMER_REAL,&stop,NULL_PTR);
+	s_inCore++;
+	while(s_exitHandlersCount > 0)
+	{
+		s_exitHandlers[--s_exitHandlersCount]();
+	}
+	fprintf(stderr,"%s: %.3f s simulated in %.3f s wall clock (x%.1f) , %lu interrupts",
+			s_name,SIM_SECONDS(simulated),SIM_SECONDS(wall),
+			(0 != wall) ? (double)simulated / (double)wall : 0.0,(unsigned long)s_interrupts);
+	if(s_virtual)
+	{
+		fprintf(stderr," , %lu sync messages",(unsigned long)s_syncMessages);
+	}
+	fputc('\n',stderr);
+}
@@ -0,0 +1,214 @@
+/******************************************************************************
+ *
+ * Module: Simulation Core
+ *
+ * File Name: sim.h
+ *
+ * Description: Header file for the host simulation core
+ * 				(simulated time , interrupt dispatch , virtual ports , TWI bus
+ * 				& the serial line between the ECUs)
+ *
+ * 				Two clocks :
+ * 				SIM_SPEED=<x>	 wall clock scaled by x (default 1)
+ * 				SIM_SPEED=max	 virtual time , the clock jumps to the next
+ * 								 event whenever the firmware waits or sleeps
+ * 				SIM_TIME_LIMIT=<s> ends a run that goes past s simulated seconds
+ *
+ * 				The host drivers of the hal directory & the board models
+ * 				are the only users , the application code never includes it.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef SIM_H_
+#define SIM_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*Simulated time unit is the nanosecond*/
+#define SIM_US(us)				((SIM_TimeType)(us) * 1000ULL)
+#define SIM_MS(ms)				((SIM_TimeType)(ms) * 1000000ULL)
+#define SIM_SECONDS(time)		((double)(time) / 1e9)
+
+#define SIM_MAX_EVENTS			8
+#define SIM_MAX_PORT_HOOKS		4
+#define SIM_MAX_TWI_DEVICES		4
+
+#define SIM_INVALID_EVENT		0xFF
+
+#define SIM_FOREVER				((SIM_TimeType)-1)
+
+/*Bytes received from the other ECU & not read yet*/
+#define SIM_LINK_QUEUE_SIZE		256
+
+/*Time the idle main loop gives away when it polls an empty receiver*/
+#define SIM_IDLE_QUANTUM		SIM_MS(1)
+
+/*Wall clock period of the signal that delivers the interrupts
+ * while the firmware spins without calling a host driver*/
+#define SIM_INTERRUPT_TICK_US	1000
+
+/*Longest wall clock sleep , keeps the process responsive to its peer*/
+#define SIM_MAX_SLEEP_NS		50000000ULL
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef uint64 SIM_TimeType;
+
+typedef uint8 SIM_EventIdType;
+
+typedef enum
+{
+	SIM_MODEL_EVENT , SIM_INTERRUPT_EVENT
+}SIM_EventKind;
+
+/*A device on the virtual TWI bus , all call backs run at bus speed*/
+typedef struct
+{
+	/*Return TRUE to acknowledge the 7-bit address*/
+	boolean (*select)(uint8 a_address , boolean a_read);
+	/*Return TRUE to acknowledge the data byte*/
+	boolean (*write)(uint8 a_data);
+	/*a_ack = FALSE for the last byte of a read*/
+	uint8 (*read)(boolean a_ack);
+	void (*stop)(void);
+}SIM_TwiDeviceType;
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Start the simulated clock (SIM_SPEED & SIM_TIME_LIMIT environment
+ * variables) , called by the board file before main*/
+void SIM_init(const char * a_name);
+
+/* Description :
+ * Return the simulated time since SIM_init*/
+SIM_TimeType SIM_now(void);
+
+/* Description :
+ * Busy wait of the firmware (_delay_ms / _delay_us) ,
+ * the due events & interrupts run meanwhile*/
+void SIM_delay(SIM_TimeType a_time);
+
+/* Description :
+ * Run the events that are due , called by every host driver access
+ * (the points where a real CPU would have taken the pending interrupts)*/
+void SIM_poll(void);
+
+/* Description :
+ * Sleep instruction (sleep_cpu) , runs the events until an interrupt is taken
+ * Does nothing if the SE bit of MCUCR is clear*/
+void SIM_sleepCpu(void);
+
+/* Description :
+ * Register a model event or a simulated interrupt source
+ * Interrupt events only run while the global interrupt flag is set
+ * and run with the flag cleared (like an AVR ISR)*/
+SIM_EventIdType SIM_addEvent(void (*a_handler)(void) , SIM_EventKind a_kind);
+
+/* Description :
+ * (Re)arm an event a_delay from now , repeated every a_period if not zero*/
+void SIM_startEvent(SIM_EventIdType a_id , SIM_TimeType a_delay , SIM_TimeType a_period);
+
+/* Description :
+ * Disarm an event*/
+void SIM_stopEvent(SIM_EventIdType a_id);
+
+/* Description :
+ * Call an interrupt vector now if global interrupts are enabled
+ * Returns FALSE if the interrupt is masked*/
+boolean SIM_raiseInterrupt(void (*a_vector)(void));
+
+/* Description :
+ * Register the call backs of a model wired to a port , a_onRead runs before
+ * the firmware samples the port & a_onWrite after it changes PORTx or DDRx
+ * (either may be NULL_PTR)*/
+void SIM_addPortHooks(uint8 a_port , void (*a_onRead)(uint8) , void (*a_onWrite)(uint8));
+
+/* Description :
+ * Drive an input pin from outside (a_level = LOGIC_HIGH / LOGIC_LOW)*/
+void SIM_drivePin(uint8 a_port , uint8 a_pin , uint8 a_level);
+
+/* Description :
+ * Stop driving a pin , it reads its pull-up again*/
+void SIM_releasePin(uint8 a_port , uint8 a_pin);
+
+/* Description :
+ * Return the level the firmware reads from a port (PINx) after running the
+ * read hooks , used by the host GPIO driver*/
+uint8 SIM_readPort(uint8 a_port);
+
+/* Description :
+ * Return the output latch (PORTx) & direction (DDRx) of a port*/
+uint8 SIM_getPortOutput(uint8 a_port);
+uint8 SIM_getPortDirection(uint8 a_port);
+
+/* Description :
+ * Update PORTx / DDRx & run the write hooks , used by the host GPIO driver*/
+void SIM_writePortOutput(uint8 a_port , uint8 a_value);
+void SIM_writePortDirection(uint8 a_port , uint8 a_value);
+
+/* Description :
+ * Attach a device to the virtual TWI bus*/
+void SIM_twiAttach(const SIM_TwiDeviceType * a_device);
+
+/* Description :
+ * Bus access of the host TWI driver , returns the device that acknowledged
+ * the address or NULL_PTR if none did*/
+const SIM_TwiDeviceType * SIM_twiSelect(uint8 a_address , boolean a_read);
+
+/* Description :
+ * Duty (0 .. 255) & frequency of a PWM output , written by the host PWM driver*/
+void SIM_setPwm(uint8 a_channel , uint8 a_duty , uint32 a_frequency);
+uint8 SIM_getPwmDuty(uint8 a_channel);
+
+/* Description :
+ * Use a_fd as the serial line to the other ECU , a_frameTime is the
+ * duration of one frame (the earliest a reply can arrive)*/
+void SIM_linkOpen(int a_fd , SIM_TimeType a_frameTime);
+
+/* Description :
+ * Send one byte that reaches the other ECU at a_arrival (simulated time)
+ * Only the main loop sends , never an interrupt handler : an ECU waiting
+ * for a byte without a deadline tells its peer it will send nothing first*/
+void SIM_linkSend(uint8 a_data , SIM_TimeType a_arrival);
+
+/* Description :
+ * Take a byte that has arrived by now , returns FALSE if there is none
+ * Ends the simulation of this ECU when the other one has gone*/
+boolean SIM_linkReceive(uint8 * a_data);
+
+/* Description :
+ * Wait until a byte has arrived or a_deadline (SIM_FOREVER for none) is
+ * reached running the due events meanwhile
+ * Returns TRUE if a byte (or the end of the line) is waiting*/
+boolean SIM_linkWait(SIM_TimeType a_deadline);
+
+/* Description :
+ * Register a call back that runs once when the simulation ends*/
+void SIM_atExit(void (*a_handler)(void));
+
+/* Description :
+ * End the simulation of this ECU printing the statistics*/
+void SIM_exit(int a_status);
+
+/* Description :
+ * Print one line prefixed by the simulated time & the ECU name*/
+void SIM_log(const char * a_format , ...) __attribute__((format(printf,1,2)));
+
+#endif /* SIM_H_ */
@@ -0,0 +1,430 @@
+/******************************************************************************
+ *
+ * Module: simavr Harness
+ *
+ * File Name: avr_harness.c
+ *
+ * Description: Cycle accurate run of the two ATmega32 images on simavr
+ *
+ * 				avr_harness [--control elf] [--hmi elf] [--eeprom file]
+ * 							[--limit seconds] scenario...
+ * 				avr_harness --bench [--control elf] [--hmi elf] [--eeprom file]
+ *
+ * 				Both ELFs run on their own core at F_CPU , their USARTs
+ * 				are crossed , the Control core has the 24C16 & the door
+ * 				plant , the HMI core the keypad & the LCD. The scenarios
+ * 				(keypad scripts of the host simulation) run one after the
+ * 				other on the same cores , each one ends when its script is
+ * 				over & the HMI scans the keypad again.
+ *
+ * 				Report (stdout , one key=value record per line) :
+ * 				scenario ... ecu ... cycles , busy cycles (not sleeping) &
+ * 				CPU busy % , then per interrupt vector : count , latency
+ * 				(cycles from the flag raised to the vector) & duration
+ * 				(cycles from the vector to RETI) .
+ *
+ * 				--bench runs benchmark builds (DRIVER_BENCH) , the cores
+ * 				aren't linked & the report lines of both are printed.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libgen.h>
+#include "sim_avr.h"
+#include "sim_elf.h"
+#include "sim_irq.h"
+#include "sim_time.h"
+#include "sim_interrupts.h"
+#include "avr_parts.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define HARNESS_MCU				"atmega32"
+#define HARNESS_F_CPU			8000000UL
+
+#define HARNESS_DEFAULT_CONTROL	"../Final_Project_Control_ECU/Debug/Final_Project_Control_ECU.elf"
+#define HARNESS_DEFAULT_HMI		"../Final_Project_HMI_ECU/Debug/Final_Project_HMI_ECU.elf"
+#define HARNESS_DEFAULT_LIMIT	600		/*Simulated seconds per scenario*/
+
+/*Largest lead of one core over the other (8 us at 8 MHz) , far below
+ * the 1 ms frame of the serial line*/
+#define HARNESS_SYNC_QUANTUM	64
+
+/*ATmega32 vectors 1 .. 20 (0 is the reset)*/
+#define HARNESS_VECTORS			21
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef struct HARNESS_Core HARNESS_CoreType;
+
+typedef struct
+{
+	HARNESS_CoreType * core;
+	uint8 vector;
+	boolean pending;
+	avr_cycle_count_t raisedAt;
+	avr_cycle_count_t enteredAt;
+	uint32 count;
+	avr_cycle_count_t latencyMin;
+	avr_cycle_count_t latencyMax;
+	avr_cycle_count_t latencySum;
+	avr_cycle_count_t durationMax;
+}HARNESS_VectorStatsType;
+
+struct HARNESS_Core
+{
+	const char * name;
+	avr_t * avr;
+	elf_firmware_t firmware;
+	avr_cycle_count_t startCycle;	/*Cycle count at the start of the scenario*/
+	avr_cycle_count_t sleepCycles;
+	HARNESS_VectorStatsType vectors[HARNESS_VECTORS];
+};
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static const char * s_vectorNames[HARNESS_VECTORS] =
+{
+	"RESET" , "INT0" , "INT1" , "INT2" , "TIMER2_COMP" , "TIMER2_OVF" ,
+	"TIMER1_CAPT" , "TIMER1_COMPA" , "TIMER1_COMPB" , "TIMER1_OVF" ,
+	"TIMER0_COMP" , "TIMER0_OVF" , "SPI_STC" , "USART_RXC" , "USART_UDRE" ,
+	"USART_TXC" , "ADC" , "EE_RDY" , "ANA_COMP" , "TWI" , "SPM_RDY"
+};
+
+static HARNESS_CoreType s_control = {"Control"};
+static HARNESS_CoreType s_hmi = {"HMI"};
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static boolean HARNESS_loadCore(HARNESS_CoreType * a_core , const char * a_elf);
+static void HARNESS_interruptPending(avr_irq_t * a_irq , uint32_t a_value , void * a_param);
+static void HARNESS_interruptRunning(avr_irq_t * a_irq , uint32_t a_value , void * a_param);
+static boolean HARNESS_runScenario(const char * a_file , double a_limit);
+static boolean HARNESS_runUntil(boolean (*a_done)(void) , double a_limit , const char * a_name);
+static boolean HARNESS_step(HARNESS_CoreType * a_core , avr_cycle_count_t a_until);
+static void HARNESS_resetStats(HARNESS_CoreType * a_core);
+static void HARNESS_report(const char * a_scenario , const HARNESS_CoreType * a_core);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+int main(int argc , char * argv[])
+{
+	const char * controlElf = HARNESS_DEFAULT_CONTROL;
+	const char * hmiElf = HARNESS_DEFAULT_HMI;
+	const char * eeprom = NULL_PTR;
+	double limit = HARNESS_DEFAULT_LIMIT;
+	boolean bench = FALSE;
+	int argument;
+
+	for(argument = 1 ; argument < argc && '-' == argv[argument][0] ; argument++)
+	{
+		if(0 == strcmp(argv[argument],"--bench"))
+		{
+			bench = TRUE;
+			continue;
+		}
+		if(argument + 1 >= argc)
+		{
+			break;
+		}
+		if(0 == strcmp(argv[argument],"--control"))
+		{
+			controlElf = argv[++argument];
+		}
+		else if(0 == strcmp(argv[argument],"--hmi"))
+		{
+			hmiElf = argv[++argument];
+		}
+		else if(0 == strcmp(argv[argument],"--eeprom"))
+		{
+			eeprom = argv[++argument];
+		}
+		else if(0 == strcmp(argv[argument],"--limit"))
+		{
+			limit = atof(argv[++argument]);
+		}
+		else
+		{
+			break;
+		}
+	}
+	if(argument >= argc && FALSE == bench)
+	{
+		fprintf(stderr,"usage: %s [--bench] [--control elf] [--hmi elf] [--eeprom file] [--limit seconds] scenario...\n",argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	if(FALSE == HARNESS_loadCore(&s_control,controlElf) || FALSE == HARNESS_loadCore(&s_hmi,hmiElf))
+	{
+		return EXIT_FAILURE;
+	}
+
+	if(bench)
+	{
+		HARNESS_BENCH_attach(s_control.avr);
+		HARNESS_BENCH_attach(s_hmi.avr);
+	}
+	else
+	{
+		HARNESS_linkUarts(s_control.avr,s_hmi.avr);
+	}
+	HARNESS_EEPROM_attach(s_control.avr,eeprom);
+	HARNESS_DOOR_attach(s_control.avr);
+	HARNESS_KEYPAD_attach(s_hmi.avr);
+	HARNESS_LCD_attach(s_hmi.avr);
+
+	if(bench)
+	{
+		return HARNESS_runUntil(&HARNESS_BENCH_done,limit,"bench") ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	for( ; argument < argc ; argument++)
+	{
+		if(FALSE == HARNESS_runScenario(argv[argument],limit))
+		{
+			return EXIT_FAILURE;
+		}
+	}
+	return EXIT_SUCCESS;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * Make an ATmega32 core at F_CPU , load the ELF & hook the interrupt vectors*/
+static boolean HARNESS_loadCore(HARNESS_CoreType * a_core , const char * a_elf)
+{
+	uint8 vector;
+
+	if(elf_read_firmware(a_elf,&a_core->firmware) != 0)
+	{
+		fprintf(stderr,"%s: cannot read %s\n",a_core->name,a_elf);
+		return FALSE;
+	}
+	a_core->avr = avr_make_mcu_by_name(HARNESS_MCU);
+	if(NULL_PTR == a_core->avr)
+	{
+		fprintf(stderr,"simavr has no %s core\n",HARNESS_MCU);
+		return FALSE;
+	}
+	avr_init(a_core->avr);
+	avr_load_firmware(a_core->avr,&a_core->firmware);
+	/*The Eclipse build has no .mmcu section , the clock comes from the project*/
+	a_core->avr->frequency = HARNESS_F_CPU;
+	HARNESS_setName(a_core->avr,a_core->name);
+
+	for(vector = 1 ; vector < HARNESS_VECTORS ; vector++)
+	{
+		a_core->vectors[vector].core = a_core;
+		a_core->vectors[vector].vector = vector;
+		avr_irq_register_notify(avr_get_interrupt_irq(a_core->avr,vector) + AVR_INT_IRQ_PENDING,
+				&HARNESS_interruptPending,&a_core->vectors[vector]);
+		avr_irq_register_notify(avr_get_interrupt_irq(a_core->avr,vector) + AVR_INT_IRQ_RUNNING,
+				&HARNESS_interruptRunning,&a_core->vectors[vector]);
+	}
+	return TRUE;
+}
+
+/* Description :
+ * Interrupt flag raised , the latency runs from here*/
+static void HARNESS_interruptPending(avr_irq_t * a_irq , uint32_t a_value , void * a_param)
+{
+	HARNESS_VectorStatsType * stats = (HARNESS_VectorStatsType *)a_param;
+
+	(void)a_irq;
+	if(a_value && FALSE == stats->pending)
+	{
+		stats->pending = TRUE;
+		stats->raisedAt = stats->core->avr->cycle;
+	}
+	else if(0 == a_value)
+	{
+		/*Flag cleared by software before the vector ran*/
+		stats->pending = FALSE;
+	}
+}
+
+/* Description :
+ * Vector taken (a_value = 1) or RETI (a_value = 0)*/
+static void HARNESS_interruptRunning(avr_irq_t * a_irq , uint32_t a_value , void * a_param)
+{
+	HARNESS_VectorStatsType * stats = (HARNESS_VectorStatsType *)a_param;
+	avr_cycle_count_t now = stats->core->avr->cycle;
+	avr_cycle_count_t latency;
+
+	(void)a_irq;
+	if(a_value)
+	{
+		latency = stats->pending ? now - stats->raisedAt : 0;
+		stats->pending = FALSE;
+		stats->enteredAt = now;
+		if(0 == stats->count || latency < stats->latencyMin)
+		{
+			stats->latencyMin = latency;
+		}
+		if(latency > stats->latencyMax)
+		{
+			stats->latencyMax = latency;
+		}
+		stats->latencySum += latency;
+		stats->count++;
+	}
+	else if(now - stats->enteredAt > stats->durationMax)
+	{
+		stats->durationMax = now - stats->enteredAt;
+	}
+}
+
+/* Description :
+ * Run the cores in lock step until the script of a_file is over
+ * Returns FALSE if a core stopped or the scenario went past a_limit seconds*/
+static boolean HARNESS_runScenario(const char * a_file , double a_limit)
+{
+	char name[256];
+	char * dot;
+
+	if(FALSE == HARNESS_KEYPAD_load(a_file))
+	{
+		fprintf(stderr,"cannot read %s\n",a_file);
+		return FALSE;
+	}
+	strncpy(name,a_file,sizeof(name) - 1);
+	name[sizeof(name) - 1] = '\0';
+	strncpy(name,basename(name),sizeof(name) - 1);
+	dot = strrchr(name,'.');
+	if(NULL_PTR != dot)
+	{
+		*dot = '\0';
+	}
+
+	HARNESS_resetStats(&s_control);
+	HARNESS_resetStats(&s_hmi);
+	if(FALSE == HARNESS_runUntil(&HARNESS_KEYPAD_done,a_limit,name))
+	{
+		return FALSE;
+	}
+
+	HARNESS_report(name,&s_control);
+	HARNESS_report(name,&s_hmi);
+	return TRUE;
+}
+
+/* Description :
+ * Run the cores in lock step until a_done returns TRUE
+ * Returns FALSE if a core stopped or a_limit seconds passed*/
+static boolean HARNESS_runUntil(boolean (*a_done)(void) , double a_limit , const char * a_name)
+{
+	avr_cycle_count_t limit = s_hmi.avr->cycle + avr_usec_to_cycles(s_hmi.avr,(uint32_t)(a_limit * 1e6));
+	HARNESS_CoreType * core;
+	HARNESS_CoreType * other;
+
+	while(FALSE == a_done())
+	{
+		if(s_hmi.avr->cycle > limit)
+		{
+			fprintf(stderr,"%s: not over after %.0f simulated seconds\n",a_name,a_limit);
+			return FALSE;
+		}
+		/*The core behind catches up & gets a quantum ahead*/
+		core = (s_control.avr->cycle <= s_hmi.avr->cycle) ? &s_control : &s_hmi;
+		other = (core == &s_control) ? &s_hmi : &s_control;
+		if(FALSE == HARNESS_step(core,other->avr->cycle + HARNESS_SYNC_QUANTUM))
+		{
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+/* Description :
+ * Run one core up to a_until cycles counting the cycles spent asleep*/
+static boolean HARNESS_step(HARNESS_CoreType * a_core , avr_cycle_count_t a_until)
+{
+	avr_cycle_count_t before;
+	int state;
+	boolean sleeping;
+
+	while(a_core->avr->cycle < a_until)
+	{
+		before = a_core->avr->cycle;
+		sleeping = (cpu_Sleeping == a_core->avr->state) ? TRUE : FALSE;
+		state = avr_run(a_core->avr);
+		if(sleeping)
+		{
+			a_core->sleepCycles += a_core->avr->cycle - before;
+		}
+		if(cpu_Done == state || cpu_Crashed == state)
+		{
+			HARNESS_log(a_core->avr,"core %s at PC 0x%04x",
+					(cpu_Done == state) ? "stopped (sleep with interrupts off)" : "crashed",
+					(unsigned)a_core->avr->pc);
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+static void HARNESS_resetStats(HARNESS_CoreType * a_core)
+{
+	uint8 vector;
+
+	a_core->startCycle = a_core->avr->cycle;
+	a_core->sleepCycles = 0;
+	for(vector = 1 ; vector < HARNESS_VECTORS ; vector++)
+	{
+		a_core->vectors[vector].count = 0;
+		a_core->vectors[vector].latencyMin = 0;
+		a_core->vectors[vector].latencyMax = 0;
+		a_core->vectors[vector].latencySum = 0;
+		a_core->vectors[vector].durationMax = 0;
+	}
+}
+
+static void HARNESS_report(const char * a_scenario , const HARNESS_CoreType * a_core)
+{
+	avr_cycle_count_t cycles = a_core->avr->cycle - a_core->startCycle;
+	avr_cycle_count_t busy = cycles - a_core->sleepCycles;
+	const HARNESS_VectorStatsType * stats;
+	uint8 vector;
+
+	printf("scenario=%s ecu=%s cycles=%llu seconds=%.6f busy_cycles=%llu busy_pct=%.2f\n",
+			a_scenario,a_core->name,(unsigned long long)cycles,
+			(double)avr_cycles_to_nsec(a_core->avr,cycles) / 1e9,(unsigned long long)busy,
+			(0 != cycles) ? 100.0 * (double)busy / (double)cycles : 0.0);
+
+	for(vector = 1 ; vector < HARNESS_VECTORS ; vector++)
+	{
+		stats = &a_core->vectors[vector];
+		if(0 == stats->count)
+		{
+			continue;
+		}
+		printf("scenario=%s ecu=%s vector=%s count=%lu latency_min=%llu latency_avg=%.1f "
+				"latency_max=%llu duration_max=%llu\n",
+				a_scenario,a_core->name,s_vectorNames[vector],(unsigned long)stats->count,
+				(unsigned long long)stats->latencyMin,(double)stats->latencySum / stats->count,
+				(unsigned long long)stats->latencyMax,(unsigned long long)stats->durationMax);
+	}
+}
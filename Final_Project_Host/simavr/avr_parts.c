@@ -0,0 +1,772 @@
+/******************************************************************************
+ *
+ * Module: simavr Harness
+ *
+ * File Name: avr_parts.c
+ *
+ * Description: Source file for the parts wired to the two simavr cores
+ *
+ * 				All parts follow the cores through simavr IRQs : pin & port
+ * 				register changes , USART / TWI messages & cycle timers ,
+ * 				so they run at the cycle the firmware touches them.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include "avr_ioport.h"
+#include "avr_uart.h"
+#include "avr_twi.h"
+#include "avr_adc.h"
+#include "sim_irq.h"
+#include "sim_time.h"
+#include "sim_cycle_timers.h"
+#include "common_macros.h"
+#include "gpio.h"
+#include "keypad.h"
+#include "LCD.h"
+#include "DCMotor.h"
+#include "BUZZER.h"
+#include "door_position.h"
+#include "avr_parts.h"
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+/*One direction of the serial line*/
+typedef struct
+{
+	avr_irq_t * input;		/*USART input of the receiving core*/
+	uint8 queue[HARNESS_LINK_QUEUE_SIZE];
+	uint16 head;
+	uint16 tail;
+	boolean xoff;			/*Receive FIFO of the core full*/
+}HARNESS_LinkType;
+
+/*Report of a benchmark build*/
+typedef struct
+{
+	avr_t * avr;
+	char line[HARNESS_BENCH_LINE_SIZE];
+	uint8 length;
+	boolean ended;
+}HARNESS_BenchType;
+
+typedef struct
+{
+	uint8 button;		/*0 .. 15 , HARNESS_NO_KEY for a wait*/
+	uint32 wait;		/*ms*/
+}HARNESS_KeyActionType;
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#define HARNESS_NO_KEY		0xFF
+#define HARNESS_MAX_NAMES	2
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static avr_t * s_names[HARNESS_MAX_NAMES];
+static const char * s_nameStrings[HARNESS_MAX_NAMES];
+
+static HARNESS_LinkType s_links[2];
+
+static HARNESS_BenchType s_benches[HARNESS_MAX_NAMES];
+static uint8 s_benchCount = 0;
+
+/*24C16*/
+static const char * s_irqNames[2] = {"twi.eeprom.in" , "twi.eeprom.out"};
+static avr_irq_t * s_eepromIrq;
+static uint8 s_eeprom[HARNESS_EEPROM_SIZE];
+static const char * s_eepromFile = NULL_PTR;
+static uint8 s_eepromSelected = 0;		/*8-bit address byte , 0 = not selected*/
+static uint16 s_eepromPointer = 0;
+static boolean s_eepromAddressPending = FALSE;
+static boolean s_eepromWritten = FALSE;
+
+/*Keypad*/
+static const char s_keys[16] =
+{
+	'7' , '8' , '9' , '%' ,
+	'4' , '5' , '6' , '*' ,
+	'1' , '2' , '3' , '-' ,
+	'E' , '0' , '=' , '+'
+};
+static avr_t * s_keypadAvr;
+static avr_irq_t * s_columnIrq[KEYPAD_NUM_COLS];
+static HARNESS_KeyActionType * s_actions = NULL_PTR;
+static uint32 s_actionsCount = 0;
+static uint32 s_nextAction = 0;
+static uint8 s_pressed = HARNESS_NO_KEY;
+static boolean s_seen = FALSE;
+static avr_cycle_count_t s_nextKeyAt = 0;
+static boolean s_scriptDone = FALSE;
+
+/*LCD*/
+static avr_t * s_lcdAvr;
+static char s_screen[HARNESS_LCD_ROWS][HARNESS_LCD_COLUMNS];
+static char s_printed[HARNESS_LCD_ROWS][HARNESS_LCD_COLUMNS];
+static uint8 s_lcdAddress = 0;
+static uint8 s_highNibble = 0;
+static boolean s_secondNibble = FALSE;
+
+/*Door plant*/
+static avr_t * s_doorAvr;
+static avr_irq_t * s_encoderIrq;
+static avr_irq_t * s_openLimitIrq;
+static avr_irq_t * s_closedLimitIrq;
+static avr_irq_t * s_currentIrq;
+static double s_position = 0.0;
+static double s_current = 0.0;
+static sint8 s_direction = 0;
+static uint8 s_buzzer = LOGIC_LOW;
+
+/*******************************************************************************
+ *                      Functions Prototypes(Private)                          *
+ *******************************************************************************/
+
+static void HARNESS_linkOutput(avr_irq_t * a_irq , uint32_t a_value , void * a_param);
+static void HARNESS_linkXon(avr_irq_t * a_irq , uint32_t a_value , void * a_param);
+static void HARNESS_linkXoff(avr_irq_t * a_irq , uint32_t a_value , void * a_param);
+static void HARNESS_linkDrain(HARNESS_LinkType * a_link);
+
+static void HARNESS_BENCH_output(avr_irq_t * a_irq , uint32_t a_value , void * a_param);
+
+static void HARNESS_EEPROM_message(avr_irq_t * a_irq , uint32_t a_value , void * a_param);
+static void HARNESS_EEPROM_save(void);
+
+static void HARNESS_KEYPAD_rowsChanged(avr_irq_t * a_irq , uint32_t a_value , void * a_param);
+static void HARNESS_KEYPAD_push(uint8 a_button , uint32 a_wait);
+
+static void HARNESS_LCD_enableChanged(avr_irq_t * a_irq , uint32_t a_value , void * a_param);
+static void HARNESS_LCD_execute(uint8 a_rs , uint8 a_byte);
+static avr_cycle_count_t HARNESS_LCD_print(avr_t * a_avr , avr_cycle_count_t a_when , void * a_param);
+
+static avr_cycle_count_t HARNESS_DOOR_update(avr_t * a_avr , avr_cycle_count_t a_when , void * a_param);
+static void HARNESS_DOOR_portWritten(avr_irq_t * a_irq , uint32_t a_value , void * a_param);
+
+/*******************************************************************************
+ *                             Functions Definitions                           *
+ *******************************************************************************/
+
+void HARNESS_setName(avr_t * a_avr , const char * a_name)
+{
+	uint8 slot;
+
+	for(slot = 0 ; slot < HARNESS_MAX_NAMES ; slot++)
+	{
+		if(NULL_PTR == s_names[slot] || a_avr == s_names[slot])
+		{
+			s_names[slot] = a_avr;
+			s_nameStrings[slot] = a_name;
+			return;
+		}
+	}
+}
+
+void HARNESS_log(avr_t * a_avr , const char * a_format , ...)
+{
+	va_list arguments;
+	const char * name = "?";
+	uint8 slot;
+
+	for(slot = 0 ; slot < HARNESS_MAX_NAMES ; slot++)
+	{
+		if(a_avr == s_names[slot])
+		{
+			name = s_nameStrings[slot];
+		}
+	}
+	printf("[%10.3f] %-7s ",(double)avr_cycles_to_nsec(a_avr,a_avr->cycle) / 1e9,name);
+	va_start(arguments,a_format);
+	vprintf(a_format,arguments);
+	va_end(arguments);
+	putchar('\n');
+}
+
+void HARNESS_linkUarts(avr_t * a_first , avr_t * a_second)
+{
+	avr_t * cores[2] = {a_first , a_second};
+	uint32_t flags = 0;
+	uint8 core;
+
+	for(core = 0 ; core < 2 ; core++)
+	{
+		/*No UART echo on the harness terminal*/
+		avr_ioctl(cores[core],AVR_IOCTL_UART_GET_FLAGS('0'),&flags);
+		flags &= ~AVR_UART_FLAG_STDIO;
+		avr_ioctl(cores[core],AVR_IOCTL_UART_SET_FLAGS('0'),&flags);
+
+		/*s_links[core] carries the bytes received by cores[core]*/
+		s_links[core].input = avr_io_getirq(cores[core],AVR_IOCTL_UART_GETIRQ('0'),UART_IRQ_INPUT);
+		avr_irq_register_notify(avr_io_getirq(cores[core],AVR_IOCTL_UART_GETIRQ('0'),UART_IRQ_OUT_XON),
+				&HARNESS_linkXon,&s_links[core]);
+		avr_irq_register_notify(avr_io_getirq(cores[core],AVR_IOCTL_UART_GETIRQ('0'),UART_IRQ_OUT_XOFF),
+				&HARNESS_linkXoff,&s_links[core]);
+		avr_irq_register_notify(avr_io_getirq(cores[core],AVR_IOCTL_UART_GETIRQ('0'),UART_IRQ_OUTPUT),
+				&HARNESS_linkOutput,&s_links[1 - core]);
+	}
+}
+
+void HARNESS_BENCH_attach(avr_t * a_avr)
+{
+	HARNESS_BenchType * bench;
+	uint32_t flags = 0;
+
+	if(s_benchCount >= HARNESS_MAX_NAMES)
+	{
+		return;
+	}
+	bench = &s_benches[s_benchCount++];
+	bench->avr = a_avr;
+	bench->length = 0;
+	bench->ended = FALSE;
+
+	avr_ioctl(a_avr,AVR_IOCTL_UART_GET_FLAGS('0'),&flags);
+	flags &= ~AVR_UART_FLAG_STDIO;
+	avr_ioctl(a_avr,AVR_IOCTL_UART_SET_FLAGS('0'),&flags);
+	avr_irq_register_notify(avr_io_getirq(a_avr,AVR_IOCTL_UART_GETIRQ('0'),UART_IRQ_OUTPUT),
+			&HARNESS_BENCH_output,bench);
+}
+
+boolean HARNESS_BENCH_done(void)
+{
+	uint8 bench;
+
+	for(bench = 0 ; bench < s_benchCount ; bench++)
+	{
+		if(FALSE == s_benches[bench].ended)
+		{
+			return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+void HARNESS_EEPROM_attach(avr_t * a_avr , const char * a_file)
+{
+	FILE * file;
+
+	memset(s_eeprom,0xFF,sizeof(s_eeprom));
+	s_eepromFile = a_file;
+	if(NULL_PTR != a_file && NULL_PTR != (file = fopen(a_file,"rb")))
+	{
+		if(fread(s_eeprom,1,sizeof(s_eeprom),file) != sizeof(s_eeprom))
+		{
+			memset(s_eeprom,0xFF,sizeof(s_eeprom));
+		}
+		fclose(file);
+	}
+
+	/*Same wiring as the i2c_eeprom part of the simavr examples*/
+	s_eepromIrq = avr_alloc_irq(&a_avr->irq_pool,0,2,s_irqNames);
+	avr_irq_register_notify(s_eepromIrq + TWI_IRQ_OUTPUT,&HARNESS_EEPROM_message,NULL_PTR);
+	avr_connect_irq(s_eepromIrq + TWI_IRQ_INPUT,avr_io_getirq(a_avr,AVR_IOCTL_TWI_GETIRQ(0),TWI_IRQ_INPUT));
+	avr_connect_irq(avr_io_getirq(a_avr,AVR_IOCTL_TWI_GETIRQ(0),TWI_IRQ_OUTPUT),s_eepromIrq + TWI_IRQ_OUTPUT);
+}
+
+void HARNESS_KEYPAD_attach(avr_t * a_avr)
+{
+	uint8 column;
+
+	s_keypadAvr = a_avr;
+	for(column = 0 ; column < KEYPAD_NUM_COLS ; column++)
+	{
+		/*External pull-ups on the columns*/
+		s_columnIrq[column] = avr_io_getirq(a_avr,AVR_IOCTL_IOPORT_GETIRQ('A' + KEYPAD_COL_PORT_ID),
+				KEYPAD_FIRST_COL_PIN_ID + column);
+		avr_raise_irq(s_columnIrq[column],LOGIC_HIGH);
+	}
+	avr_irq_register_notify(avr_io_getirq(a_avr,AVR_IOCTL_IOPORT_GETIRQ('A' + KEYPAD_ROW_PORT_ID),IOPORT_IRQ_REG_PORT),
+			&HARNESS_KEYPAD_rowsChanged,NULL_PTR);
+	avr_irq_register_notify(avr_io_getirq(a_avr,AVR_IOCTL_IOPORT_GETIRQ('A' + KEYPAD_ROW_PORT_ID),IOPORT_IRQ_DIRECTION_ALL),
+			&HARNESS_KEYPAD_rowsChanged,NULL_PTR);
+}
+
+boolean HARNESS_KEYPAD_load(const char * a_file)
+{
+	FILE * file = fopen(a_file,"r");
+	char line[256];
+	char * token;
+	char * key;
+	char * comment;
+	uint8 button;
+
+	if(NULL_PTR == file)
+	{
+		return FALSE;
+	}
+
+	s_actionsCount = 0;
+	s_nextAction = 0;
+	s_scriptDone = FALSE;
+	s_nextKeyAt = s_keypadAvr->cycle;
+
+	while(NULL_PTR != fgets(line,sizeof(line),file))
+	{
+		comment = strchr(line,'#');
+		if(NULL_PTR != comment)
+		{
+			*comment = '\0';
+		}
+		for(token = strtok(line," \t\r\n") ; NULL_PTR != token ; token = strtok(NULL_PTR," \t\r\n"))
+		{
+			if(0 == strcmp(token,"wait"))
+			{
+				token = strtok(NULL_PTR," \t\r\n");
+				HARNESS_KEYPAD_push(HARNESS_NO_KEY,(NULL_PTR == token) ? 0 : (uint32)atol(token));
+				continue;
+			}
+			for(key = token ; '\0' != *key ; key++)
+			{
+				for(button = 0 ; button < 16 && s_keys[button] != *key ; button++);
+				if(button < 16)
+				{
+					HARNESS_KEYPAD_push(button,0);
+				}
+				else
+				{
+					fprintf(stderr,"%s: unknown key '%c'\n",a_file,*key);
+				}
+			}
+		}
+	}
+	fclose(file);
+	return TRUE;
+}
+
+boolean HARNESS_KEYPAD_done(void)
+{
+	return s_scriptDone;
+}
+
+void HARNESS_LCD_attach(avr_t * a_avr)
+{
+	s_lcdAvr = a_avr;
+	memset(s_screen,' ',sizeof(s_screen));
+	memset(s_printed,' ',sizeof(s_printed));
+	avr_irq_register_notify(avr_io_getirq(a_avr,AVR_IOCTL_IOPORT_GETIRQ('A' + LCD_E_PORT_ID),LCD_E_PIN_ID),
+			&HARNESS_LCD_enableChanged,NULL_PTR);
+}
+
+void HARNESS_DOOR_attach(avr_t * a_avr)
+{
+	s_doorAvr = a_avr;
+	a_avr->avcc = HARNESS_AVCC_MV;
+	a_avr->aref = HARNESS_AVCC_MV;
+
+	s_encoderIrq = avr_io_getirq(a_avr,AVR_IOCTL_IOPORT_GETIRQ('A' + POSITION_ENCODER_PORT),POSITION_ENCODER_PIN);
+	s_openLimitIrq = avr_io_getirq(a_avr,AVR_IOCTL_IOPORT_GETIRQ('A' + POSITION_OPEN_LIMIT_PORT),POSITION_OPEN_LIMIT_PIN);
+	s_closedLimitIrq = avr_io_getirq(a_avr,AVR_IOCTL_IOPORT_GETIRQ('A' + POSITION_CLOSED_LIMIT_PORT),POSITION_CLOSED_LIMIT_PIN);
+	s_currentIrq = avr_io_getirq(a_avr,AVR_IOCTL_ADC_GETIRQ,ADC_IRQ_ADC0);
+
+	avr_raise_irq(s_encoderIrq,LOGIC_LOW);
+	avr_irq_register_notify(avr_io_getirq(a_avr,AVR_IOCTL_IOPORT_GETIRQ('A' + DC_MOTOR_PORT1),IOPORT_IRQ_REG_PORT),
+			&HARNESS_DOOR_portWritten,NULL_PTR);
+	avr_cycle_timer_register_usec(a_avr,HARNESS_DOOR_UPDATE_US,&HARNESS_DOOR_update,NULL_PTR);
+	HARNESS_DOOR_update(a_avr,a_avr->cycle,NULL_PTR);
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+/* Description :
+ * A byte of the report , print the line once complete*/
+static void HARNESS_BENCH_output(avr_irq_t * a_irq , uint32_t a_value , void * a_param)
+{
+	HARNESS_BenchType * bench = (HARNESS_BenchType *)a_param;
+
+	(void)a_irq;
+	if('\r' == a_value)
+	{
+		return;
+	}
+	if('\n' != a_value && bench->length < HARNESS_BENCH_LINE_SIZE - 1)
+	{
+		bench->line[bench->length++] = (char)a_value;
+		return;
+	}
+	bench->line[bench->length] = '\0';
+	bench->length = 0;
+	printf("%s\n",bench->line);
+	if(0 == strncmp(bench->line,"bench=end",9))
+	{
+		bench->ended = TRUE;
+	}
+}
+
+/* Description :
+ * A byte left one USART , hand it to the other one if its FIFO has room*/
+static void HARNESS_linkOutput(avr_irq_t * a_irq , uint32_t a_value , void * a_param)
+{
+	HARNESS_LinkType * link = (HARNESS_LinkType *)a_param;
+	uint16 next = (link->head + 1) % HARNESS_LINK_QUEUE_SIZE;
+
+	(void)a_irq;
+	if(next != link->tail)
+	{
+		link->queue[link->head] = (uint8)a_value;
+		link->head = next;
+	}
+	HARNESS_linkDrain(link);
+}
+
+static void HARNESS_linkXon(avr_irq_t * a_irq , uint32_t a_value , void * a_param)
+{
+	HARNESS_LinkType * link = (HARNESS_LinkType *)a_param;
+
+	(void)a_irq;
+	(void)a_value;
+	link->xoff = FALSE;
+	HARNESS_linkDrain(link);
+}
+
+static void HARNESS_linkXoff(avr_irq_t * a_irq , uint32_t a_value , void * a_param)
+{
+	(void)a_irq;
+	(void)a_value;
+	((HARNESS_LinkType *)a_param)->xoff = TRUE;
+}
+
+static void HARNESS_linkDrain(HARNESS_LinkType * a_link)
+{
+	while(FALSE == a_link->xoff && a_link->tail != a_link->head)
+	{
+		avr_raise_irq(a_link->input,a_link->queue[a_link->tail]);
+		a_link->tail = (a_link->tail + 1) % HARNESS_LINK_QUEUE_SIZE;
+	}
+}
+
+/* Description :
+ * One TWI bus event : start / address , data written , data read or stop*/
+static void HARNESS_EEPROM_message(avr_irq_t * a_irq , uint32_t a_value , void * a_param)
+{
+	avr_twi_msg_irq_t message;
+	uint16 page;
+
+	(void)a_irq;
+	(void)a_param;
+	message.u.v = a_value;
+
+	if(message.u.twi.msg & TWI_COND_STOP)
+	{
+		if(s_eepromWritten)
+		{
+			HARNESS_EEPROM_save();
+			s_eepromWritten = FALSE;
+		}
+		s_eepromSelected = 0;
+	}
+
+	if(message.u.twi.msg & TWI_COND_START)
+	{
+		s_eepromSelected = 0;
+		/*The block bits of the device address are the high word address bits*/
+		if(HARNESS_EEPROM_ADDRESS == ((message.u.twi.addr >> 1) & 0x78))
+		{
+			s_eepromSelected = message.u.twi.addr;
+			if(0 == (message.u.twi.addr & 1))
+			{
+				s_eepromPointer = (uint16)((message.u.twi.addr >> 1) & 0x07) << 8;
+				s_eepromAddressPending = TRUE;
+			}
+			avr_raise_irq(s_eepromIrq + TWI_IRQ_INPUT,avr_twi_irq_msg(TWI_COND_ACK,s_eepromSelected,1));
+		}
+	}
+
+	if(0 == s_eepromSelected)
+	{
+		return;
+	}
+
+	if(message.u.twi.msg & TWI_COND_WRITE)
+	{
+		avr_raise_irq(s_eepromIrq + TWI_IRQ_INPUT,avr_twi_irq_msg(TWI_COND_ACK,s_eepromSelected,1));
+		if(s_eepromAddressPending)
+		{
+			s_eepromPointer |= message.u.twi.data;
+			s_eepromAddressPending = FALSE;
+		}
+		else
+		{
+			s_eeprom[s_eepromPointer] = message.u.twi.data;
+			s_eepromWritten = TRUE;
+			/*The address rolls over inside the page*/
+			page = s_eepromPointer & ~(HARNESS_EEPROM_PAGE - 1);
+			s_eepromPointer = page | ((s_eepromPointer + 1) & (HARNESS_EEPROM_PAGE - 1));
+		}
+	}
+
+	if(message.u.twi.msg & TWI_COND_READ)
+	{
+		avr_raise_irq(s_eepromIrq + TWI_IRQ_INPUT,
+				avr_twi_irq_msg(TWI_COND_READ,s_eepromSelected,s_eeprom[s_eepromPointer]));
+		s_eepromPointer = (s_eepromPointer + 1) % HARNESS_EEPROM_SIZE;
+	}
+}
+
+static void HARNESS_EEPROM_save(void)
+{
+	FILE * file;
+
+	if(NULL_PTR != s_eepromFile && NULL_PTR != (file = fopen(s_eepromFile,"wb")))
+	{
+		fwrite(s_eeprom,1,sizeof(s_eeprom),file);
+		fclose(file);
+	}
+}
+
+/* Description :
+ * The keypad driver drove or released a row : connect the pressed key ,
+ * release it once its row is left & press the next key of the script*/
+static void HARNESS_KEYPAD_rowsChanged(avr_irq_t * a_irq , uint32_t a_value , void * a_param)
+{
+	uint8 ddr = s_keypadAvr->data[HARNESS_DDRB];
+	uint8 port = s_keypadAvr->data[HARNESS_PORTB];
+	boolean rowActive = FALSE;
+	uint8 column;
+	uint8 pin;
+
+	(void)a_irq;
+	(void)a_value;
+	(void)a_param;
+
+	if(HARNESS_NO_KEY != s_pressed)
+	{
+		pin = KEYPAD_FIRST_ROW_PIN_ID + s_pressed / KEYPAD_NUM_COLS;
+		rowActive = (BIT_IS_SET(ddr,pin) && BIT_IS_CLEAR(port,pin)) ? TRUE : FALSE;
+		if(rowActive)
+		{
+			s_seen = TRUE;
+		}
+		else if(s_seen)
+		{
+			s_pressed = HARNESS_NO_KEY;
+		}
+	}
+
+	while(HARNESS_NO_KEY == s_pressed && s_nextAction < s_actionsCount && s_keypadAvr->cycle >= s_nextKeyAt)
+	{
+		if(HARNESS_NO_KEY == s_actions[s_nextAction].button)
+		{
+			s_nextKeyAt = s_keypadAvr->cycle + avr_usec_to_cycles(s_keypadAvr,s_actions[s_nextAction].wait * 1000UL);
+		}
+		else
+		{
+			s_pressed = s_actions[s_nextAction].button;
+			s_seen = FALSE;
+			HARNESS_log(s_keypadAvr,"key %c",s_keys[s_pressed]);
+		}
+		s_nextAction++;
+	}
+
+	if(HARNESS_NO_KEY == s_pressed && s_nextAction >= s_actionsCount && s_keypadAvr->cycle >= s_nextKeyAt)
+	{
+		s_scriptDone = TRUE;
+	}
+
+	for(column = 0 ; column < KEYPAD_NUM_COLS ; column++)
+	{
+		avr_raise_irq(s_columnIrq[column],LOGIC_HIGH);
+	}
+	if(HARNESS_NO_KEY != s_pressed)
+	{
+		pin = KEYPAD_FIRST_ROW_PIN_ID + s_pressed / KEYPAD_NUM_COLS;
+		if(BIT_IS_SET(ddr,pin) && BIT_IS_CLEAR(port,pin))
+		{
+			avr_raise_irq(s_columnIrq[s_pressed % KEYPAD_NUM_COLS],LOGIC_LOW);
+			s_seen = TRUE;
+		}
+	}
+}
+
+static void HARNESS_KEYPAD_push(uint8 a_button , uint32 a_wait)
+{
+	HARNESS_KeyActionType * actions = realloc(s_actions,(s_actionsCount + 1) * sizeof(HARNESS_KeyActionType));
+
+	if(NULL_PTR != actions)
+	{
+		s_actions = actions;
+		s_actions[s_actionsCount].button = a_button;
+		s_actions[s_actionsCount].wait = a_wait;
+		s_actionsCount++;
+	}
+}
+
+/* Description :
+ * Latch a nibble on the falling edge of E*/
+static void HARNESS_LCD_enableChanged(avr_irq_t * a_irq , uint32_t a_value , void * a_param)
+{
+	uint8 output = s_lcdAvr->data[HARNESS_PORTA];
+	uint8 nibble;
+
+	(void)a_irq;
+	(void)a_param;
+	if(0 != a_value || BIT_IS_CLEAR(s_lcdAvr->data[HARNESS_DDRA],LCD_E_PIN_ID))
+	{
+		return;
+	}
+
+	nibble = (BIT_IS_SET(output,LCD_DB4_PIN_ID) ? 0x01 : 0) |
+			(BIT_IS_SET(output,LCD_DB5_PIN_ID) ? 0x02 : 0) |
+			(BIT_IS_SET(output,LCD_DB6_PIN_ID) ? 0x04 : 0) |
+			(BIT_IS_SET(output,LCD_DB7_PIN_ID) ? 0x08 : 0);
+	if(s_secondNibble)
+	{
+		HARNESS_LCD_execute(BIT_IS_SET(output,LCD_RS_PIN_ID) ? LOGIC_HIGH : LOGIC_LOW,
+				(s_highNibble << 4) | nibble);
+	}
+	else
+	{
+		s_highNibble = nibble;
+	}
+	s_secondNibble = !s_secondNibble;
+}
+
+static void HARNESS_LCD_execute(uint8 a_rs , uint8 a_byte)
+{
+	uint8 row;
+	uint8 column;
+
+	if(LOGIC_HIGH == a_rs)
+	{
+		row = (s_lcdAddress >= HARNESS_LCD_ROW1_ADDRESS) ? 1 : 0;
+		column = s_lcdAddress - row * HARNESS_LCD_ROW1_ADDRESS;
+		if(column < HARNESS_LCD_COLUMNS)
+		{
+			s_screen[row][column] = (a_byte >= ' ' && a_byte < 0x7F) ? a_byte : '?';
+		}
+		s_lcdAddress++;
+	}
+	else if(a_byte & LCD_SET_CURSOR_LOCATION)
+	{
+		s_lcdAddress = a_byte & 0x7F;
+	}
+	else if(LCD_CLEAR_COMMAND == a_byte)
+	{
+		memset(s_screen,' ',sizeof(s_screen));
+		s_lcdAddress = 0;
+	}
+	else if(LCD_GO_TO_HOME == (a_byte & 0xFE))
+	{
+		s_lcdAddress = 0;
+	}
+
+	/*Print once the screen settled*/
+	avr_cycle_timer_cancel(s_lcdAvr,&HARNESS_LCD_print,NULL_PTR);
+	avr_cycle_timer_register_usec(s_lcdAvr,200000,&HARNESS_LCD_print,NULL_PTR);
+}
+
+static avr_cycle_count_t HARNESS_LCD_print(avr_t * a_avr , avr_cycle_count_t a_when , void * a_param)
+{
+	(void)a_when;
+	(void)a_param;
+	if(0 != memcmp(s_screen,s_printed,sizeof(s_screen)))
+	{
+		memcpy(s_printed,s_screen,sizeof(s_screen));
+		HARNESS_log(a_avr,"LCD |%.16s|%.16s|",s_screen[0],s_screen[1]);
+	}
+	return 0;
+}
+
+/* Description :
+ * Move the door one step , pulse the encoder , update the limit switches
+ * & the current seen by ADC0 (same model as sim/door_plant.c)*/
+static avr_cycle_count_t HARNESS_DOOR_update(avr_t * a_avr , avr_cycle_count_t a_when , void * a_param)
+{
+	const double step = HARNESS_DOOR_UPDATE_US / 1e6;
+	/*Fast PWM on OC0 , no output while TIMER0 is stopped*/
+	double duty = (0 == (a_avr->data[HARNESS_TCCR0] & 0x07)) ? 0.0 : a_avr->data[HARNESS_OCR0] / 255.0;
+	double target;
+	sint32 pulsesBefore = (sint32)s_position;
+	sint32 pulse;
+	boolean stalled = FALSE;
+
+	(void)a_param;
+
+	s_position += s_direction * duty * HARNESS_DOOR_MAX_SPEED * step;
+	if(s_position <= 0.0)
+	{
+		s_position = 0.0;
+		stalled = (s_direction < 0) ? TRUE : FALSE;
+	}
+	else if(s_position >= HARNESS_DOOR_TRAVEL_PULSES)
+	{
+		s_position = HARNESS_DOOR_TRAVEL_PULSES;
+		stalled = (s_direction > 0) ? TRUE : FALSE;
+	}
+
+	/*One rising edge on INT0 per pulse crossed*/
+	for(pulse = pulsesBefore ; pulse != (sint32)s_position ; pulse += (pulse < (sint32)s_position) ? 1 : -1)
+	{
+		avr_raise_irq(s_encoderIrq,LOGIC_HIGH);
+		avr_raise_irq(s_encoderIrq,LOGIC_LOW);
+	}
+
+	/*Active low limit switches , pulled up otherwise*/
+	avr_raise_irq(s_openLimitIrq,(s_position >= HARNESS_DOOR_TRAVEL_PULSES) ? LOGIC_LOW : LOGIC_HIGH);
+	avr_raise_irq(s_closedLimitIrq,(s_position <= 0.0) ? LOGIC_LOW : LOGIC_HIGH);
+
+	if(0 == s_direction || 0.0 == duty)
+	{
+		target = 0.0;
+	}
+	else if(stalled)
+	{
+		target = HARNESS_DOOR_STALL_CURRENT * duty;
+	}
+	else
+	{
+		target = HARNESS_DOOR_RUN_CURRENT + HARNESS_DOOR_LOAD_CURRENT * duty;
+	}
+	s_current += (target - s_current) * step / (HARNESS_DOOR_CURRENT_RISE + step);
+
+	/*simavr takes the ADC inputs in millivolts*/
+	avr_raise_irq(s_currentIrq,(uint32_t)(s_current * HARNESS_AVCC_MV / 1024.0));
+
+	return a_when + avr_usec_to_cycles(a_avr,HARNESS_DOOR_UPDATE_US);
+}
+
+/* Description :
+ * Follow the H-bridge inputs & the buzzer*/
+static void HARNESS_DOOR_portWritten(avr_irq_t * a_irq , uint32_t a_value , void * a_param)
+{
+	sint8 direction = 0;
+
+	(void)a_irq;
+	(void)a_param;
+	if(BIT_IS_SET(a_value,DC_MOTOR_PIN1) && BIT_IS_CLEAR(a_value,DC_MOTOR_PIN2))
+	{
+		direction = 1;
+	}
+	else if(BIT_IS_CLEAR(a_value,DC_MOTOR_PIN1) && BIT_IS_SET(a_value,DC_MOTOR_PIN2))
+	{
+		direction = -1;
+	}
+	if(direction != s_direction)
+	{
+		s_direction = direction;
+		HARNESS_log(s_doorAvr,"motor %s at %d pulses",(direction > 0) ? "opening" :
+				((direction < 0) ? "closing" : "stopped"),(int)s_position);
+	}
+
+	if((BIT_IS_SET(a_value,BUZZER_PIN) ? LOGIC_HIGH : LOGIC_LOW) != s_buzzer)
+	{
+		s_buzzer = BIT_IS_SET(a_value,BUZZER_PIN) ? LOGIC_HIGH : LOGIC_LOW;
+		HARNESS_log(s_doorAvr,"buzzer %s",(LOGIC_HIGH == s_buzzer) ? "on" : "off");
+	}
+}
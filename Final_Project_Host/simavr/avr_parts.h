@@ -0,0 +1,121 @@
+/******************************************************************************
+ *
+ * Module: simavr Harness
+ *
+ * File Name: avr_parts.h
+ *
+ * Description: Header file for the parts wired to the two simavr cores :
+ * 				serial line between the USARTs , 24C16 on TWI , keypad
+ * 				matrix fed from a script , HD44780 LCD & the door plant
+ * 				(motor , encoder , limit switches , current on ADC0)
+ *
+ * 				They are the simavr counterparts of the models of the sim
+ * 				directory & follow the same pin map (keypad.h , LCD.h ,
+ * 				DCMotor.h , door_position.h ...).
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+#ifndef AVR_PARTS_H_
+#define AVR_PARTS_H_
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include "sim_avr.h"
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*ATmega32 data space addresses (I/O address + 0x20)*/
+#define HARNESS_PORTA			0x3B
+#define HARNESS_DDRA			0x3A
+#define HARNESS_PORTB			0x38
+#define HARNESS_DDRB			0x37
+#define HARNESS_OCR0			0x5C
+#define HARNESS_TCCR0			0x53
+
+/*24C16 : 8 blocks of 256 bytes at 0x50 - 0x57 , 16 bytes pages*/
+#define HARNESS_EEPROM_ADDRESS	0x50
+#define HARNESS_EEPROM_SIZE		2048
+#define HARNESS_EEPROM_PAGE		16
+
+/*Longest report line of a benchmark build*/
+#define HARNESS_BENCH_LINE_SIZE	128
+
+/*Bytes sent to a USART whose receive FIFO is full*/
+#define HARNESS_LINK_QUEUE_SIZE	256
+
+/*Same mechanics & current model as sim/door_plant.h*/
+#define HARNESS_DOOR_TRAVEL_PULSES	600
+#define HARNESS_DOOR_MAX_SPEED		110.0	/*pulses/s*/
+#define HARNESS_DOOR_RUN_CURRENT	40.0	/*ADC counts*/
+#define HARNESS_DOOR_LOAD_CURRENT	150.0
+#define HARNESS_DOOR_STALL_CURRENT	600.0
+#define HARNESS_DOOR_CURRENT_RISE	0.02	/*s*/
+#define HARNESS_DOOR_UPDATE_US		1000
+#define HARNESS_AVCC_MV				5000
+
+#define HARNESS_LCD_ROWS		2
+#define HARNESS_LCD_COLUMNS		16
+#define HARNESS_LCD_ROW1_ADDRESS	0x40
+
+/*******************************************************************************
+ *                             Functions Prototypes                            *
+ *******************************************************************************/
+
+/* Description :
+ * Name the core in the log lines*/
+void HARNESS_setName(avr_t * a_avr , const char * a_name);
+
+/* Description :
+ * Print one line prefixed by the simulated time & the name of the core*/
+void HARNESS_log(avr_t * a_avr , const char * a_format , ...) __attribute__((format(printf,2,3)));
+
+/* Description :
+ * Cross the USARTs of the two cores , every byte sent by one is received
+ * by the other (simavr times the frames at the configured baud rate)*/
+void HARNESS_linkUarts(avr_t * a_first , avr_t * a_second);
+
+/* Description :
+ * Print the report lines a benchmark build (DRIVER_BENCH) sends on the USART*/
+void HARNESS_BENCH_attach(avr_t * a_avr);
+
+/* Description :
+ * Return TRUE once every attached core sent its "bench=end" line*/
+boolean HARNESS_BENCH_done(void);
+
+/* Description :
+ * Attach a 24C16 to the TWI of a core , a_file keeps the content
+ * between runs (NULL for an erased part)*/
+void HARNESS_EEPROM_attach(avr_t * a_avr , const char * a_file);
+
+/* Description :
+ * Wire the keypad matrix to the HMI core*/
+void HARNESS_KEYPAD_attach(avr_t * a_avr);
+
+/* Description :
+ * Queue the keys & waits of a script (same syntax as the host simulation)
+ * Returns FALSE if the file can't be read*/
+boolean HARNESS_KEYPAD_load(const char * a_file);
+
+/* Description :
+ * Return TRUE once the script is over & the firmware scans the keypad again*/
+boolean HARNESS_KEYPAD_done(void);
+
+/* Description :
+ * Wire the LCD to the HMI core , the screens are printed as they change*/
+void HARNESS_LCD_attach(avr_t * a_avr);
+
+/* Description :
+ * Wire the door plant to the Control core (door closed)*/
+void HARNESS_DOOR_attach(avr_t * a_avr);
+
+#endif /* AVR_PARTS_H_ */
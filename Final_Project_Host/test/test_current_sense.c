@@ -0,0 +1,191 @@
+/******************************************************************************
+ *
+ * Module: Current Sense Test
+ *
+ * File Name: test_current_sense.c
+ *
+ * Description: Host test of the end-stop & stall detectors of current_sense.c
+ *
+ * 				The module is built alone , the ADC driver & the position
+ * 				module are replaced by the stubs below. Every case starts a
+ * 				movement , feeds a current trace at the free running ADC rate
+ * 				(first order response like the door plant model) & checks
+ * 				the event reported to the call back.
+ *
+ * 				Report (stdout , one key=value record per line) :
+ * 				test ... event ... result , the exit status is the number
+ * 				of failed cases.
+ *
+ * Created on: Oct 19, 2026
+ *
+ * Author: Karim Amr
+ *
+******************************************************************************/
+
+/*******************************************************************************
+ *                            Required Libraries                               *
+ *******************************************************************************/
+
+#include <stdio.h>
+#include "ADC.h"
+#include "door_position.h"
+#include "current_sense.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/*ADC clock F_CPU/128 , 13 clocks per conversion*/
+#define TEST_SAMPLE_RATE		(F_CPU / 128.0 / 13.0)
+
+#define TEST_RUN_CURRENT		40.0
+#define TEST_STALL_CURRENT		600.0
+#define TEST_CURRENT_RISE		0.02	/*s*/
+
+/*Past the blanking time*/
+#define TEST_RUN_TIME			1.0		/*s*/
+#define TEST_EVENT_TIME			1.0		/*s*/
+
+/*******************************************************************************
+ *                              Type Definitions                               *
+ *******************************************************************************/
+
+typedef struct
+{
+	const char * name;
+	double target;			/*Current the trace rises to (ADC counts)*/
+	boolean atEnd;			/*Position module answer during the rise*/
+	double atEndDelay;		/*Rise time after which the bolt is at its end (s) , 0 = never*/
+	CURRENT_EventType expected;
+}TEST_CaseType;
+
+/*******************************************************************************
+ *                          Local Variable declaration                         *
+ *******************************************************************************/
+
+static void (*s_adcCallBack)(uint16) = NULL_PTR;
+static boolean s_atEnd = FALSE;
+
+static CURRENT_EventType s_event = CURRENT_NO_EVENT;
+static uint8 s_eventCount = 0;
+
+static const TEST_CaseType s_cases[] =
+{
+	/*Bolt jammed mid travel : the sharp rise isn't an end-stop*/
+	{"jam_mid_travel",TEST_STALL_CURRENT,FALSE,0.0,CURRENT_STALL},
+	/*Same rise at the end of the travel*/
+	{"end_stop",TEST_STALL_CURRENT,TRUE,0.0,CURRENT_END_STOP},
+	/*Rise held , the bolt reaches its end before the current settles*/
+	{"end_stop_late_position",300.0,FALSE,0.045,CURRENT_END_STOP},
+	/*Heavier load mid travel , settles under the stall level*/
+	{"load_step",300.0,FALSE,0.0,CURRENT_NO_EVENT},
+};
+
+static const char * const s_eventNames[] = {"none","end_stop","stall"};
+
+/*******************************************************************************
+ *                                   Stubs                                     *
+ *******************************************************************************/
+
+void ADC_init(const ADC_ConfigType * Config_Ptr)
+{
+	(void)Config_Ptr;
+}
+
+void ADC_startFreeRunning(uint8 channel_num)
+{
+	(void)channel_num;
+}
+
+void ADC_stop(void)
+{
+}
+
+void ADC_setCallBack(void(*a_ptr)(uint16))
+{
+	s_adcCallBack = a_ptr;
+}
+
+boolean POSITION_isAtEnd(void)
+{
+	return s_atEnd;
+}
+
+/*******************************************************************************
+ *                        Private Functions Definitions                        *
+ *******************************************************************************/
+
+static void TEST_event(CURRENT_EventType a_event)
+{
+	s_event = a_event;
+	s_eventCount++;
+}
+
+/* Description :
+ * Feed a_time seconds of a first order response towards a_target*/
+static void TEST_feed(double * a_current , double a_target , double a_time)
+{
+	const double step = 1.0 / TEST_SAMPLE_RATE;
+	double t;
+
+	for(t = 0.0 ; t < a_time ; t += step)
+	{
+		*a_current += (a_target - *a_current) * step / (TEST_CURRENT_RISE + step);
+		s_adcCallBack((*a_current > 1023.0) ? 1023 : (uint16)*a_current);
+	}
+}
+
+static boolean TEST_run(const TEST_CaseType * a_case)
+{
+	double current = 0.0;
+	boolean pass;
+
+	s_event = CURRENT_NO_EVENT;
+	s_eventCount = 0;
+	s_atEnd = FALSE;
+
+	CURRENT_start();
+
+	/*Inrush & free running*/
+	TEST_feed(&current,TEST_RUN_CURRENT,TEST_RUN_TIME);
+
+	s_atEnd = a_case->atEnd;
+	if(0.0 != a_case->atEndDelay)
+	{
+		TEST_feed(&current,a_case->target,a_case->atEndDelay);
+		s_atEnd = TRUE;
+	}
+	TEST_feed(&current,a_case->target,TEST_EVENT_TIME);
+
+	CURRENT_stop();
+
+	pass = (a_case->expected == s_event) && (s_eventCount <= 1);
+
+	printf("test=%s event=%s expected=%s result=%s\n",a_case->name,s_eventNames[s_event],
+			s_eventNames[a_case->expected],pass ? "pass" : "FAIL");
+
+	return pass;
+}
+
+/*******************************************************************************
+ *                                 Main Function                               *
+ *******************************************************************************/
+
+int main(void)
+{
+	uint8 i;
+	int failed = 0;
+
+	CURRENT_init();
+	CURRENT_setCallBack(&TEST_event);
+
+	for(i = 0 ; i < sizeof(s_cases) / sizeof(s_cases[0]) ; i++)
+	{
+		if(FALSE == TEST_run(&s_cases[i]))
+		{
+			failed++;
+		}
+	}
+
+	return failed;
+}
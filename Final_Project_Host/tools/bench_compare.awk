@@ -0,0 +1,51 @@
+################################################################################
+#
+# Compare a driver benchmark report with a baseline report
+#
+#   awk -v tolerance=10 -f bench_compare.awk baseline.txt report.txt
+#
+# Both files hold the "bench=<case> ecu=<ECU> ... avg=<cycles>" lines of
+# make driver-bench. A case whose average grew by more than tolerance %
+# is a regression , the exit status is 1 if there is any.
+#
+################################################################################
+
+function field(key ,    i , pair)
+{
+	for(i = 1 ; i <= NF ; i++)
+	{
+		split($i , pair , "=")
+		if(pair[1] == key)
+		{
+			return pair[2]
+		}
+	}
+	return ""
+}
+
+/^bench=/ {
+	name = field("bench") " " field("ecu")
+	if(FNR == NR)
+	{
+		baseline[name] = field("avg") + 0
+		next
+	}
+	average = field("avg") + 0
+	if(!(name in baseline))
+	{
+		printf("new        %-36s avg=%s\n" , name , average)
+	}
+	else if(average > baseline[name] * (1 + tolerance / 100))
+	{
+		printf("REGRESSION %-36s avg=%s baseline=%s\n" , name , average , baseline[name])
+		failed = 1
+	}
+	else
+	{
+		printf("ok         %-36s avg=%s baseline=%s\n" , name , average , baseline[name])
+	}
+}
+
+END {
+	exit failed
+}
@@ -0,0 +1,115 @@
+################################################################################
+#
+# Static RAM used by every module of an ECU , from its linker map file
+#
+#   awk -v ram=2048 -f ram_report.awk Final_Project_Control_ECU.map
+#
+# Sums the input sections of .data , .bss & .noinit per object file :
+#
+#   module=<object> data=<bytes> bss=<bytes> noinit=<bytes> total=<bytes>
+#   ...
+#   static data=<bytes> bss=<bytes> noinit=<bytes> total=<bytes> ram=<bytes> stack=<bytes>
+#
+# stack is the RAM left for the stack (no heap in this project) , the
+# run time headroom of stack_monitor tells how much of it is really used.
+#
+################################################################################
+
+function hex(text ,    value , i)
+{
+	value = 0
+	text = tolower(text)
+	sub(/^0x/ , "" , text)
+	for(i = 1 ; i <= length(text) ; i++)
+	{
+		value = value * 16 + index("0123456789abcdef" , substr(text , i , 1)) - 1
+	}
+	return value
+}
+
+function module(path ,    name)
+{
+	name = path
+	sub(/.*[\/\\]/ , "" , name)		# ./USART.o , libgcc.a(_udivmodsi4.o)
+	if(name ~ /\.a\(/)
+	{
+		sub(/\.a\(/ , ":" , name)		# libgcc:_udivmodsi4.o)
+		sub(/\)$/ , "" , name)
+	}
+	sub(/\.o$/ , "" , name)
+	if(name ~ /^crt/)
+	{
+		name = "startup"
+	}
+	return name
+}
+
+function add(size , path ,    name)
+{
+	size = hex(size)
+	if(size == 0)
+	{
+		return
+	}
+	name = module(path)
+	bytes[name , output] += size
+	total[name] += size
+	sum[output] += size
+	if(!(name in seen))
+	{
+		seen[name] = 1
+		order[count++] = name
+	}
+}
+
+BEGIN {
+	if(ram == "")
+	{
+		ram = 2048
+	}
+}
+
+# Map files written on Windows
+{ sub(/\r$/ , "") }
+
+# Output sections start on the first column
+/^\.[A-Za-z_]/ {
+	output = ($1 == ".data" || $1 == ".bss" || $1 == ".noinit") ? substr($1 , 2) : ""
+	pending = 0
+	next
+}
+
+output == "" { next }
+
+# Input section on one line : name address size object
+/^ (\.|COMMON)/ && NF >= 4 && $2 ~ /^0x/ && $3 ~ /^0x/ {
+	add($3 , $4)
+	pending = 0
+	next
+}
+
+# Long input section name , address size object on the next line
+/^ (\.|COMMON)/ && NF == 1 {
+	pending = 1
+	next
+}
+
+pending && NF >= 3 && $1 ~ /^0x/ && $2 ~ /^0x/ {
+	add($2 , $3)
+	pending = 0
+	next
+}
+
+{ pending = 0 }
+
+END {
+	for(i = 0 ; i < count ; i++)
+	{
+		name = order[i]
+		printf("module=%s data=%d bss=%d noinit=%d total=%d\n" , name ,
+				bytes[name , "data"] , bytes[name , "bss"] , bytes[name , "noinit"] , total[name])
+	}
+	used = sum["data"] + sum["bss"] + sum["noinit"]
+	printf("static data=%d bss=%d noinit=%d total=%d ram=%d stack=%d\n" ,
+			sum["data"] , sum["bss"] , sum["noinit"] , used , ram , ram - used)
+}